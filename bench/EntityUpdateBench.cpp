@@ -0,0 +1,336 @@
+// Mise à jour des entités de LightScene : ancien tableau de structures (boucle scalaire objet par objet)
+// contre colonnes structure-of-arrays avancées par EntityKernels, à chaque niveau SIMD disponible
+// Usage : EntityUpdateBench [entites] [frames]
+
+#include "EntityKernels.h"
+#include "Random.h"
+
+#include <glm/glm.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+namespace
+{
+    const float DELTA_TIME = 1.0f / 60.0f;
+    const uint64_t BENCH_SEED = 42;
+
+    // === Ancienne disposition (LightScene avant les colonnes) ===
+
+    struct AsteroidData
+    {
+        float angleOffset, radiusOffset, scale, rotationSpeed;
+        glm::vec3 rotationAxis, color;
+        float orbitSpeed, currentAngle;
+        size_t lod;
+    };
+
+    struct SpaceshipData
+    {
+        glm::vec3 color;
+        float angleOffset, orbitRadius, orbitSpeed, currentAngle;
+        glm::vec3 randomOffset;
+        float randomPhase;
+        float heightFreq1, heightFreq2, heightFreq3;
+        float heightAmp1, heightAmp2, heightAmp3;
+        float heightPhase1, heightPhase2, heightPhase3;
+        float horizontalFreq1, horizontalFreq2;
+        float horizontalAmp1, horizontalAmp2;
+        float horizontalPhase1, horizontalPhase2;
+        float scale;
+        size_t lod;
+    };
+
+    struct SpaceDebris
+    {
+        glm::vec3 position, velocity, angularVelocity, rotation;
+        float scale;
+        glm::vec3 color;
+        float lifetime, maxLifetime;
+        size_t lod;
+    };
+
+    struct LegacyEntities
+    {
+        std::vector<AsteroidData> asteroids;
+        std::vector<SpaceshipData> spaceships;
+        std::vector<SpaceDebris> debris;
+    };
+
+    // Boucles de l'ancien LightScene::Update / UpdateDebris (sans respawn : durées de vie longues)
+    void updateLegacyAsteroids(LegacyEntities &e, float deltaTime)
+    {
+        for (AsteroidData &asteroid : e.asteroids)
+        {
+            asteroid.currentAngle += asteroid.orbitSpeed * deltaTime;
+            if (asteroid.currentAngle > 2.0f * M_PI) asteroid.currentAngle -= 2.0f * M_PI;
+        }
+    }
+
+    void updateLegacySpaceships(LegacyEntities &e, float deltaTime)
+    {
+        for (SpaceshipData &ship : e.spaceships)
+        {
+            ship.currentAngle += ship.orbitSpeed * deltaTime;
+            if (ship.currentAngle > 2.0f * M_PI)
+                ship.currentAngle -= 2.0f * M_PI;
+            ship.randomPhase += deltaTime * 2.0f;
+            if (ship.randomPhase > 2.0f * M_PI)
+                ship.randomPhase -= 2.0f * M_PI;
+            ship.heightPhase1 += deltaTime * ship.heightFreq1;
+            ship.heightPhase2 += deltaTime * ship.heightFreq2;
+            ship.heightPhase3 += deltaTime * ship.heightFreq3;
+            ship.horizontalPhase1 += deltaTime * ship.horizontalFreq1;
+            ship.horizontalPhase2 += deltaTime * ship.horizontalFreq2;
+        }
+    }
+
+    void updateLegacyDebris(LegacyEntities &e, float deltaTime)
+    {
+        for (SpaceDebris &d : e.debris)
+        {
+            d.position += d.velocity * deltaTime;
+            d.rotation += d.angularVelocity * deltaTime;
+            d.lifetime -= deltaTime;
+            if (d.lifetime <= 0.0f)
+                d.lifetime = d.maxLifetime;
+        }
+    }
+
+    // === Colonnes (LightScene actuel) ===
+
+    struct ColumnEntities
+    {
+        std::vector<float> asteroidAngle, asteroidSpeed;
+        std::vector<float> shipAngle, shipSpeed, shipRandomPhase;
+        std::vector<float> shipPhases[5], shipFrequencies[5]; // heightPhase1..3, horizontalPhase1..2
+        std::vector<float> debrisPosition, debrisVelocity;    // 3 flottants par débris
+        std::vector<float> debrisRotation, debrisAngularVelocity;
+        std::vector<float> debrisLifetime, debrisMaxLifetime;
+    };
+
+    void updateColumnAsteroids(ColumnEntities &e, const EntityKernels &k, float deltaTime)
+    {
+        const float twoPi = 2.0f * static_cast<float>(M_PI);
+        k.integrateWrapped(e.asteroidAngle.data(), e.asteroidSpeed.data(), e.asteroidAngle.size(), deltaTime, twoPi);
+    }
+
+    void updateColumnSpaceships(ColumnEntities &e, const EntityKernels &k, float deltaTime)
+    {
+        const float twoPi = 2.0f * static_cast<float>(M_PI);
+        size_t count = e.shipAngle.size();
+        k.integrateWrapped(e.shipAngle.data(), e.shipSpeed.data(), count, deltaTime, twoPi);
+        k.addWrapped(e.shipRandomPhase.data(), count, deltaTime * 2.0f, twoPi);
+        for (int p = 0; p < 5; p++)
+            k.integrate(e.shipPhases[p].data(), e.shipFrequencies[p].data(), count, deltaTime);
+    }
+
+    void updateColumnDebris(ColumnEntities &e, const EntityKernels &k, float deltaTime)
+    {
+        size_t count = e.debrisLifetime.size();
+        k.integrate(e.debrisPosition.data(), e.debrisVelocity.data(), count * 3, deltaTime);
+        k.integrate(e.debrisRotation.data(), e.debrisAngularVelocity.data(), count * 3, deltaTime);
+        k.add(e.debrisLifetime.data(), count, -deltaTime);
+        for (size_t i = 0; i < count; i++)
+        {
+            if (e.debrisLifetime[i] <= 0.0f)
+                e.debrisLifetime[i] = e.debrisMaxLifetime[i];
+        }
+    }
+
+    // Mêmes valeurs initiales dans les deux dispositions (plages de LightScene) ; les colonnes sont
+    // tirées par blocs puis recopiées dans les structures. Random donne les mêmes valeurs au bit près
+    // sur toutes les plateformes, contrairement aux distributions de <random>
+    void initialize(size_t count, LegacyEntities &legacy, ColumnEntities &columns)
+    {
+        Random random(BENCH_SEED);
+        const float twoPi = 2.0f * static_cast<float>(M_PI);
+        auto fill = [&](std::vector<float> &column, size_t size, float lo, float hi)
+        {
+            column.resize(size);
+            random.FillUniform(column.data(), size, lo, hi);
+        };
+
+        columns = ColumnEntities();
+        fill(columns.asteroidAngle, count, 0.0f, twoPi);
+        fill(columns.asteroidSpeed, count, 0.3f, 0.7f);
+        fill(columns.shipAngle, count, 0.0f, twoPi);
+        fill(columns.shipSpeed, count, 0.36f, 0.67f);
+        fill(columns.shipRandomPhase, count, 0.0f, twoPi);
+        for (int p = 0; p < 5; p++)
+        {
+            fill(columns.shipPhases[p], count, 0.0f, twoPi);
+            fill(columns.shipFrequencies[p], count, 0.3f, 3.0f);
+        }
+        fill(columns.debrisPosition, count * 3, -700.0f, 700.0f);
+        fill(columns.debrisVelocity, count * 3, -5.0f, 5.0f);
+        columns.debrisRotation.assign(count * 3, 0.0f);
+        fill(columns.debrisAngularVelocity, count * 3, -2.0f, 2.0f);
+        columns.debrisMaxLifetime.assign(count, 1.0e6f);
+        columns.debrisLifetime = columns.debrisMaxLifetime;
+
+        legacy.asteroids.assign(count, AsteroidData());
+        legacy.spaceships.assign(count, SpaceshipData());
+        legacy.debris.assign(count, SpaceDebris());
+        for (size_t i = 0; i < count; i++)
+        {
+            AsteroidData &asteroid = legacy.asteroids[i];
+            asteroid.currentAngle = columns.asteroidAngle[i];
+            asteroid.orbitSpeed = columns.asteroidSpeed[i];
+
+            SpaceshipData &ship = legacy.spaceships[i];
+            ship.currentAngle = columns.shipAngle[i];
+            ship.orbitSpeed = columns.shipSpeed[i];
+            ship.randomPhase = columns.shipRandomPhase[i];
+            float *phases[5] = {&ship.heightPhase1, &ship.heightPhase2, &ship.heightPhase3, &ship.horizontalPhase1,
+                                &ship.horizontalPhase2};
+            float *frequencies[5] = {&ship.heightFreq1, &ship.heightFreq2, &ship.heightFreq3, &ship.horizontalFreq1,
+                                     &ship.horizontalFreq2};
+            for (int p = 0; p < 5; p++)
+            {
+                *phases[p] = columns.shipPhases[p][i];
+                *frequencies[p] = columns.shipFrequencies[p][i];
+            }
+
+            SpaceDebris &d = legacy.debris[i];
+            for (int c = 0; c < 3; c++)
+            {
+                d.position[c] = columns.debrisPosition[i * 3 + c];
+                d.velocity[c] = columns.debrisVelocity[i * 3 + c];
+                d.rotation[c] = columns.debrisRotation[i * 3 + c];
+                d.angularVelocity[c] = columns.debrisAngularVelocity[i * 3 + c];
+            }
+            d.maxLifetime = columns.debrisMaxLifetime[i];
+            d.lifetime = columns.debrisLifetime[i];
+        }
+    }
+
+    // Meilleur temps par frame (µs) sur quelques répétitions
+    template <typename UpdateFn>
+    double timeFrames(int frames, UpdateFn update)
+    {
+        double best = 1e30;
+        for (int repeat = 0; repeat < 5; repeat++)
+        {
+            auto start = std::chrono::steady_clock::now();
+            for (int f = 0; f < frames; f++)
+                update();
+            double us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+            best = std::min(best, us / frames);
+        }
+        return best;
+    }
+
+    bool sameColumns(const ColumnEntities &a, const ColumnEntities &b)
+    {
+        auto same = [](const std::vector<float> &x, const std::vector<float> &y)
+        { return x.size() == y.size() && std::memcmp(x.data(), y.data(), x.size() * sizeof(float)) == 0; };
+        bool result = same(a.asteroidAngle, b.asteroidAngle) && same(a.shipAngle, b.shipAngle) &&
+                      same(a.shipRandomPhase, b.shipRandomPhase) && same(a.debrisPosition, b.debrisPosition) &&
+                      same(a.debrisRotation, b.debrisRotation) && same(a.debrisLifetime, b.debrisLifetime);
+        for (int p = 0; p < 5; p++)
+            result = result && same(a.shipPhases[p], b.shipPhases[p]);
+        return result;
+    }
+
+    // Écart maximal avec l'ancienne boucle (le repli de 2π y était calculé en double)
+    float maxLegacyError(const LegacyEntities &legacy, const ColumnEntities &columns)
+    {
+        float error = 0.0f;
+        for (size_t i = 0; i < legacy.asteroids.size(); i++)
+        {
+            error = std::max(error, std::abs(legacy.asteroids[i].currentAngle - columns.asteroidAngle[i]));
+            error = std::max(error, std::abs(legacy.spaceships[i].currentAngle - columns.shipAngle[i]));
+            error = std::max(error, std::abs(legacy.spaceships[i].heightPhase1 - columns.shipPhases[0][i]));
+            for (int c = 0; c < 3; c++)
+                error = std::max(error, std::abs(legacy.debris[i].position[c] - columns.debrisPosition[i * 3 + c]));
+        }
+        return error;
+    }
+}
+
+int main(int argc, char **argv)
+{
+    size_t count = argc > 1 ? static_cast<size_t>(std::max(1, std::atoi(argv[1]))) : 100000;
+    int frames = argc > 2 ? std::max(1, std::atoi(argv[2])) : 100;
+    double per100k = 100000.0 / count;
+
+    SimdLevel available = EntityKernels::DetectLevel();
+    std::cout << count << " entités de chaque type, " << frames << " frames, niveau détecté : "
+              << EntityKernels::GetLevelName(available) << std::endl;
+    std::cout << "Temps par mise à jour, ramené à 100k entités" << std::endl << std::endl;
+
+    std::cout << std::left << std::setw(22) << "Disposition" << std::right << std::setw(14) << "Astéroïdes"
+              << std::setw(14) << "Vaisseaux" << std::setw(14) << "Débris" << std::setw(14) << "Total"
+              << std::setw(9) << "Gain" << std::endl;
+
+    auto report = [&](const std::string &label, double asteroids, double ships, double debris, double reference)
+    {
+        double total = asteroids + ships + debris;
+        std::cout << std::left << std::setw(22) << label << std::right << std::fixed << std::setprecision(1)
+                  << std::setw(11) << asteroids * per100k << " µs" << std::setw(11) << ships * per100k << " µs"
+                  << std::setw(11) << debris * per100k << " µs" << std::setw(11) << total * per100k << " µs"
+                  << std::setw(8) << reference / total << "x" << std::endl;
+        return total;
+    };
+
+    LegacyEntities legacy;
+    ColumnEntities columns;
+    initialize(count, legacy, columns);
+    double legacyAsteroids = timeFrames(frames, [&] { updateLegacyAsteroids(legacy, DELTA_TIME); });
+    double legacyShips = timeFrames(frames, [&] { updateLegacySpaceships(legacy, DELTA_TIME); });
+    double legacyDebris = timeFrames(frames, [&] { updateLegacyDebris(legacy, DELTA_TIME); });
+    double reference = legacyAsteroids + legacyShips + legacyDebris;
+    report("Structures (avant)", legacyAsteroids, legacyShips, legacyDebris, reference);
+
+    // Chaque niveau part du même état et doit produire les mêmes colonnes
+    bool identical = true;
+    float legacyError = 0.0f;
+    ColumnEntities scalarResult;
+    for (SimdLevel level : {SimdLevel::Scalar, SimdLevel::SSE2, SimdLevel::AVX2})
+    {
+        if (level > available)
+            break;
+        const EntityKernels &kernels = EntityKernels::Get(level);
+        initialize(count, legacy, columns);
+
+        double asteroids = timeFrames(frames, [&] { updateColumnAsteroids(columns, kernels, DELTA_TIME); });
+        double ships = timeFrames(frames, [&] { updateColumnSpaceships(columns, kernels, DELTA_TIME); });
+        double debris = timeFrames(frames, [&] { updateColumnDebris(columns, kernels, DELTA_TIME); });
+        report(std::string("Colonnes ") + EntityKernels::GetLevelName(level), asteroids, ships, debris, reference);
+
+        if (level == SimdLevel::Scalar)
+        {
+            scalarResult = columns;
+            // Même nombre de frames sur l'ancienne disposition pour comparer les valeurs
+            for (int f = 0; f < frames * 5; f++)
+            {
+                updateLegacyAsteroids(legacy, DELTA_TIME);
+                updateLegacySpaceships(legacy, DELTA_TIME);
+                updateLegacyDebris(legacy, DELTA_TIME);
+            }
+            legacyError = maxLegacyError(legacy, columns);
+        }
+        else
+        {
+            identical = identical && sameColumns(scalarResult, columns);
+        }
+    }
+
+    std::cout << std::endl << "Niveaux SIMD identiques au scalaire : " << (identical ? "oui" : "NON") << std::endl;
+    std::cout << "Écart maximal avec l'ancienne boucle : " << std::scientific << std::setprecision(2) << legacyError
+              << std::endl;
+    return identical ? 0 : 1;
+}
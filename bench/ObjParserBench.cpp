@@ -0,0 +1,123 @@
+// Compare ObjParser et tinyobj::LoadObj sur les modèles OBJ du dossier models/
+// Usage : ObjParserBench [dossier_modeles] [iterations] [threads]
+
+#include "ObjParser.h"
+#include "tiny_obj_loader.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace
+{
+    struct LoadResult
+    {
+        tinyobj::attrib_t attrib;
+        std::vector<tinyobj::shape_t> shapes;
+        std::vector<tinyobj::material_t> materials;
+        std::string warn, err;
+        bool ok = false;
+    };
+
+    template <typename T>
+    bool sameBytes(const std::vector<T> &a, const std::vector<T> &b)
+    {
+        return a.size() == b.size() && (a.empty() || std::memcmp(a.data(), b.data(), a.size() * sizeof(T)) == 0);
+    }
+
+    bool sameResult(const LoadResult &a, const LoadResult &b)
+    {
+        if (a.ok != b.ok || a.warn != b.warn || a.err != b.err)
+            return false;
+        if (!sameBytes(a.attrib.vertices, b.attrib.vertices) || !sameBytes(a.attrib.vertex_weights, b.attrib.vertex_weights) ||
+            !sameBytes(a.attrib.normals, b.attrib.normals) || !sameBytes(a.attrib.texcoords, b.attrib.texcoords) ||
+            !sameBytes(a.attrib.colors, b.attrib.colors))
+            return false;
+        if (a.shapes.size() != b.shapes.size() || a.materials.size() != b.materials.size())
+            return false;
+        for (size_t i = 0; i < a.shapes.size(); i++)
+        {
+            const tinyobj::mesh_t &ma = a.shapes[i].mesh;
+            const tinyobj::mesh_t &mb = b.shapes[i].mesh;
+            if (a.shapes[i].name != b.shapes[i].name || !sameBytes(ma.indices, mb.indices) ||
+                ma.num_face_vertices != mb.num_face_vertices || ma.material_ids != mb.material_ids ||
+                ma.smoothing_group_ids != mb.smoothing_group_ids)
+                return false;
+        }
+        for (size_t i = 0; i < a.materials.size(); i++)
+        {
+            if (a.materials[i].name != b.materials[i].name)
+                return false;
+        }
+        return true;
+    }
+
+    template <typename LoadFn>
+    double timeLoads(int iterations, LoadResult &result, LoadFn load)
+    {
+        double best = 1e30;
+        for (int i = 0; i < iterations; i++)
+        {
+            result = LoadResult();
+            auto start = std::chrono::steady_clock::now();
+            result.ok = load(result);
+            double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+            best = std::min(best, ms);
+        }
+        return best;
+    }
+}
+
+int main(int argc, char **argv)
+{
+    std::string directory = argc > 1 ? argv[1] : "../models";
+    int iterations = argc > 2 ? std::max(1, std::atoi(argv[2])) : 5;
+    unsigned threads = argc > 3 ? static_cast<unsigned>(std::max(0, std::atoi(argv[3]))) : 0;
+
+    std::vector<std::string> paths;
+    std::error_code ec;
+    for (const auto &entry : std::filesystem::directory_iterator(directory, ec))
+    {
+        if (entry.path().extension() == ".obj")
+            paths.push_back(entry.path().string());
+    }
+    std::sort(paths.begin(), paths.end());
+    if (paths.empty())
+    {
+        std::cerr << "Aucun fichier .obj dans " << directory << std::endl;
+        return 1;
+    }
+
+    std::cout << std::left << std::setw(32) << "Modèle" << std::right << std::setw(12) << "tinyobj"
+              << std::setw(12) << "ObjParser" << std::setw(10) << "Gain" << "  Identique" << std::endl;
+
+    bool allIdentical = true;
+    for (const std::string &path : paths)
+    {
+        std::string baseDir = std::filesystem::path(path).parent_path().string() + "/";
+
+        LoadResult reference, parallel;
+        double tinyMs = timeLoads(iterations, reference, [&](LoadResult &r)
+                                  { return tinyobj::LoadObj(&r.attrib, &r.shapes, &r.materials, &r.warn, &r.err,
+                                                            path.c_str(), baseDir.c_str(), true); });
+        double parallelMs = timeLoads(iterations, parallel, [&](LoadResult &r)
+                                      { return ObjParser::Load(path, baseDir, &r.attrib, &r.shapes, &r.materials,
+                                                               &r.warn, &r.err, threads); });
+
+        bool identical = sameResult(reference, parallel);
+        allIdentical = allIdentical && identical;
+
+        std::cout << std::left << std::setw(32) << std::filesystem::path(path).filename().string() << std::right
+                  << std::fixed << std::setprecision(2) << std::setw(10) << tinyMs << "ms" << std::setw(10)
+                  << parallelMs << "ms" << std::setw(9) << tinyMs / parallelMs << "x"
+                  << (identical ? "  oui" : "  NON") << std::endl;
+    }
+
+    return allIdentical ? 0 : 1;
+}
@@ -0,0 +1,101 @@
+// Coût d'une mise à jour d'uniform : glGetUniformLocation à chaque appel (ancien Shader::set*),
+// recherche dans la table réfléchie (nom haché à l'exécution ou à la compilation) et UniformHandle
+// Usage : UniformBench [iterations] (depuis le dossier build/, comme ProjetOpenGL)
+
+#include <GL/glew.h>
+#include <GLFW/glfw3.h>
+
+#include "Shader.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+namespace
+{
+    // Ancienne implémentation de Shader::setVec3, pour comparaison
+    void legacySetVec3(const Shader &shader, const std::string &name, const glm::vec3 &value)
+    {
+        glUniform3fv(glGetUniformLocation(shader.ID, name.c_str()), 1, &value[0]);
+    }
+
+    // Meilleur temps par appel (ns) sur quelques répétitions
+    template <typename SetFn>
+    double timeSets(int iterations, SetFn set)
+    {
+        double best = 1e30;
+        for (int repeat = 0; repeat < 5; repeat++)
+        {
+            auto start = std::chrono::steady_clock::now();
+            for (int i = 0; i < iterations; i++)
+                set(glm::vec3(static_cast<float>(i & 255) / 255.0f));
+            glFinish();
+            double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+            best = std::min(best, ns / iterations);
+        }
+        return best;
+    }
+
+    void report(const char *label, double ns, double reference)
+    {
+        std::cout << std::fixed << std::setprecision(1) << std::setw(8) << ns << " ns" << std::setw(7)
+                  << reference / ns << "x  " << label << std::endl;
+    }
+}
+
+int main(int argc, char **argv)
+{
+    int iterations = argc > 1 ? std::max(1, std::atoi(argv[1])) : 200000;
+
+    // Contexte OpenGL invisible
+    if (!glfwInit())
+    {
+        std::cerr << "Erreur : échec de l'initialisation de GLFW" << std::endl;
+        return 1;
+    }
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+    glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+    glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+    GLFWwindow *window = glfwCreateWindow(64, 64, "UniformBench", nullptr, nullptr);
+    if (!window)
+    {
+        std::cerr << "Erreur : impossible de créer le contexte OpenGL" << std::endl;
+        glfwTerminate();
+        return 1;
+    }
+    glfwMakeContextCurrent(window);
+    if (glewInit() != GLEW_OK)
+    {
+        std::cerr << "Erreur : échec de l'initialisation de GLEW" << std::endl;
+        glfwTerminate();
+        return 1;
+    }
+
+    {
+        Shader shader("../shaders/phong.vert", "../shaders/phong.frag");
+        shader.use();
+        std::cout << "Uniforms actifs relevés : " << shader.GetUniformCount() << std::endl;
+
+        static constexpr UniformName OBJECT_COLOR("objectColor");
+        UniformHandle<glm::vec3> handle = shader.GetUniform<glm::vec3>(OBJECT_COLOR);
+        std::string runtimeName = "objectColor";
+
+        double legacy = timeSets(iterations, [&](const glm::vec3 &v) { legacySetVec3(shader, "objectColor", v); });
+        double hashedRuntime = timeSets(iterations, [&](const glm::vec3 &v) { shader.setVec3(runtimeName, v); });
+        double hashedConst = timeSets(iterations, [&](const glm::vec3 &v) { shader.setVec3(OBJECT_COLOR, v); });
+        double handleSet = timeSets(iterations, [&](const glm::vec3 &v) { shader.set(handle, v); });
+
+        std::cout << iterations << " mises à jour de objectColor par mesure" << std::endl;
+        report("glGetUniformLocation + std::string", legacy, legacy);
+        report("table, nom haché à l'exécution", hashedRuntime, legacy);
+        report("table, nom haché à la compilation", hashedConst, legacy);
+        report("UniformHandle", handleSet, legacy);
+    }
+
+    glfwTerminate();
+    return 0;
+}
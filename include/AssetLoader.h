@@ -0,0 +1,107 @@
+#ifndef ASSET_LOADER_H
+#define ASSET_LOADER_H
+
+#include <atomic>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include "ThreadPool.h"
+
+/**
+ * @brief Service de chargement asynchrone des ressources (modèles, textures, skybox)
+ *
+ * Les lectures de fichiers et le décodage sont exécutés sur un pool de threads ;
+ * chaque tâche renvoie un envoi GPU qui est appliqué plus tard sur le thread
+ * OpenGL par ProcessUploads(), dans la limite d'un budget par frame (octets et
+ * millisecondes). Tant que l'envoi n'a pas eu lieu, la ressource reste dans
+ * son état "en chargement" et affiche un substitut.
+ *
+ * Si le service n'est pas initialisé, les tâches sont exécutées immédiatement
+ * sur le thread appelant (chargement bloquant, comme avant).
+ */
+class AssetLoader {
+public:
+    /**
+     * @brief Données décodées à envoyer au GPU sur le thread OpenGL
+     */
+    struct Upload {
+        size_t bytes = 0;            ///< Taille envoyée, pour le budget
+        std::function<void()> apply; ///< Appels OpenGL (thread principal uniquement)
+    };
+
+    /**
+     * @brief Tâche de décodage exécutée sur un thread de travail (aucun appel OpenGL)
+     */
+    using DecodeJob = std::function<Upload()>;
+
+    static AssetLoader& getInstance();
+
+    /**
+     * @brief Démarre les threads de travail
+     * @param workerCount Nombre de threads, 0 pour un choix automatique
+     * @return true si l'initialisation réussit
+     */
+    bool Initialize(unsigned int workerCount = 0);
+
+    /**
+     * @brief Arrête les threads ; les envois non appliqués sont abandonnés
+     */
+    void Shutdown();
+
+    bool IsInitialized() const { return pool != nullptr; }
+
+    /**
+     * @brief Soumet une tâche de décodage
+     */
+    void Submit(DecodeJob job);
+
+    /**
+     * @brief Exécute body(i) pour i dans [0, count) sur les threads de chargement
+     *
+     * Utilisable depuis une tâche de décodage (le thread appelant participe).
+     * Sans threads, la boucle est exécutée séquentiellement.
+     */
+    void ParallelFor(size_t count, const std::function<void(size_t)>& body);
+
+    /**
+     * @brief Fixe le budget d'envoi GPU par frame
+     * @param bytesPerFrame Octets maximum envoyés par frame (un envoi plus gros passe seul)
+     * @param msPerFrame Temps maximum passé dans ProcessUploads
+     */
+    void SetUploadBudget(size_t bytesPerFrame, double msPerFrame);
+
+    /**
+     * @brief Applique les envois prêts dans la limite du budget (à appeler à chaque frame)
+     * @return Nombre d'envois appliqués
+     */
+    size_t ProcessUploads();
+
+    /**
+     * @brief Bloque jusqu'à ce que toutes les tâches soumises soient appliquées
+     */
+    void Flush();
+
+    size_t GetPendingCount() const { return pendingCount.load(); }
+    size_t GetLastFrameBytes() const { return lastFrameBytes; }
+    double GetLastFrameMs() const { return lastFrameMs; }
+
+private:
+    AssetLoader() = default;
+    ~AssetLoader() = default;
+    AssetLoader(const AssetLoader&) = delete;
+    AssetLoader& operator=(const AssetLoader&) = delete;
+
+    std::unique_ptr<ThreadPool> pool;
+    std::mutex readyMutex;
+    std::deque<Upload> readyUploads;
+    std::atomic<size_t> pendingCount{0};
+
+    size_t budgetBytes = 8 * 1024 * 1024;
+    double budgetMs = 2.0;
+    size_t lastFrameBytes = 0;
+    double lastFrameMs = 0.0;
+};
+
+#endif // ASSET_LOADER_H
@@ -0,0 +1,91 @@
+#ifndef BOUNDS_H
+#define BOUNDS_H
+
+#include <glm/glm.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief Boîte englobante alignée sur les axes
+ */
+struct AABB {
+    glm::vec3 min = glm::vec3(0.0f);
+    glm::vec3 max = glm::vec3(0.0f);
+
+    glm::vec3 GetCenter() const { return (min + max) * 0.5f; }
+    glm::vec3 GetExtents() const { return (max - min) * 0.5f; }
+};
+
+/**
+ * @brief Sphère englobante
+ */
+struct BoundingSphere {
+    glm::vec3 center = glm::vec3(0.0f);
+    float radius = 0.0f;
+
+    /**
+     * @brief Sphère dans le repère d'arrivée d'une transformation affine
+     *
+     * Le rayon est multiplié par la plus grande échelle de la matrice, ce qui
+     * reste conservateur pour les échelles non uniformes.
+     */
+    BoundingSphere Transformed(const glm::mat4& transform) const;
+};
+
+/**
+ * @brief Les six plans d'un frustum, normales tournées vers l'intérieur
+ *
+ * Plans extraits des lignes d'une matrice vue-projection (méthode de Gribb et
+ * Hartmann) puis normalisés : a*x + b*y + c*z + d est la distance signée.
+ */
+struct Frustum {
+    static const int PLANE_COUNT = 6; // Gauche, droite, bas, haut, proche, lointain
+    glm::vec4 planes[PLANE_COUNT];
+
+    static Frustum FromMatrix(const glm::mat4& viewProjection);
+
+    bool Intersects(const BoundingSphere& sphere) const;
+    bool Intersects(const AABB& box) const;
+};
+
+/**
+ * @brief Test de visibilité par lots contre un frustum
+ *
+ * Les sphères monde sont rangées en structure de tableaux (x, y, z, rayon) et
+ * testées sans branchement contre les six plans : la boucle de Run est
+ * vectorisable par le compilateur. Les scènes ajoutent les sphères de leurs
+ * objets, lancent le test puis ne soumettent que les objets visibles (les
+ * indices de Add suivent l'ordre d'ajout).
+ */
+class CullingBatch {
+public:
+    void Clear();
+    void Reserve(size_t count);
+
+    /**
+     * @brief Ajoute une sphère monde
+     * @return Index de la sphère, pour IsVisible
+     */
+    size_t Add(const BoundingSphere& sphere);
+
+    /**
+     * @brief Teste toutes les sphères ajoutées
+     * @return Nombre de sphères visibles
+     */
+    size_t Run(const Frustum& frustum);
+
+    bool IsVisible(size_t index) const { return visible[index] != 0; }
+    size_t GetCount() const { return xs.size(); }
+    size_t GetVisibleCount() const { return visibleCount; }
+
+private:
+    std::vector<float> xs;
+    std::vector<float> ys;
+    std::vector<float> zs;
+    std::vector<float> radii;
+    std::vector<uint8_t> visible;
+    size_t visibleCount = 0;
+};
+
+#endif // BOUNDS_H
@@ -4,6 +4,7 @@
 #include <GL/glew.h>
 #include <glm/glm.hpp>
 #include <glm/gtc/matrix_transform.hpp>
+#include "Bounds.h"
 
 // Définir les directions de mouvement possibles
 enum Camera_Movement
@@ -50,6 +51,9 @@ public:
     // Retourner la matrice View
     glm::mat4 GetViewMatrix() const;
 
+    // Plans du frustum extraits de projection * vue courante (pour le culling)
+    Frustum GetFrustum(const glm::mat4 &projection) const;
+
     // Gérer l'input clavier
     void ProcessKeyboard(Camera_Movement direction, float deltaTime);
 
@@ -0,0 +1,60 @@
+#ifndef ENTITY_KERNELS_H
+#define ENTITY_KERNELS_H
+
+#include <cstddef>
+
+/**
+ * @brief Jeu d'instructions utilisé par les noyaux de EntityKernels
+ */
+enum class SimdLevel {
+    Scalar,
+    SSE2,
+    AVX2
+};
+
+/**
+ * @brief Noyaux de mise à jour des colonnes d'entités (structure-of-arrays)
+ *
+ * Les scènes rangent l'état animé de leurs objets par colonnes (angles,
+ * vitesses, phases, positions...) plutôt qu'en tableaux de structures : chaque
+ * noyau parcourt une ou deux colonnes contiguës et traite 4 (SSE2) ou 8 (AVX2)
+ * flottants par instruction. Une colonne de glm::vec3 se traite comme une
+ * colonne de 3 * n flottants.
+ *
+ * Le jeu d'instructions est choisi à l'exécution d'après le CPU (Get), si bien
+ * que l'exécutable reste compilé pour la cible de base. Toutes les variantes
+ * font les mêmes opérations flottantes, sans FMA : résultats identiques au bit
+ * près, quel que soit le niveau.
+ */
+struct EntityKernels {
+    // values[i] += rates[i] * dt
+    void (*integrate)(float* values, const float* rates, size_t count, float dt);
+
+    // values[i] += rates[i] * dt, puis values[i] -= period si values[i] > period
+    void (*integrateWrapped)(float* values, const float* rates, size_t count, float dt, float period);
+
+    // values[i] += step
+    void (*add)(float* values, size_t count, float step);
+
+    // values[i] += step, puis values[i] -= period si values[i] > period
+    void (*addWrapped)(float* values, size_t count, float step, float period);
+
+    SimdLevel level;
+
+    /**
+     * @brief Noyaux du meilleur niveau disponible, détecté au premier appel
+     */
+    static const EntityKernels& Get();
+
+    /**
+     * @brief Noyaux d'un niveau donné (benchmarks), ramené au niveau disponible
+     */
+    static const EntityKernels& Get(SimdLevel level);
+
+    // Meilleur niveau supporté par le CPU et le système
+    static SimdLevel DetectLevel();
+
+    static const char* GetLevelName(SimdLevel level);
+};
+
+#endif // ENTITY_KERNELS_H
@@ -0,0 +1,153 @@
+#ifndef GEOMETRY_BUFFER_H
+#define GEOMETRY_BUFFER_H
+
+#include <GL/glew.h>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+enum class VertexFormat; // Mesh.h
+class InstanceBuffer;
+
+/**
+ * @brief Commande de tirage indexé, disposition imposée par glMultiDrawElementsIndirect
+ */
+struct DrawElementsIndirectCommand {
+    GLuint count;         // Nombre d'indices
+    GLuint instanceCount;
+    GLuint firstIndex;    // En indices depuis le début de l'index buffer partagé
+    GLint baseVertex;     // En sommets du format du mesh
+    GLuint baseInstance;  // Première instance lue dans l'InstanceBuffer
+};
+
+/**
+ * @brief Plage de sommets et d'indices allouée dans le GeometryBuffer
+ *
+ * Rendue au GeometryBuffer à sa destruction ; déplaçable mais pas copiable,
+ * si bien qu'un Mesh possède sa plage comme il possédait ses buffers.
+ */
+struct GeometryRange {
+    size_t vertexOffset = 0;  // Octets depuis le début du vertex buffer partagé
+    size_t vertexBytes = 0;
+    size_t firstIndex = 0;
+    size_t indexCount = 0;
+    GLint baseVertex = 0;     // vertexOffset / taille d'un sommet
+    bool allocated = false;
+
+    GeometryRange() = default;
+    ~GeometryRange();
+    GeometryRange(GeometryRange&& other) noexcept;
+    GeometryRange& operator=(GeometryRange&& other) noexcept;
+    GeometryRange(const GeometryRange&) = delete;
+    GeometryRange& operator=(const GeometryRange&) = delete;
+};
+
+/**
+ * @brief Vertex buffer et index buffer partagés par toute la géométrie statique
+ *
+ * Chaque Mesh (sous-meshes et LOD des modèles, sphères) reçoit une plage des
+ * deux buffers au lieu de ses propres VBO/EBO. Un seul VAO par VertexFormat
+ * pointe sur le vertex buffer partagé : les tirages d'un même format ne
+ * changent plus de VAO et se regroupent en commandes indirectes, exécutées en
+ * un appel par glMultiDrawElementsIndirect (GL 4.3 ou ARB_multi_draw_indirect).
+ * Sans lui, les tirages non instanciés passent par glMultiDrawElementsBaseVertex
+ * (GL 3.2) et les tirages instanciés par un glDrawElementsInstancedBaseVertex
+ * par commande.
+ *
+ * Les plages libérées sont réutilisées (premier bloc libre suffisant, blocs
+ * voisins fusionnés) ; un buffer plein est remplacé par un buffer deux fois
+ * plus grand, ce qui ne change ni les décalages ni les baseVertex existants.
+ * Les décalages de sommets sont alignés sur VERTEX_ALIGNMENT octets, multiple
+ * de la taille de chaque format. À utiliser depuis le thread OpenGL uniquement.
+ */
+class GeometryBuffer {
+public:
+    static const int FORMAT_COUNT = 3;             // Valeurs de VertexFormat
+    static const size_t VERTEX_ALIGNMENT = 32;     // sizeof(Vertex), multiple de sizeof(PackedVertex)
+
+    static GeometryBuffer& getInstance();
+
+    /**
+     * @brief Alloue une plage et y copie sommets et indices
+     * @param stride Taille d'un sommet (doit diviser VERTEX_ALIGNMENT)
+     * @param indexData Indices relatifs au premier sommet de la plage
+     */
+    GeometryRange Allocate(const void* vertexData, size_t vertexCount, size_t stride,
+                           const unsigned int* indexData, size_t indexCount);
+
+    /**
+     * @brief VAO partagé des meshes d'un format (créé au premier appel)
+     */
+    GLuint GetVertexArray(VertexFormat format);
+
+    /**
+     * @brief Exécute des commandes de tirage, VAO du format déjà lié
+     * @param instances Attributs d'instance lus à partir de baseInstance, nullptr pour
+     *                  des commandes non instanciées (instanceCount = 1, baseInstance = 0)
+     */
+    void Draw(const DrawElementsIndirectCommand* commands, size_t count, const InstanceBuffer* instances = nullptr);
+
+    /**
+     * @brief Exécute count commandes lues dans un buffer GPU (écrit par exemple par un compute shader)
+     *
+     * Requiert IsIndirectSupported ; VAO du format déjà lié.
+     */
+    void DrawIndirect(GLuint commandBuffer, size_t count, const InstanceBuffer* instances = nullptr);
+
+    // glMultiDrawElementsIndirect utilisable (baseInstance compris)
+    bool IsIndirectSupported() const;
+
+    /**
+     * @brief Libère les objets OpenGL (avant la destruction du contexte)
+     */
+    void Cleanup();
+
+    size_t GetVertexBytes() const { return vertexSpace.used; }
+    size_t GetVertexCapacity() const { return vertexSpace.capacity; }
+    size_t GetIndexBytes() const { return indexSpace.used * sizeof(unsigned int); }
+    size_t GetIndexCapacity() const { return indexSpace.capacity * sizeof(unsigned int); }
+    size_t GetRangeCount() const { return rangeCount; }
+
+private:
+    friend struct GeometryRange;
+
+    GeometryBuffer() = default;
+    ~GeometryBuffer() = default;
+    GeometryBuffer(const GeometryBuffer&) = delete;
+    GeometryBuffer& operator=(const GeometryBuffer&) = delete;
+
+    // Blocs libres d'un buffer, triés par décalage (unité : octets ou indices)
+    struct FreeList {
+        struct Block {
+            size_t offset;
+            size_t size;
+        };
+        std::vector<Block> blocks;
+        size_t capacity = 0;
+        size_t used = 0;
+
+        bool Allocate(size_t size, size_t alignment, size_t& offset);
+        void Free(size_t offset, size_t size);
+        void Grow(size_t newCapacity);
+    };
+
+    void Free(GeometryRange& range);
+    void Reserve(GLuint& buffer, FreeList& space, size_t unitSize, size_t required);
+    void SetupVertexArray(int format);
+
+    GLuint vertexBuffer = 0;
+    GLuint indexBuffer = 0;
+    GLuint indirectBuffer = 0;
+    size_t indirectCapacity = 0;
+    GLuint vertexArrays[FORMAT_COUNT] = {};
+    FreeList vertexSpace;  // En octets
+    FreeList indexSpace;   // En indices
+    size_t rangeCount = 0;
+
+    // Tableaux de glMultiDrawElementsBaseVertex, réutilisés d'un appel à l'autre
+    std::vector<GLsizei> counts;
+    std::vector<const void*> offsets;
+    std::vector<GLint> baseVertices;
+};
+
+#endif // GEOMETRY_BUFFER_H
@@ -0,0 +1,89 @@
+#ifndef GPU_CULLER_H
+#define GPU_CULLER_H
+
+#include <GL/glew.h>
+#include <glm/glm.hpp>
+#include <cstddef>
+#include <vector>
+#include "Bounds.h"
+#include "GeometryBuffer.h"
+#include "InstanceBuffer.h"
+
+class Model;
+class Shader;
+
+/**
+ * @brief Culling et choix du LOD d'une population d'instances par compute shader
+ *
+ * La scène envoie les transformations de toutes les instances ; le compute
+ * shader cull_instances.comp teste la sphère englobante de chacune contre le
+ * frustum, choisit son LOD comme Model::SelectLod (le LOD précédent, qui sert
+ * d'hystérésis, reste sur le GPU) puis la range dans la région de ce LOD du
+ * buffer de sortie en incrémentant le instanceCount de ses commandes
+ * indirectes. Le tirage lit ces commandes sans retour au CPU : aucun travail
+ * de visibilité par objet n'est fait côté CPU.
+ *
+ * Le nombre d'instances visibles n'est relu que pour l'interface, sans
+ * attente : les commandes de chaque tirage sont copiées côté GPU dans un
+ * anneau de READBACK_COUNT buffers, lus dès que leur fence est signalée
+ * (quelques frames de retard quand le GPU est en retard sur le CPU).
+ * Requiert GL 4.3 (IsSupported) ; sinon les scènes gardent le CullingBatch.
+ */
+class GpuCuller {
+public:
+    // Compute shaders, SSBO et glMultiDrawElementsIndirect disponibles
+    static bool IsSupported();
+
+    GpuCuller() = default;
+    ~GpuCuller();
+
+    GpuCuller(const GpuCuller&) = delete;
+    GpuCuller& operator=(const GpuCuller&) = delete;
+
+    /**
+     * @brief Lance le culling de count instances
+     * @param program Programme cull_instances.comp (ShaderManager::GetCullInstancesShader)
+     * @param lodPixelScale Voir Model::GetLodPixelScale
+     */
+    void Cull(const Shader& program, const Model& model, const InstanceData* instances, size_t count,
+              const Frustum& frustum, const glm::vec3& cameraPosition, float lodPixelScale);
+
+    /**
+     * @brief Dessine les instances retenues par le dernier Cull (shader *_instanced déjà utilisé)
+     */
+    void Draw(const Model& model, const Shader& shader);
+
+    // Instances visibles lors du dernier résultat relu
+    size_t GetVisibleCount() const { return visibleCount; }
+
+private:
+    static constexpr size_t MAX_LODS = 8;      // Taille de lodErrors dans CullParams
+    static constexpr GLuint WORKGROUP_SIZE = 64; // local_size_x de cull_instances.comp
+    static constexpr size_t READBACK_COUNT = 3;  // Relectures en vol : le GPU a souvent 1 à 2 frames de retard
+
+    // Copie des commandes d'un tirage, lisible sans attente une fois fence signalée
+    struct Readback {
+        GLuint buffer = 0;
+        size_t commandCount = 0;
+        size_t commandsPerLod = 0;
+        GLsync fence = nullptr;  // nullptr : emplacement libre
+    };
+
+    void ReadBackVisibleCount();
+    void QueueReadback();
+
+    GLuint inputBuffer = 0;    // InstanceData de toutes les instances
+    GLuint lodBuffer = 0;      // LOD de la frame précédente, par instance
+    GLuint commandBuffer = 0;  // Commandes indirectes, instanceCount écrits par le compute shader
+    GLuint paramsBuffer = 0;   // Bloc CullParams
+    InstanceBuffer outputInstances;
+    size_t capacity = 0;       // Instances par région de LOD (et taille de inputBuffer/lodBuffer)
+
+    std::vector<DrawElementsIndirectCommand> commands;
+    size_t commandsPerLod = 0;
+    size_t visibleCount = 0;
+    Readback readbacks[READBACK_COUNT];
+    size_t nextReadback = 0;   // Prochain emplacement à armer ; le plus ancien en vol quand l'anneau est plein
+};
+
+#endif // GPU_CULLER_H
@@ -0,0 +1,36 @@
+#ifndef HASH_H
+#define HASH_H
+
+#include <cstddef>
+#include <cstdint>
+
+// Fonctions de hachage FNV-1a (utilisées pour les caches disque et les noms d'uniforms)
+namespace Hash {
+
+    constexpr uint64_t FNV64_OFFSET = 14695981039346656037ull;
+    constexpr uint64_t FNV64_PRIME = 1099511628211ull;
+
+    // Hachage 64 bits d'un bloc d'octets ; seed permet d'enchaîner plusieurs blocs
+    inline uint64_t Fnv1a64(const void* data, size_t size, uint64_t seed = FNV64_OFFSET) {
+        const unsigned char* bytes = static_cast<const unsigned char*>(data);
+        uint64_t hash = seed;
+        for (size_t i = 0; i < size; ++i) {
+            hash ^= bytes[i];
+            hash *= FNV64_PRIME;
+        }
+        return hash;
+    }
+
+    // Même hachage pour une chaîne terminée par zéro, évaluable à la compilation
+    constexpr uint64_t Fnv1a64String(const char* text, uint64_t seed = FNV64_OFFSET) {
+        uint64_t hash = seed;
+        for (; *text != '\0'; ++text) {
+            hash ^= static_cast<unsigned char>(*text);
+            hash *= FNV64_PRIME;
+        }
+        return hash;
+    }
+
+} // namespace Hash
+
+#endif // HASH_H
@@ -0,0 +1,69 @@
+#ifndef INSTANCE_BUFFER_H
+#define INSTANCE_BUFFER_H
+
+#include <GL/glew.h>
+#include <glm/glm.hpp>
+#include <cstddef>
+
+/**
+ * @brief Attributs d'une instance pour le rendu instancié
+ *
+ * Lus par les shaders *_instanced.vert aux locations 3 à 6 (colonnes de la
+ * matrice) et 7 (couleur), avec un diviseur de 1.
+ */
+struct InstanceData {
+    glm::mat4 model;
+    glm::vec4 color;
+};
+
+/**
+ * @brief Buffer de sommets contenant les attributs par instance
+ *
+ * Réécrit à chaque frame (orphelinage du buffer pour ne pas attendre le GPU) ;
+ * la capacité ne fait que croître. Le buffer OpenGL est créé au premier Update.
+ */
+class InstanceBuffer {
+public:
+    // Première location d'attribut utilisée (la matrice occupe 4 locations, puis la couleur)
+    static const GLuint FIRST_ATTRIBUTE = 3;
+
+    InstanceBuffer() = default;
+    ~InstanceBuffer();
+
+    InstanceBuffer(const InstanceBuffer&) = delete;
+    InstanceBuffer& operator=(const InstanceBuffer&) = delete;
+
+    /**
+     * @brief Remplace le contenu du buffer
+     * @param instances Tableau de count instances
+     */
+    void Update(const InstanceData* instances, size_t count);
+
+    /**
+     * @brief Réserve count instances écrites par le GPU (contenu indéfini)
+     *
+     * Contrairement à Update, le stockage n'est remplacé que s'il doit grandir.
+     */
+    void Allocate(size_t count);
+
+    /**
+     * @brief Lie le buffer aux attributs d'instance du VAO courant
+     * @param first Première instance lue (décalage dans le buffer)
+     */
+    void BindAttributes(size_t first) const;
+
+    /**
+     * @brief Désactive les attributs d'instance du VAO courant
+     */
+    static void UnbindAttributes();
+
+    size_t GetCount() const { return count; }
+    GLuint GetBuffer() const { return vbo; }
+
+private:
+    GLuint vbo = 0;
+    size_t capacity = 0;
+    size_t count = 0;
+};
+
+#endif // INSTANCE_BUFFER_H
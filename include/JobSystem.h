@@ -0,0 +1,119 @@
+#ifndef JOB_SYSTEM_H
+#define JOB_SYSTEM_H
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <initializer_list>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief Tâche planifiée par le JobSystem ; à manipuler via JobHandle
+ */
+struct Job {
+    std::function<void()> task;
+    std::atomic<int> pendingDependencies{0};       // Dépendances non terminées (+1 pendant Schedule)
+    std::atomic<bool> finished{false};
+    std::mutex mutex;                              // Protège continuations et le passage à finished
+    std::vector<std::shared_ptr<Job>> continuations; // Tâches qui attendent celle-ci
+};
+
+using JobHandle = std::shared_ptr<Job>;
+
+/**
+ * @brief Système de tâches du moteur, avec vol de travail
+ *
+ * Chaque thread de travail possède sa propre file : il y dépose les tâches
+ * qu'il crée et reprend la plus récente (LIFO, données encore en cache). Un
+ * thread sans travail vole la plus ancienne tâche d'une autre file (FIFO),
+ * en général la plus grosse. Les threads extérieurs (thread principal, thread
+ * de simulation) déposent dans une file partagée, volée de la même façon.
+ *
+ * Une tâche peut dépendre d'autres tâches : elle n'entre dans une file
+ * qu'une fois toutes ses dépendances terminées. Wait et ParallelFor font
+ * travailler le thread appelant au lieu de le bloquer, ce qui permet de les
+ * appeler depuis une tâche.
+ *
+ * Les tâches ne doivent faire aucun appel OpenGL : le contexte n'est courant
+ * que sur le thread principal.
+ */
+class JobSystem {
+public:
+    static JobSystem& getInstance();
+
+    /**
+     * @brief Threads extérieurs occupés en permanence, qui travaillent aussi dans Wait
+     * @param count 1 (thread principal) par défaut, 2 avec SimulationThread
+     *
+     * Un cœur est laissé à chacun : les threads de travail sont créés sur les
+     * autres. Sans effet une fois getInstance appelé.
+     */
+    static void ReserveExternalThreads(unsigned int count);
+
+    /**
+     * @brief Planifie une tâche, exécutée après toutes ses dépendances
+     * @param dependencies Tâches à terminer avant (les handles vides sont ignorés)
+     */
+    JobHandle Schedule(std::function<void()> task, std::initializer_list<JobHandle> dependencies = {});
+
+    /**
+     * @brief Attend la fin d'une tâche en exécutant d'autres tâches en attendant
+     */
+    void Wait(const JobHandle& job);
+    void Wait(std::initializer_list<JobHandle> jobs);
+
+    /**
+     * @brief Exécute body(begin, end) sur des tranches de [0, count) en parallèle
+     * @param chunkSize Taille des tranches, 0 pour la choisir d'après le nombre de threads
+     *
+     * Le thread appelant traite lui aussi des tranches et ne revient qu'une
+     * fois toutes terminées.
+     */
+    void ParallelFor(size_t count, size_t chunkSize, const std::function<void(size_t, size_t)>& body);
+
+    /**
+     * @brief Arrête les threads (tâches en file abandonnées) ; appelé aussi par le destructeur
+     */
+    void Shutdown();
+
+    unsigned int GetWorkerCount() const { return static_cast<unsigned int>(workers.size()); }
+
+    // Tâches exécutées et volées depuis le démarrage
+    size_t GetExecutedCount() const { return executedCount.load(); }
+    size_t GetStolenCount() const { return stolenCount.load(); }
+
+private:
+    JobSystem();
+    ~JobSystem();
+    JobSystem(const JobSystem&) = delete;
+    JobSystem& operator=(const JobSystem&) = delete;
+
+    // File d'un thread : le propriétaire prend à l'arrière, les voleurs à l'avant
+    struct WorkQueue {
+        std::mutex mutex;
+        std::deque<JobHandle> jobs;
+    };
+
+    void WorkerLoop(size_t index);
+    void Push(JobHandle job);
+    JobHandle FindJob();
+    void Execute(const JobHandle& job);
+    size_t CurrentQueue() const;
+
+    std::vector<std::thread> workers;
+    std::vector<std::unique_ptr<WorkQueue>> queues; // Une par thread de travail, plus la file partagée
+    std::atomic<size_t> queuedJobs{0};
+    std::atomic<size_t> executedCount{0};
+    std::atomic<size_t> stolenCount{0};
+
+    std::mutex sleepMutex;
+    std::condition_variable jobAvailable;  // Réveille les threads de travail
+    std::condition_variable jobFinished;   // Réveille les threads dans Wait (tâche terminée ou mise en file)
+    bool stopping = false;
+};
+
+#endif // JOB_SYSTEM_H
@@ -3,8 +3,16 @@
 
 #include "Scene.h"
 #include "Shader.h"
+#include "Bounds.h"
+#include "LooseOctree.h"
 #include "Sphere.h"
 #include "Model.h"
+#include "InstanceBuffer.h"
+#include "GpuCuller.h"
+#include "ParticleRenderer.h"
+#include "TrailRenderer.h"
+#include "Random.h"
+#include "SnapshotBuffer.h"
 #include "Skybox.h"
 #include "SkyboxManager.h"
 #include <memory>
@@ -44,41 +52,42 @@ private:
     float sunRadius = 80.0f;
     glm::vec3 sunPosition = glm::vec3(0.0f, 0.0f, 0.0f);
     
-    // Anneau d'astéroïdes dense
+    // Anneau d'astéroïdes dense, et flotte et débris plus bas, rangés par colonnes
+    // (structure-of-arrays) : Simulate avance chaque colonne avec EntityKernels
     std::unique_ptr<Model> asteroidModel;
     static const int ASTEROID_COUNT = 120;
-    struct AsteroidData {
-        float angleOffset;
-        float radiusOffset;
-        float scale;
-        float rotationSpeed;
-        glm::vec3 rotationAxis;
-        glm::vec3 color;
-        float orbitSpeed;
-        float currentAngle;
+    struct AsteroidRing {
+        float angleOffset[ASTEROID_COUNT];
+        float radiusOffset[ASTEROID_COUNT];
+        float scale[ASTEROID_COUNT];
+        float rotationSpeed[ASTEROID_COUNT];
+        glm::vec3 rotationAxis[ASTEROID_COUNT];
+        glm::vec3 color[ASTEROID_COUNT];
+        float orbitSpeed[ASTEROID_COUNT];
+        float currentAngle[ASTEROID_COUNT];
+        size_t lod[ASTEROID_COUNT] = {}; // LOD de la frame précédente (hystérésis, rendu seulement)
     };
-    AsteroidData asteroids[ASTEROID_COUNT];
     
     // Flotte de vaisseaux spatiaux
     std::unique_ptr<Model> spaceshipModel;
     static const int SPACESHIP_COUNT = 50;
-    struct SpaceshipData {
-        glm::vec3 color;
-        float angleOffset;
-        float orbitRadius;
-        float orbitSpeed;
-        float currentAngle;
-        glm::vec3 randomOffset;
-        float randomPhase;
-        float heightFreq1, heightFreq2, heightFreq3;
-        float heightAmp1, heightAmp2, heightAmp3;
-        float heightPhase1, heightPhase2, heightPhase3;
-        float horizontalFreq1, horizontalFreq2;
-        float horizontalAmp1, horizontalAmp2;
-        float horizontalPhase1, horizontalPhase2;
-        float scale;
+    struct SpaceshipFleet {
+        glm::vec3 color[SPACESHIP_COUNT];
+        float angleOffset[SPACESHIP_COUNT];
+        float orbitRadius[SPACESHIP_COUNT];
+        float orbitSpeed[SPACESHIP_COUNT];
+        float currentAngle[SPACESHIP_COUNT];
+        glm::vec3 randomOffset[SPACESHIP_COUNT];
+        float randomPhase[SPACESHIP_COUNT];
+        float heightFreq1[SPACESHIP_COUNT], heightFreq2[SPACESHIP_COUNT], heightFreq3[SPACESHIP_COUNT];
+        float heightAmp1[SPACESHIP_COUNT], heightAmp2[SPACESHIP_COUNT], heightAmp3[SPACESHIP_COUNT];
+        float heightPhase1[SPACESHIP_COUNT], heightPhase2[SPACESHIP_COUNT], heightPhase3[SPACESHIP_COUNT];
+        float horizontalFreq1[SPACESHIP_COUNT], horizontalFreq2[SPACESHIP_COUNT];
+        float horizontalAmp1[SPACESHIP_COUNT], horizontalAmp2[SPACESHIP_COUNT];
+        float horizontalPhase1[SPACESHIP_COUNT], horizontalPhase2[SPACESHIP_COUNT];
+        float scale[SPACESHIP_COUNT];
+        size_t lod[SPACESHIP_COUNT] = {};
     };
-    SpaceshipData spaceships[SPACESHIP_COUNT];
     
     // Lune en orbite lointaine
     std::unique_ptr<Sphere> moonSphere;
@@ -86,7 +95,6 @@ private:
     float moonOrbitRadius = 400.0f;
     float moonOrbitSpeed = 0.3f;
     float moonSelfRotSpeed = 0.8f;
-    float moonCurrentAngle = 0.0f;
 
     // === Audio (mutualisé via SoundManager) ===
     std::shared_ptr<Sound> zooSound;
@@ -111,37 +119,59 @@ private:
         // Défenses tournantes
         float turretRotation;
         float turretSpeed;
+        size_t lod = 0;
     };
-    SpaceStation stations[STATION_COUNT];
     
     // Comètes avec traînées
     static const int COMET_COUNT = 15;
+    static const int COMET_TRAIL_CAPACITY = 64; // Échantillons réservés par traînée
     struct Comet {
         glm::vec3 position;
         glm::vec3 velocity;
-        float trailLength;
-        std::vector<glm::vec3> trailPositions;
+        float trailLength;                    // Échantillons conservés dans l'anneau de la traînée
         glm::vec3 color;
         float brightness;
         float pulseSpeed;
         float currentPhase;
         float size;
+        unsigned int generation = 0;          // Incrémenté à chaque respawn : la traînée repart de la tête
     };
-    std::vector<Comet> comets;
+    TrailRenderer cometTrails;                // Une traînée par comète, même indice, alimentée au rendu
+    uint64_t cometTrailStep = 0;              // Dernier pas de simulation figé dans les traînées
+    Random cometRandom;                       // Flux des comètes, repris aux respawns
     
     // Débris spatiaux en mouvement chaotique
     static const int DEBRIS_COUNT = 200;
-    struct SpaceDebris {
-        glm::vec3 position;
-        glm::vec3 velocity;
-        glm::vec3 angularVelocity;
-        glm::vec3 rotation;
-        float scale;
-        glm::vec3 color;
-        float lifetime;
-        float maxLifetime;
+    struct DebrisField {
+        std::vector<glm::vec3> position;
+        std::vector<glm::vec3> velocity;
+        std::vector<glm::vec3> angularVelocity;
+        std::vector<glm::vec3> rotation;
+        std::vector<float> scale;
+        std::vector<glm::vec3> color;
+        std::vector<float> lifetime;
+        std::vector<float> maxLifetime;
+        std::vector<size_t> lod;
+        
+        size_t size() const { return position.size(); }
+        void resize(size_t count);
     };
-    std::vector<SpaceDebris> debris;
+    Random debrisRandom;                      // Flux des débris, repris aux respawns
+    static const size_t DEBRIS_CHUNK_SIZE = 64;  // Débris par tâche de UpdateDebris
+    
+    // Rendu instancié de l'anneau et des débris (instances regroupées par LOD)
+    InstanceBuffer asteroidInstances;
+    InstanceBuffer debrisInstances;
+    std::vector<InstanceData> instanceData;   // Instances de la frame, dans l'ordre de la scène
+    std::vector<size_t> instanceLods;         // LOD de chaque instance
+    std::vector<InstanceData> sortedInstances; // Instances triées par LOD
+    
+    // Culling et LOD sur GPU (GL 4.3) des astéroïdes, débris et satellites : toutes les
+    // instances sont envoyées, CullingBatch, index spatial et SelectLod ne servent plus
+    GpuCuller asteroidCuller;
+    GpuCuller debrisCuller;
+    GpuCuller satelliteCuller;
+    bool gpuCulling = true;                   // Case de l'interface, ignorée sans compute shader
     
     // Portails énergétiques rotatifs
     static const int PORTAL_COUNT = 6;
@@ -156,10 +186,10 @@ private:
         float size;
         float energyFlow;
     };
-    EnergyPortal portals[PORTAL_COUNT];
     
     // Satellites en formation
     static const int SATELLITE_COUNT = 30;
+    static constexpr float SATELLITE_RADIUS = 1.5f;
     struct Satellite {
         glm::vec3 basePosition;
         float orbitRadius;
@@ -170,8 +200,9 @@ private:
         glm::vec3 color;
         bool isActive;
         float signalPulse;
+        size_t lod = 0;
     };
-    Satellite satellites[SATELLITE_COUNT];
+    Random satelliteRandom;                   // Flux des satellites, tiré à chaque pas
     
     // Nuages de particules énergétiques
     static const int PARTICLE_CLOUD_COUNT = 10;
@@ -186,14 +217,73 @@ private:
         std::vector<glm::vec3> particlePositions;
         std::vector<glm::vec3> particleVelocities;
     };
-    std::vector<ParticleCloud> particleClouds;
+    ParticleRenderer particleRenderer;        // Toutes les particules, en un seul appel
+    std::vector<glm::vec4> particleData;      // Position monde + rayon, reconstruit à chaque frame
+    
+    // État simulé de la scène. Simulate avance sim sur le thread de simulation et en publie un
+    // instantané à chaque pas ; au rendu, frame reçoit le mélange des deux derniers instantanés
+    // (colonnes animées seulement : le reste est fixé à l'initialisation, et les LOD de frame
+    // gardent leur hystérésis)
+    struct SimulationState {
+        uint64_t step = 0;                    // Pas effectués depuis l'initialisation
+        float globalTime = 0.0f;
+        float moonCurrentAngle = 0.0f;
+        AsteroidRing asteroids;
+        SpaceshipFleet spaceships;
+        SpaceStation stations[STATION_COUNT];
+        std::vector<Comet> comets;
+        DebrisField debris;
+        EnergyPortal portals[PORTAL_COUNT];
+        Satellite satellites[SATELLITE_COUNT];
+        std::vector<ParticleCloud> particleClouds;
+    };
+    SimulationState sim;                      // Thread de simulation uniquement
+    SimulationState frame;                    // Thread de rendu uniquement
+    SnapshotBuffer<SimulationState> snapshots;
+    
+    // Culling par frustum : chaque catégorie remplit cullBatch, teste, puis ne soumet que le visible
+    enum CullCategory {
+        CULL_BODIES,        // Soleil, lune, sphères de lumière et de test
+        CULL_ASTEROIDS,
+        CULL_SPACESHIPS,
+        CULL_STATIONS,
+        CULL_COMETS,        // Têtes (les traînées ne sont pas testées)
+        CULL_DEBRIS,
+        CULL_PORTALS,
+        CULL_SATELLITES,
+        CULL_PARTICLES,
+        CULL_CATEGORY_COUNT
+    };
+    struct CullCounts {
+        size_t visible = 0;
+        size_t total = 0;
+    };
+    Frustum frustum;                          // Frustum de la frame, calculé dans Render
+    CullingBatch cullBatch;
+    std::vector<DrawPacket> pendingPackets;   // Paquets en attente du test de visibilité
+    std::vector<size_t> pendingLods;          // LOD de chaque paquet en attente (modèles)
+    CullCounts cullCounts[CULL_CATEGORY_COUNT];
+    
+    // Index spatial des objets dynamiques (débris, satellites, stations, têtes de comètes) ;
+    // identifiant d'un objet : catégorie << 24 | index. Un index par thread : spatialIndex est
+    // reconstruit sur frame à chaque rendu, interactionIndex sur sim à chaque pas
+    LooseOctree spatialIndex;
+    std::vector<uint32_t> queryResults;
+    LooseOctree interactionIndex;
+    std::vector<uint32_t> interactionResults;
+    std::vector<size_t> visibleEntities[CULL_CATEGORY_COUNT]; // Résultat de la requête frustum, par catégorie
+    bool hasPickedEntity = false;             // Objet touché par le rayon central de la caméra
+    uint32_t pickedEntity = 0;
+    float pickedDistance = 0.0f;
     
     // Interactions dynamiques
-    float globalTime;
     bool attractionMode;
     bool repulsionMode;
     glm::vec3 attractionPoint;
     float attractionStrength;
+    // Accélération en dessous de laquelle la force est ignorée : fixe le rayon de la requête
+    // d'interaction (‖a‖ = strength / (d² + 1), soit environ 316 pour la force par défaut de 100)
+    static constexpr float ATTRACTION_MIN_ACCELERATION = 1e-3f;
     
     // === Méthodes privées ===
     bool LoadShaders();
@@ -206,10 +296,10 @@ private:
     bool LoadModels();
     void InitializeAsteroidRing();
     void InitializeSpaceships();
-    void RenderAsteroidRing(Camera& camera, int screenWidth, int screenHeight);
-    void RenderSpaceships(Camera& camera, int screenWidth, int screenHeight);
-    void RenderMoon(Camera& camera, int screenWidth, int screenHeight);
-    void RenderSun(Camera& camera, int screenWidth, int screenHeight);
+    void RenderAsteroidRing(Camera& camera, int screenHeight);
+    void RenderSpaceships(Camera& camera, int screenHeight);
+    void RenderMoon();
+    void RenderSun();
 
     // Nouvelles méthodes pour les éléments dynamiques
     void InitializeStations();
@@ -225,14 +315,62 @@ private:
     void UpdatePortals(float deltaTime);
     void UpdateSatellites(float deltaTime);
     void UpdateParticleClouds(float deltaTime);
+    void UpdateParticleCloud(ParticleCloud& cloud, float deltaTime);
     void UpdateInteractions(float deltaTime);
     
-    void RenderStations(Camera& camera, int screenWidth, int screenHeight);
-    void RenderComets(Camera& camera, int screenWidth, int screenHeight);
-    void RenderDebris(Camera& camera, int screenWidth, int screenHeight);
-    void RenderPortals(Camera& camera, int screenWidth, int screenHeight);
-    void RenderSatellites(Camera& camera, int screenWidth, int screenHeight);
-    void RenderParticleClouds(Camera& camera, int screenWidth, int screenHeight);
+    void RenderStations(Camera& camera, int screenHeight);
+    void RenderComets();
+    void RenderCometTrails();                 // Après la file de rendu : mélange additif sur l'opaque
+    void RenderDebris(Camera& camera, int screenHeight);
+    void RenderPortals();
+    void RenderSatellites(Camera& camera, int screenHeight);
+    void RenderParticleClouds();
+
+    // Envoie instanceData triées par LOD dans buffer, puis un tirage instancié par LOD
+    void DrawInstancesByLod(const Model& model, const Shader& shader, InstanceBuffer& buffer);
+    
+    // Culling GPU demandé et programme cull_instances.comp disponible
+    bool IsGpuCullingActive() const;
+    
+    // Envoie toutes les instanceData au culler puis dessine les instances retenues par le GPU
+    void DrawInstancesOnGpu(GpuCuller& culler, const Model& model, const Shader& shader,
+                            CullCategory category, const Camera& camera, float lodPixelScale);
+    
+    // Vide cullBatch et les paquets en attente avant une nouvelle catégorie
+    void BeginCulling();
+    
+    // Teste cullBatch contre le frustum et enregistre les compteurs de la catégorie
+    void RunCulling(CullCategory category);
+    
+    // Soumet les paquets en attente dont la sphère est visible, puis vide l'attente
+    void SubmitVisiblePackets(const Model& model);
+    void SubmitVisiblePackets(const Sphere& sphere);
+    
+    // Retire de instanceData et instanceLods les instances hors du frustum
+    void KeepVisibleInstances();
+    
+    // Test d'un objet isolé, compté dans CULL_BODIES
+    bool IsBodyVisible(const BoundingSphere& sphere);
+    
+    // Fenêtre des compteurs visibles / total par catégorie
+    void RenderCullingUI();
+    
+    glm::vec3 GetSatellitePosition(const Satellite& sat) const;
+    
+    // Réinsère les objets dynamiques de state dans index à leur position courante
+    void RebuildSpatialIndex(const SimulationState& state, LooseOctree& index);
+    
+    // Copie sim dans un instantané daté de time et le publie
+    void PublishSnapshot(double time);
+    
+    // Mélange les deux derniers instantanés dans frame, à l'instant présent
+    void BlendSnapshots();
+    
+    // Requête frustum sur spatialIndex (visibleEntities) et objet visé au centre de l'écran
+    void QuerySpatialIndex(const Camera& camera);
+    
+    // Indices visibles d'une catégorie de spatialIndex, compteurs de culling enregistrés au passage
+    const std::vector<size_t>& GetVisibleEntities(CullCategory category, size_t total);
     
 public:
     /**
@@ -253,6 +391,8 @@ public:
     // === Méthodes héritées de Scene ===
     virtual bool Initialize(Camera& camera, SoundManager& soundManager) override;
     virtual void Update(float deltaTime, GLFWwindow* window, Camera& camera, SoundManager& soundManager) override;
+    virtual bool HasFixedStepSimulation() const override { return true; }
+    virtual void Simulate(float deltaTime, double time) override;
     virtual void Render(Camera& camera, int screenWidth, int screenHeight) override;
     virtual void RenderUI(GLFWwindow* window, SoundManager& soundManager) override;
     virtual void Cleanup() override;
@@ -0,0 +1,95 @@
+#ifndef LOOSE_OCTREE_H
+#define LOOSE_OCTREE_H
+
+#include <glm/glm.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "Bounds.h"
+
+/**
+ * @brief Octree lâche (facteur 2) pour les objets dynamiques d'une scène
+ *
+ * Chaque nœud couvre un cube ; ses bornes lâches sont ce cube agrandi deux fois,
+ * si bien qu'un objet dont le centre est dans le cube et dont le rayon ne
+ * dépasse pas la demi-taille du nœud y tient entièrement. La profondeur d'un
+ * objet ne dépend donc que de son rayon et la cellule que de son centre :
+ * l'insertion est une simple descente, sans rééquilibrage. L'arbre est vidé et
+ * reconstruit à chaque frame ; nœuds et objets sont des tableaux réutilisés,
+ * sans allocation une fois la capacité atteinte.
+ *
+ * Les objets dont le centre sort du cube racine restent à la racine et sont
+ * testés individuellement par chaque requête.
+ */
+class LooseOctree {
+public:
+    /**
+     * @param center Centre du cube racine
+     * @param halfSize Demi-taille du cube racine
+     * @param maxDepth Profondeur maximale (la racine est à 0)
+     */
+    explicit LooseOctree(const glm::vec3& center = glm::vec3(0.0f), float halfSize = 1024.0f, int maxDepth = 6);
+
+    /**
+     * @brief Retire tous les objets (la mémoire est conservée)
+     */
+    void Clear();
+
+    /**
+     * @brief Insère un objet
+     * @param id Identifiant rendu par les requêtes
+     */
+    void Insert(uint32_t id, const BoundingSphere& sphere);
+
+    /**
+     * @brief Ajoute à results les objets dont la sphère coupe le frustum
+     */
+    void QueryFrustum(const Frustum& frustum, std::vector<uint32_t>& results) const;
+
+    /**
+     * @brief Ajoute à results les objets dont la sphère coupe la sphère (center, radius)
+     */
+    void QueryRadius(const glm::vec3& center, float radius, std::vector<uint32_t>& results) const;
+
+    /**
+     * @brief Objet le plus proche touché par un rayon
+     * @param direction Direction normalisée
+     * @return true si un objet est touché avant maxDistance
+     */
+    bool Raycast(const glm::vec3& origin, const glm::vec3& direction, float maxDistance,
+                 uint32_t& hitId, float& hitDistance) const;
+
+    size_t GetItemCount() const { return items.size(); }
+    size_t GetNodeCount() const { return nodes.size(); }
+
+private:
+    struct Node {
+        glm::vec3 center;
+        float halfSize;
+        int32_t children[8];
+        int32_t firstItem; // Liste chaînée dans items, -1 si vide
+    };
+
+    struct Item {
+        BoundingSphere sphere;
+        uint32_t id;
+        int32_t next;
+    };
+
+    int32_t CreateNode(const glm::vec3& center, float halfSize);
+    bool IsInsideRoot(const glm::vec3& point) const;
+
+    // fullyInside : bornes lâches du nœud entièrement dans le frustum, objets acceptés sans test
+    void QueryFrustumNode(int32_t node, const Frustum& frustum, bool fullyInside, std::vector<uint32_t>& results) const;
+    void QueryRadiusNode(int32_t node, const glm::vec3& center, float radius, std::vector<uint32_t>& results) const;
+    void RaycastNode(int32_t node, const glm::vec3& origin, const glm::vec3& inverseDirection,
+                     const glm::vec3& direction, float& bestDistance, uint32_t& hitId, bool& hit) const;
+
+    glm::vec3 rootCenter;
+    float rootHalfSize;
+    int maxDepth;
+    std::vector<Node> nodes;
+    std::vector<Item> items;
+};
+
+#endif // LOOSE_OCTREE_H
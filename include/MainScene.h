@@ -4,6 +4,7 @@
 #include "Scene.h"
 #include "Shader.h"
 #include "Model.h"
+#include "InstanceBuffer.h"
 #include "Sphere.h"
 #include "Camera.h"
 #include "AudioSource.h"
@@ -12,6 +13,7 @@
 #include "Skybox.h"
 #include "SkyboxManager.h"
 #include <memory>
+#include <vector>
 #include <glm/glm.hpp>
 
 /**
@@ -37,6 +39,8 @@ private:    // Les shaders sont maintenant gérés par le ShaderManager global
         float orbitSpeed;      // Vitesse orbitale
     };
       AsteroidData asteroids[ASTEROID_COUNT];
+    std::vector<InstanceData> asteroidInstanceData; // Rempli à chaque frame
+    InstanceBuffer asteroidInstances;               // Un seul tirage pour tout l'anneau
     
     // === Vaisseaux français ===
     std::unique_ptr<Model> spaceshipModel;
@@ -0,0 +1,50 @@
+#ifndef MAPPED_FILE_H
+#define MAPPED_FILE_H
+
+#include <cstddef>
+#include <string>
+
+/**
+ * @brief Projection en mémoire d'un fichier en lecture seule (mmap / MapViewOfFile)
+ *
+ * Le contenu reste accessible tant que l'objet est ouvert ; aucune copie
+ * n'est effectuée, les pages sont chargées à la demande par le système.
+ */
+class MappedFile {
+public:
+    MappedFile() = default;
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+
+    /**
+     * @brief Projette le fichier en mémoire
+     * @param path Chemin du fichier
+     * @return true si la projection réussit, false sinon
+     */
+    bool Open(const std::string& path);
+
+    /**
+     * @brief Libère la projection
+     */
+    void Close();
+
+    bool IsOpen() const { return data != nullptr; }
+    const unsigned char* Data() const { return data; }
+    size_t Size() const { return size; }
+
+private:
+    const unsigned char* data = nullptr;
+    size_t size = 0;
+#ifdef _WIN32
+    void* fileHandle = nullptr;
+    void* mappingHandle = nullptr;
+#else
+    int fd = -1;
+#endif
+};
+
+#endif // MAPPED_FILE_H
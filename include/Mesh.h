@@ -3,8 +3,12 @@
 
 #include <GL/glew.h>
 #include <glm/glm.hpp>
+#include <cstdint>
 #include <vector>
 #include "Shader.h"
+#include "Bounds.h"
+#include "GeometryBuffer.h"
+#include "InstanceBuffer.h"
 
 struct Vertex
 {
@@ -13,6 +17,23 @@ struct Vertex
     glm::vec2 TexCoords;
 };
 
+// Format des sommets envoyés au GPU ; les shaders décodent les positions avec
+// les uniforms positionScale/positionOffset fournis par Mesh::Draw
+enum class VertexFormat
+{
+    Float,        // Vertex tel quel (32 octets)
+    PackedHalf,   // positions en demi-flottants centrées sur la boîte englobante (16 octets)
+    PackedUnorm16 // positions 16 bits normalisées dans la boîte englobante (16 octets)
+};
+
+// Sommet compressé des formats Packed* : normale GL_INT_2_10_10_10_REV, UV en demi-flottants
+struct PackedVertex
+{
+    uint16_t Position[4]; // xyz + remplissage pour l'alignement
+    uint32_t Normal;
+    uint16_t TexCoords[2];
+};
+
 struct Texture
 {
     unsigned int id;
@@ -20,25 +41,100 @@ struct Texture
     std::string path;
 };
 
+// Données CPU d'un mesh, préparées hors du thread OpenGL (import, cache)
+struct MeshData
+{
+    std::vector<Vertex> vertices;
+    std::vector<unsigned int> indices;
+    std::vector<Texture> textures;
+    VertexFormat format = VertexFormat::Float;
+    glm::vec3 boundsMin = glm::vec3(0.0f);
+    glm::vec3 boundsMax = glm::vec3(0.0f);
+
+    // ACMR avant/après MeshOptimizer (0 si le mesh n'a pas été optimisé)
+    float acmrBefore = 0.0f;
+    float acmrAfter = 0.0f;
+
+    // Niveau de détail (0 = pleine résolution) et erreur géométrique de la simplification
+    unsigned int lodLevel = 0;
+    float lodError = 0.0f;
+
+    // Calcule la boîte englobante à partir des sommets
+    void ComputeBounds();
+};
+
+// Sommets et indices sont suballoués dans le GeometryBuffer partagé ; VAO est celui
+// du format, commun à tous les meshes de ce format
 class Mesh
 {
 public:
-    // Données
+    // Données (vides si le mesh a été chargé directement depuis un cache projeté en mémoire)
     std::vector<Vertex> vertices;
     std::vector<unsigned int> indices;
     std::vector<Texture> textures;
 
     unsigned int VAO;
+    unsigned int indexCount;
+
+    // Format GPU des sommets et déquantification des positions (position = attribut * scale + offset)
+    VertexFormat format = VertexFormat::Float;
+    glm::vec3 positionScale = glm::vec3(1.0f);
+    glm::vec3 positionOffset = glm::vec3(0.0f);
+
+    // Boîte englobante locale
+    glm::vec3 boundsMin;
+    glm::vec3 boundsMax;
+
+    // Niveau de détail et erreur géométrique associée (unités du modèle)
+    unsigned int lodLevel = 0;
+    float lodError = 0.0f;
 
     // Constructeur
-    Mesh(std::vector<Vertex> vertices, std::vector<unsigned int> indices, std::vector<Texture> textures);
+    Mesh(std::vector<Vertex> vertices, std::vector<unsigned int> indices, std::vector<Texture> textures,
+         VertexFormat format = VertexFormat::Float);
+
+    // Constructeur à partir de données déjà préparées (boîte englobante comprise) ;
+    // quantization : boîte de quantification des formats Packed* (par défaut celle du mesh)
+    explicit Mesh(MeshData data, const AABB *quantization = nullptr);
+
+    // Constructeur à partir de données externes (envoyées au GPU sans copie CPU)
+    Mesh(const Vertex *vertexData, size_t vertexCount, const unsigned int *indexData, size_t indexCount,
+         const glm::vec3 &boundsMin, const glm::vec3 &boundsMax, std::vector<Texture> textures,
+         VertexFormat format = VertexFormat::Float, const AABB *quantization = nullptr);
+
+    // Taille d'un sommet dans le VBO
+    size_t GetVertexStride() const { return format == VertexFormat::Float ? sizeof(Vertex) : sizeof(PackedVertex); }
 
     // Méthode pour dessiner le mesh
     void Draw(const Shader &shader) const;
 
+    // Dessiner count instances dont les attributs sont lus dans instances à partir de first
+    void DrawInstanced(const Shader &shader, const InstanceBuffer &instances, size_t count, size_t first = 0) const;
+
+    // Étapes de Draw séparées pour le RenderQueue, qui ne change un état que s'il diffère du précédent
+    void BindTextures(const Shader &shader) const;
+    void SetPositionDecoding(const Shader &shader) const;
+    void DrawElements() const; // VAO déjà lié
+
+    // Empreinte de toutes les textures (0 sans texture), pour ordonner les tirages ; les textures
+    // ne sont gardées d'un mesh à l'autre que si HasSameTextures
+    unsigned int GetTextureKey() const;
+    bool HasSameTextures(const Mesh &other) const;
+
+    // Commande de tirage de la plage du mesh, pour GeometryBuffer::Draw
+    DrawElementsIndirectCommand GetDrawCommand(unsigned int instanceCount = 1, unsigned int baseInstance = 0) const;
+
+    // Même déquantification des positions (deux meshes peuvent alors partager un tirage groupé)
+    bool HasSameDecoding(const Mesh &other) const
+    {
+        return positionScale == other.positionScale && positionOffset == other.positionOffset;
+    }
+
 private:
-    unsigned int VBO, EBO;
-    void setupMesh();
+    GeometryRange geometry;
+    void bindMaterial(const Shader &shader) const;
+    void setupMesh(const Vertex *vertexData, size_t vertexCount, const unsigned int *indexData, size_t indexCount,
+                   const AABB *quantization);
 };
 
 #endif
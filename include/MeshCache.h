@@ -0,0 +1,64 @@
+#ifndef MESH_CACHE_H
+#define MESH_CACHE_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <glm/glm.hpp>
+#include "Mesh.h"
+#include "MappedFile.h"
+
+// Plage d'un sous-mesh dans les tableaux entrelacés du cache
+struct SubMeshRange
+{
+    uint32_t vertexOffset;
+    uint32_t vertexCount;
+    uint32_t indexOffset;
+    uint32_t indexCount;
+    glm::vec3 boundsMin;
+    glm::vec3 boundsMax;
+    float acmrBefore;
+    float acmrAfter;
+    uint32_t lodLevel;
+    float lodError;
+};
+
+/**
+ * @brief Cache binaire versionné des meshes issus d'un fichier OBJ
+ *
+ * Le fichier "<source>.meshcache" contient les Vertex entrelacés, les indices
+ * (déjà passés par MeshOptimizer) et les plages/boîtes englobantes de chaque
+ * sous-mesh et de ses LOD, avec l'ACMR mesuré à l'import. Il est projeté en
+ * mémoire à la lecture : les données peuvent être envoyées telles quelles à
+ * glBufferData. Le cache est invalidé si la taille, la date de modification
+ * (puis le hachage en cas de doute) de la source ne correspondent plus.
+ */
+class MeshCache
+{
+public:
+    static const uint32_t VERSION = 3;
+
+    // Chemin du cache associé à un fichier source
+    static std::string GetCachePath(const std::string &sourcePath);
+
+    // Écrit le cache à partir des meshes fraîchement importés
+    static bool Write(const std::string &sourcePath, const std::vector<MeshData> &meshes);
+
+    // Projette et valide le cache ; false s'il est absent, corrompu ou périmé
+    bool Open(const std::string &sourcePath);
+    void Close();
+
+    size_t GetSubMeshCount() const { return subMeshCount; }
+    const SubMeshRange &GetSubMesh(size_t i) const { return subMeshes[i]; }
+    const Vertex *GetVertices() const { return vertices; }
+    const unsigned int *GetIndices() const { return indices; }
+
+private:
+    MappedFile file;
+    size_t subMeshCount = 0;
+    const SubMeshRange *subMeshes = nullptr;
+    const Vertex *vertices = nullptr;
+    const unsigned int *indices = nullptr;
+};
+
+#endif // MESH_CACHE_H
@@ -0,0 +1,42 @@
+#ifndef MESH_OPTIMIZER_H
+#define MESH_OPTIMIZER_H
+
+#include <vector>
+#include "Mesh.h"
+
+/**
+ * @brief Optimisations d'import appliquées aux buffers d'indices des meshes
+ *
+ * Trois passes, dans cet ordre :
+ *  - ordre des triangles pour le cache post-transformation (algorithme de Forsyth) ;
+ *  - regroupement en clusters triés de l'extérieur vers l'intérieur pour limiter
+ *    l'overdraw, sans dégrader l'ACMR au-delà d'un seuil ;
+ *  - renumérotation des sommets dans l'ordre de première utilisation pour la
+ *    localité des lectures du vertex fetch.
+ *
+ * L'ACMR (average cache miss ratio) est le nombre moyen de sommets transformés
+ * par triangle, mesuré avec un cache FIFO simulé : 3 au pire, ~0.5 au mieux.
+ */
+class MeshOptimizer
+{
+public:
+    // Taille du cache FIFO utilisé pour mesurer l'ACMR (ordre de grandeur des GPU actuels)
+    static const unsigned int CACHE_SIZE = 16;
+
+    // Applique les trois passes et renseigne acmrBefore/acmrAfter
+    static void Optimize(MeshData &mesh);
+
+    // ACMR d'une liste de triangles pour un cache FIFO de cacheSize sommets
+    static float ComputeACMR(const std::vector<unsigned int> &indices, size_t vertexCount, unsigned int cacheSize = CACHE_SIZE);
+
+    // Réordonne les triangles pour le cache post-transformation
+    static void OptimizeVertexCache(std::vector<unsigned int> &indices, size_t vertexCount);
+
+    // Trie des clusters de triangles pour l'overdraw ; threshold borne la hausse d'ACMR tolérée
+    static void OptimizeOverdraw(std::vector<unsigned int> &indices, const std::vector<Vertex> &vertices, float threshold = 1.05f);
+
+    // Renumérote les sommets dans l'ordre d'utilisation (les sommets inutilisés sont retirés)
+    static void OptimizeVertexFetch(std::vector<Vertex> &vertices, std::vector<unsigned int> &indices);
+};
+
+#endif // MESH_OPTIMIZER_H
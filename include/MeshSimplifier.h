@@ -0,0 +1,30 @@
+#ifndef MESH_SIMPLIFIER_H
+#define MESH_SIMPLIFIER_H
+
+#include <vector>
+#include "Mesh.h"
+
+/**
+ * @brief Simplification de meshes par effondrement d'arêtes guidé par les quadriques
+ *
+ * Algorithme de Garland-Heckbert (effondrement de demi-arêtes : le sommet
+ * conservé garde sa position). Les sommets sont d'abord soudés par position,
+ * ce qui permet de simplifier aussi les meshes dont les normales ou les UV
+ * sont propres à chaque face. Les arêtes de bord sont protégées par des
+ * quadriques de contrainte et les effondrements qui retournent un triangle
+ * sont refusés. Les normales du résultat sont recalculées à partir des faces.
+ */
+class MeshSimplifier
+{
+public:
+    /**
+     * @brief Simplifie un mesh
+     * @param targetRatio Fraction des triangles à conserver (0..1)
+     * @param maxError Erreur géométrique maximale, dans l'unité du modèle
+     * @param resultError Erreur atteinte par le dernier effondrement accepté
+     * @return Le mesh simplifié (boîte englobante calculée)
+     */
+    static MeshData Simplify(const MeshData &mesh, float targetRatio, float maxError, float *resultError = nullptr);
+};
+
+#endif // MESH_SIMPLIFIER_H
@@ -3,9 +3,12 @@
 
 #include <GL/glew.h>
 #include <glm/glm.hpp>
+#include <memory>
 #include <string>
 #include <vector>
+#include "Bounds.h"
 #include "Mesh.h"
+#include "RenderQueue.h"
 #include "Shader.h"
 #include "tiny_obj_loader.h"
 
@@ -16,15 +19,84 @@ public:
     std::vector<Mesh> meshes;
     std::string directory;
 
-    // Constructeur
-    Model(const std::string &path);
+    // Constructeur (streamed : lecture et décodage délégués à l'AssetLoader ;
+    // format : format GPU des sommets, compressé pour les modèles très instanciés)
+    Model(const std::string &path, bool streamed = false, VertexFormat format = VertexFormat::Float);
 
-    // Afficher le modèle
+    Model(const Model &) = delete;
+    Model &operator=(const Model &) = delete;
+
+    // Afficher le modèle (substitut tant que le chargement n'est pas terminé)
     void Draw(const Shader &shader) const;
 
+    // Afficher un niveau de détail (0 = pleine résolution, borné au dernier LOD disponible)
+    void Draw(const Shader &shader, size_t lod) const;
+
+    // Soumettre un niveau de détail au RenderQueue (un paquet par sous-mesh, packet.mesh renseigné ici)
+    void Submit(RenderQueue &queue, DrawPacket packet, size_t lod = 0) const;
+
+    // Afficher count instances en un tirage par sous-mesh (shader *_instanced) ;
+    // first permet de dessiner une tranche du buffer, par exemple les instances d'un même LOD
+    void DrawInstanced(const Shader &shader, const InstanceBuffer &instances, size_t count, size_t lod = 0, size_t first = 0) const;
+
+    // Afficher des instances triées par LOD en un seul tirage groupé : les instances du LOD l
+    // occupent [lodOffsets[l], lodOffsets[l + 1]) du buffer (GetLodCount() + 1 valeurs)
+    void DrawInstancedByLod(const Shader &shader, const InstanceBuffer &instances, const std::vector<size_t> &lodOffsets) const;
+
+    // Ajoute à commands une commande par sous-mesh pour un LOD (même nombre de commandes pour chaque LOD)
+    void AppendDrawCommands(std::vector<DrawElementsIndirectCommand> &commands, size_t lod,
+                            size_t instanceCount, size_t baseInstance) const;
+
+    // Afficher des instances avec des commandes lues dans un buffer GPU (voir GpuCuller)
+    void DrawIndirect(const Shader &shader, GLuint commandBuffer, size_t commandCount, const InstanceBuffer &instances) const;
+
+    // Rayon de la sphère centrée sur l'origine du modèle qui le contient (substitut compris)
+    float GetBoundingRadius() const { return boundingRadius; }
+
+    // Volumes englobants locaux du niveau 0, calculés au chargement (substitut compris), pour le culling
+    const BoundingSphere &GetBoundingSphere() const { return boundingSphere; }
+    const AABB &GetBounds() const { return bounds; }
+
+    // Nombre de niveaux de détail générés à l'import (1 si aucun)
+    size_t GetLodCount() const { return lodErrors.size(); }
+
+    // Erreur géométrique d'un niveau (unités du modèle, 0 pour le LOD 0)
+    float GetLodError(size_t lod) const { return lodErrors[lod]; }
+
+    // Erreur projetée tolérée (pixels) et marge d'hystérésis autour des seuils de changement
+    static constexpr float LOD_PIXEL_ERROR = 1.0f;
+    static constexpr float LOD_HYSTERESIS = 0.25f;
+
+    // Pixels à l'écran d'une unité située à distance 1, pour SelectLod
+    static float GetLodPixelScale(float fovYDegrees, int screenHeight);
+
+    // Choisit le LOD d'une instance d'après l'erreur projetée à l'écran ; currentLod
+    // (LOD de la frame précédente) sert d'hystérésis pour éviter les va-et-vient
+    size_t SelectLod(float distance, float scale, float pixelScale, size_t currentLod) const;
+
+    // État du chargement
+    bool IsLoaded() const { return loaded; }
+
 private:
-    void loadModel(const std::string &path);
-    Mesh processMesh(const tinyobj::attrib_t &attrib, const tinyobj::shape_t &shape, const std::vector<tinyobj::material_t> &materials);
+    struct LoadedData;
+
+    bool loaded = false;
+    VertexFormat format = VertexFormat::Float;
+    std::vector<float> lodErrors = std::vector<float>(1, 0.0f);
+    float boundingRadius = 1.0f;
+    AABB bounds = {glm::vec3(-1.0f), glm::vec3(1.0f)};
+    BoundingSphere boundingSphere = {glm::vec3(0.0f), 1.0f};
+    std::shared_ptr<int> streamToken;
+
+    // Commandes du dernier tirage groupé, réutilisées d'un appel à l'autre
+    mutable std::vector<DrawElementsIndirectCommand> drawCommands;
+
+    static bool decode(const std::string &path, LoadedData &data);
+    void upload(LoadedData &data);
+    size_t selectLodMesh(size_t group, size_t lod, size_t &next) const;
+    void bindDrawState(const Shader &shader) const;
+    void drawCommandList(const Shader &shader, const InstanceBuffer *instances) const;
+    static MeshData processMesh(const tinyobj::attrib_t &attrib, const tinyobj::shape_t &shape, const std::vector<tinyobj::material_t> &materials);
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,33 @@
+#ifndef OBJ_PARSER_H
+#define OBJ_PARSER_H
+
+#include <string>
+#include <vector>
+#include "tiny_obj_loader.h"
+
+/**
+ * @brief Import OBJ parallèle produisant les mêmes structures que tinyobj
+ *
+ * Le fichier est projeté en mémoire puis découpé en blocs alignés sur les
+ * fins de ligne. Chaque bloc est analysé par un thread (sommets, normales,
+ * coordonnées de texture et faces brutes) ; les résultats sont ensuite
+ * fusionnés dans l'ordre du fichier, ce qui rend la sortie identique à celle
+ * de tinyobj::LoadObj (triangulation activée). Les instructions rares que le
+ * chemin rapide ne traite pas (l, p, t, vw, polygones de plus de 4 sommets,
+ * indices nuls...) déclenchent un repli transparent sur tinyobj.
+ */
+class ObjParser
+{
+public:
+    /**
+     * @brief Charge un fichier OBJ (mêmes paramètres et sorties que tinyobj::LoadObj)
+     * @param threadCount Nombre de threads, 0 pour std::thread::hardware_concurrency()
+     * @return true si le chargement réussit
+     */
+    static bool Load(const std::string &path, const std::string &mtlBaseDir,
+                     tinyobj::attrib_t *attrib, std::vector<tinyobj::shape_t> *shapes,
+                     std::vector<tinyobj::material_t> *materials,
+                     std::string *warn, std::string *err, unsigned threadCount = 0);
+};
+
+#endif // OBJ_PARSER_H
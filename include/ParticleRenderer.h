@@ -0,0 +1,47 @@
+#ifndef PARTICLE_RENDERER_H
+#define PARTICLE_RENDERER_H
+
+#include <GL/glew.h>
+#include <glm/glm.hpp>
+#include <cstddef>
+
+/**
+ * @brief Rendu de particules en sprites face caméra
+ *
+ * Chaque particule est un quad orienté vers la caméra (imposteur de sphère),
+ * généré dans le shader particle.vert à partir de sa position monde et de son
+ * rayon. Toutes les particules sont envoyées une fois par frame dans un même
+ * buffer et dessinées en un seul appel instancié.
+ */
+class ParticleRenderer {
+public:
+    ParticleRenderer() = default;
+    ~ParticleRenderer();
+
+    ParticleRenderer(const ParticleRenderer&) = delete;
+    ParticleRenderer& operator=(const ParticleRenderer&) = delete;
+
+    /**
+     * @brief Remplace les particules à dessiner
+     * @param particles Tableau de count particules (xyz : position monde, w : rayon)
+     */
+    void Update(const glm::vec4* particles, size_t count);
+
+    /**
+     * @brief Dessine toutes les particules (shader particle déjà actif)
+     */
+    void Draw() const;
+
+    size_t GetCount() const { return count; }
+
+private:
+    void CreateBuffers();
+
+    GLuint vao = 0;
+    GLuint quadVBO = 0;
+    GLuint particleVBO = 0;
+    size_t capacity = 0;
+    size_t count = 0;
+};
+
+#endif // PARTICLE_RENDERER_H
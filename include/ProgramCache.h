@@ -0,0 +1,37 @@
+#ifndef PROGRAM_CACHE_H
+#define PROGRAM_CACHE_H
+
+#include <cstdint>
+#include <string>
+
+/**
+ * @brief Cache disque des programmes liés (glGetProgramBinary / glProgramBinary)
+ *
+ * Chaque programme est enregistré dans "shadercache/<clé>.bin", relatif au
+ * dossier de lancement. La clé 64 bits hache les sources vertex et fragment,
+ * les chaînes GL_VENDOR, GL_RENDERER et GL_VERSION et les formats binaires du
+ * pilote ; l'en-tête rappelle la clé et le format du binaire. Un binaire refusé
+ * par le pilote est ignoré : le programme est recompilé depuis les sources puis
+ * réenregistré.
+ */
+class ProgramCache
+{
+public:
+    static const uint32_t VERSION = 1;
+
+    // Vrai si le contexte courant sait relire au moins un format binaire
+    static bool IsSupported();
+
+    // Clé d'un programme pour le pilote courant
+    static uint64_t MakeKey(const std::string &vertexCode, const std::string &fragmentCode);
+
+    static std::string GetCachePath(uint64_t key);
+
+    // Charge le binaire dans program ; false s'il est absent, corrompu ou refusé par le pilote
+    static bool Load(uint64_t key, unsigned int program);
+
+    // Enregistre le binaire d'un programme lié avec GL_PROGRAM_BINARY_RETRIEVABLE_HINT
+    static bool Store(uint64_t key, unsigned int program);
+};
+
+#endif // PROGRAM_CACHE_H
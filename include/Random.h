@@ -0,0 +1,78 @@
+#ifndef RANDOM_H
+#define RANDOM_H
+
+#include <glm/glm.hpp>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief Générateur pseudo-aléatoire xoshiro256** à état local
+ *
+ * Remplace rand() dans le code des scènes : rapide, de bonne qualité et sans
+ * état global caché. Chaque système tire dans son propre flux (ForStream),
+ * dérivé de la graine globale et du nom du flux ; deux systèmes qui tournent
+ * en parallèle ne se partagent donc rien, et un même flux donne la même suite
+ * à chaque exécution, quel que soit l'ordre des tâches.
+ *
+ * Entiers et flottants uniformes sont calculés en arithmétique entière puis
+ * convertis de la même façon partout : une graine donne les mêmes tirages au
+ * bit près, quelle que soit la bibliothèque standard (contrairement aux
+ * distributions de <random>). Les tirages sphériques passent en plus par
+ * sqrt, cos et sin.
+ *
+ * Un générateur n'est pas protégé : un seul thread à la fois par instance.
+ */
+class Random {
+public:
+    static const uint64_t DEFAULT_SEED = 42;
+
+    /**
+     * @brief Générateur initialisé directement par une graine (benchmarks)
+     */
+    explicit Random(uint64_t seed = DEFAULT_SEED);
+
+    /**
+     * @brief Flux indépendant d'un système, dérivé de la graine globale et de son nom
+     */
+    static Random ForStream(const char* name);
+
+    /**
+     * @brief Graine globale des flux (option --seed), à fixer avant l'initialisation des scènes
+     */
+    static void SetGlobalSeed(uint64_t seed);
+    static uint64_t GetGlobalSeed();
+
+    // 64 bits uniformes
+    uint64_t Next();
+
+    // Entier uniforme dans [0, bound), bound > 0 ; remplace rand() % bound
+    int UniformInt(int bound);
+
+    // Flottant uniforme dans [0, 1), puis dans [min, max)
+    float Uniform();
+    float Uniform(float min, float max);
+
+    // Point uniforme sur la sphère unité, puis dans la boule de rayon donné
+    glm::vec3 OnSphere();
+    glm::vec3 InSphere(float radius);
+
+    /**
+     * @brief Remplit values[0..count) de flottants uniformes dans [min, max)
+     */
+    void FillUniform(float* values, size_t count, float min, float max);
+
+    /**
+     * @brief Remplit points[0..count) de points uniformes sur la sphère de rayon donné
+     */
+    void FillOnSphere(glm::vec3* points, size_t count, float radius);
+
+    /**
+     * @brief Remplit points[0..count) de points uniformes dans la boule de rayon donné
+     */
+    void FillInSphere(glm::vec3* points, size_t count, float radius);
+
+private:
+    uint64_t state[4];
+};
+
+#endif // RANDOM_H
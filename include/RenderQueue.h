@@ -0,0 +1,113 @@
+#ifndef RENDER_QUEUE_H
+#define RENDER_QUEUE_H
+
+#include <glm/glm.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "Shader.h"
+#include "Mesh.h"
+
+/**
+ * @brief Tirage différé soumis au RenderQueue
+ *
+ * Les uniforms propres à un shader et constants sur la frame (time...) sont
+ * définis par la scène avant RenderQueue::Execute ; seuls la transformation
+ * et la couleur varient d'un paquet à l'autre.
+ */
+struct DrawPacket {
+    const Shader* shader = nullptr;
+    const Mesh* mesh = nullptr;           // Renseigné par Model::Submit / Sphere::Submit
+    glm::mat4 model = glm::mat4(1.0f);    // Écrite dans l'anneau de transformations à l'exécution
+    glm::vec3 color = glm::vec3(1.0f);
+    bool hasColor = false;                // objectColor n'est envoyé que si vrai
+    uint8_t pass = 0;                     // Passes exécutées dans l'ordre croissant (0 à 15)
+};
+
+/**
+ * @brief Compteurs de la dernière exécution
+ *
+ * Les compteurs "unsorted" donnent les changements d'état qu'aurait coûtés
+ * l'exécution dans l'ordre de soumission.
+ */
+struct RenderQueueStats {
+    size_t draws = 0;
+    size_t drawCalls = 0;    // Appels de tirage après regroupement des paquets consécutifs compatibles
+    size_t programChanges = 0;
+    size_t vaoChanges = 0;
+    size_t textureChanges = 0;
+    size_t unsortedProgramChanges = 0;
+    size_t unsortedVaoChanges = 0;
+    size_t unsortedTextureChanges = 0;
+
+    size_t GetStateChanges() const { return programChanges + vaoChanges + textureChanges; }
+    size_t GetUnsortedStateChanges() const {
+        return unsortedProgramChanges + unsortedVaoChanges + unsortedTextureChanges;
+    }
+    size_t GetSavedStateChanges() const {
+        return GetUnsortedStateChanges() > GetStateChanges() ? GetUnsortedStateChanges() - GetStateChanges() : 0;
+    }
+};
+
+/**
+ * @brief File de tirages triée pour limiter les changements d'état OpenGL
+ *
+ * Les scènes soumettent leurs tirages entre Begin et Execute. Execute trie les
+ * paquets par une clé 64 bits (tri par base, octet par octet) :
+ * passe (4 bits) | programme (8) | VAO (16) | texture (16) | profondeur (20),
+ * la profondeur allant du plus proche au plus lointain. Les paquets sont ensuite
+ * exécutés en ne changeant programme, VAO, textures et couleur que lorsqu'ils
+ * diffèrent du paquet précédent. Les paquets consécutifs qui ne diffèrent que
+ * par leur mesh (sous-meshes d'un même modèle) partagent une transformation et
+ * un seul appel GeometryBuffer::Draw.
+ */
+class RenderQueue {
+public:
+    static RenderQueue& getInstance();
+
+    /**
+     * @brief Commence une nouvelle file
+     * @param viewPos Position de la caméra, pour la profondeur des paquets
+     */
+    void Begin(const glm::vec3& viewPos);
+
+    void Submit(const DrawPacket& packet);
+
+    /**
+     * @brief Trie et exécute les paquets soumis, puis vide la file
+     */
+    void Execute();
+
+    const RenderQueueStats& GetStats() const { return stats; }
+
+private:
+    RenderQueue() = default;
+    ~RenderQueue() = default;
+    RenderQueue(const RenderQueue&) = delete;
+    RenderQueue& operator=(const RenderQueue&) = delete;
+
+    struct SortEntry {
+        uint64_t key;
+        uint32_t index;
+    };
+
+    // Profondeur au-delà de laquelle les paquets partagent la dernière valeur (plan lointain)
+    static constexpr float MAX_DEPTH = 1000.0f;
+
+    uint64_t MakeKey(const DrawPacket& packet);
+    uint32_t GetProgramIndex(const Shader* shader);
+    void CountUnsortedStateChanges();
+    static void RadixSort(std::vector<SortEntry>& entries, std::vector<SortEntry>& scratch);
+    void FlushBatch();
+
+    std::vector<DrawPacket> packets;
+    std::vector<SortEntry> entries;
+    std::vector<SortEntry> scratch;
+    std::vector<const Shader*> programs; // Index dense des programmes de la frame
+    std::vector<DrawElementsIndirectCommand> batch; // Tirage groupé en cours
+    glm::mat4 batchModel = glm::mat4(1.0f);
+    glm::vec3 viewPos = glm::vec3(0.0f);
+    RenderQueueStats stats;
+};
+
+#endif // RENDER_QUEUE_H
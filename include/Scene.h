@@ -37,6 +37,23 @@ public:
      */
     virtual void Update(float deltaTime, GLFWwindow* window, Camera& camera, SoundManager& soundManager) = 0;
 
+    /**
+     * @brief Indique si la scène avance son état dans Simulate plutôt que dans Update
+     *
+     * Update ne garde alors que le travail lié à la fenêtre (entrées, audio, caméra).
+     */
+    virtual bool HasFixedStepSimulation() const { return false; }
+
+    /**
+     * @brief Avance l'état simulé d'un pas et publie un instantané pour le rendu
+     * @param deltaTime Durée du pas (fixe sur le thread de simulation)
+     * @param time Instant atteint à la fin du pas (horloge SimulationThread::Now)
+     *
+     * Appelée depuis le thread de simulation (voir SimulationThread) : aucun
+     * appel OpenGL ni GLFW, et aucun accès à l'état lu par Render.
+     */
+    virtual void Simulate(float /*deltaTime*/, double /*time*/) {}
+
     /**
      * @brief Effectue le rendu de la scène
      * @param camera Référence vers la caméra
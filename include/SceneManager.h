@@ -2,6 +2,7 @@
 #define SCENEMANAGER_H
 
 #include <memory>
+#include <mutex>
 #include <vector>
 #include <string>
 #include <GL/glew.h>
@@ -21,6 +22,7 @@ private:
     std::vector<std::unique_ptr<Scene>> scenes;  ///< Liste des scènes disponibles
     int currentSceneIndex;                       ///< Index de la scène actuelle
     bool initialized;                            ///< État d'initialisation
+    std::mutex sceneMutex;                       ///< Protège le changement de scène pendant Simulate
 
 public:
     /**
@@ -73,6 +75,16 @@ public:
      */
     void Update(float deltaTime, GLFWwindow* window, Camera& camera, SoundManager& soundManager);
 
+    /**
+     * @brief Avance la simulation de la scène actuelle, si elle en a une (voir Scene::Simulate)
+     * @param deltaTime Durée du pas
+     * @param time Instant atteint à la fin du pas
+     *
+     * Peut être appelée depuis le thread de simulation : les changements de
+     * scène attendent la fin du pas.
+     */
+    void Simulate(float deltaTime, double time);
+
     /**
      * @brief Effectue le rendu de la scène actuelle
      * @param camera Référence vers la caméra
@@ -1,8 +1,54 @@
 #ifndef SHADER_H
 #define SHADER_H
 
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
 #include <string>
+#include <vector>
 #include <glm/glm.hpp>
+#include "Hash.h"
+
+// Nom d'uniform réduit à son hachage FNV-1a. Un littéral est haché à la compilation
+// lorsqu'il initialise une constante : static constexpr UniformName TIME("time");
+struct UniformName
+{
+    uint64_t hash;
+
+    template <size_t N>
+    constexpr UniformName(const char (&text)[N]) : hash(Hash::Fnv1a64String(text)) {}
+    UniformName(const std::string &text) : hash(Hash::Fnv1a64(text.data(), text.size())) {}
+
+    // Nom suivi d'un index décimal ("texture_diffuse" -> "texture_diffuse1"), sans allocation
+    constexpr UniformName Indexed(unsigned int index) const
+    {
+        char digits[10] = {};
+        int count = 0;
+        do
+        {
+            digits[count++] = static_cast<char>('0' + index % 10);
+            index /= 10;
+        } while (index > 0);
+
+        UniformName result = *this;
+        while (count > 0)
+        {
+            result.hash ^= static_cast<unsigned char>(digits[--count]);
+            result.hash *= Hash::FNV64_PRIME;
+        }
+        return result;
+    }
+};
+
+// Emplacement d'un uniform résolu une fois, typé par la valeur C++ attendue
+// (int, float, glm::vec3, glm::mat4) ; un handle invalide est ignoré par Shader::set
+template <typename T>
+struct UniformHandle
+{
+    int location = -1;
+
+    bool IsValid() const { return location >= 0; }
+};
 
 class Shader
 {
@@ -12,18 +58,58 @@ public:
     // Constructeur : lit et construit le shader
     Shader(const char *vertexPath, const char *fragmentPath);
 
+    // Constructeur d'un programme de calcul (compute shader seul, GL 4.3)
+    explicit Shader(const char *computePath);
+
     // Utiliser/activer le shader
     void use() const;
 
-    // Fonctions utilitaires pour définir les uniforms
-    void setBool(const std::string &name, bool value) const;
-    void setInt(const std::string &name, int value) const;
-    void setFloat(const std::string &name, float value) const;
-    void setMat4(const std::string &name, const glm::mat4 &mat) const;
-    void setVec3(const std::string &name, const glm::vec3 &vec) const;
+    // Fonctions utilitaires pour définir les uniforms (emplacement lu dans la table réfléchie, sans glGetUniformLocation)
+    void setBool(UniformName name, bool value) const;
+    void setInt(UniformName name, int value) const;
+    void setFloat(UniformName name, float value) const;
+    void setMat4(UniformName name, const glm::mat4 &mat) const;
+    void setVec3(UniformName name, const glm::vec3 &vec) const;
+
+    // Résout un uniform une fois pour toutes (handle invalide s'il est absent ou d'un autre type)
+    template <typename T>
+    UniformHandle<T> GetUniform(UniformName name) const;
+
+    void set(UniformHandle<int> handle, int value) const;
+    void set(UniformHandle<float> handle, float value) const;
+    void set(UniformHandle<glm::vec3> handle, const glm::vec3 &value) const;
+    void set(UniformHandle<glm::mat4> handle, const glm::mat4 &value) const;
+
+    // Nombre d'uniforms actifs relevés après l'édition de liens
+    size_t GetUniformCount() const { return uniformCount; }
+
+    // Vrai si le programme a été relu depuis le ProgramCache plutôt que compilé
+    bool IsFromProgramCache() const { return fromProgramCache; }
     
     // Fonction pour lier les UBOs au shader
     void bindUBOs() const;
+
+private:
+    struct UniformEntry
+    {
+        uint64_t hash = 0;
+        int location = -1;
+        unsigned int type = 0; // 0 : case vide
+    };
+
+    // Table à adressage ouvert (sondage linéaire), taille puissance de deux, remplie au plus à moitié
+    std::vector<UniformEntry> uniforms;
+    size_t uniformCount = 0;
+    bool fromProgramCache = false;
+
+    // Compile et lie les deux étapes dans un nouveau programme ID ; false en cas d'erreur
+    bool compileProgram(const char *vShaderCode, const char *fShaderCode);
+    bool compileComputeProgram(const char *cShaderCode);
+    bool linkProgram(std::initializer_list<unsigned int> stages);
+    void reflectUniforms();
+    void insertUniform(uint64_t hash, int location, unsigned int type);
+    const UniformEntry *findUniform(uint64_t hash) const;
+    int locationOf(UniformName name) const;
 };
 
 #endif
@@ -22,13 +22,17 @@ public:
     void SetLightingShaderType(LightingShaderType type);
     LightingShaderType GetLightingShaderType() const;
     Shader* GetCurrentLightingShader();
+    Shader* GetCurrentInstancedLightingShader(); // Variante instanciée (voir InstanceBuffer)
     
     // Accès aux autres shaders
     Shader* GetSimpleShader();
     Shader* GetTexturedShader();
     Shader* GetSunShader();
+    Shader* GetParticleShader(); // Sprites face caméra (voir ParticleRenderer)
+    Shader* GetTrailShader();    // Rubans des traînées (voir TrailRenderer)
     Shader* GetMetalShader();
     Shader* GetSkyboxShader();
+    Shader* GetCullInstancesShader(); // Compute shader du GpuCuller, nullptr sans GL 4.3
     
     // Variables globales pour l'interface
     bool& GetShowShaderSelector() { return showShaderSelector; }
@@ -42,13 +46,18 @@ private:
     // Shaders d'éclairage
     std::unique_ptr<Shader> phongShader;
     std::unique_ptr<Shader> lambertShader;
+    std::unique_ptr<Shader> phongInstancedShader;
+    std::unique_ptr<Shader> lambertInstancedShader;
     
     // Autres shaders
     std::unique_ptr<Shader> simpleShader;
     std::unique_ptr<Shader> texturedShader;
     std::unique_ptr<Shader> sunShader;
+    std::unique_ptr<Shader> particleShader;
+    std::unique_ptr<Shader> trailShader;
     std::unique_ptr<Shader> metalShader;
     std::unique_ptr<Shader> skyboxShader;
+    std::unique_ptr<Shader> cullInstancesShader;
     
     LightingShaderType currentLightingShader = LightingShaderType::PHONG;
     bool initialized = false;
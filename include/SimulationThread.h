@@ -0,0 +1,80 @@
+#ifndef SIMULATION_THREAD_H
+#define SIMULATION_THREAD_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <thread>
+
+class SceneManager;
+
+/**
+ * @brief Simulation des scènes à pas fixe, sur un thread dédié
+ *
+ * Le thread appelle SceneManager::Simulate à cadence constante (rate pas par
+ * seconde), indépendamment du rendu : une mise à jour coûteuse ne ralentit
+ * plus l'affichage, et le rendu lit les instantanés publiés à chaque pas
+ * (voir SnapshotBuffer). Chaque pas est daté de l'instant qu'il atteint sur
+ * l'horloge Now, commune aux deux threads.
+ *
+ * Si la simulation prend du retard (pas plus longs que leur durée), le temps
+ * perdu au-delà de quelques pas est abandonné plutôt que rattrapé.
+ *
+ * Sans thread (Start avec une cadence nulle), la boucle principale appelle
+ * elle-même SceneManager::Simulate avec le pas variable de la frame.
+ */
+class SimulationThread {
+public:
+    static SimulationThread& getInstance();
+
+    static constexpr double DEFAULT_RATE = 60.0;
+
+    /**
+     * @brief Démarre la simulation de scenes à rateHz pas par seconde
+     * @param rateHz Cadence, 0 pour rester sur le thread principal
+     */
+    void Start(SceneManager& scenes, double rateHz);
+
+    /**
+     * @brief Termine le pas en cours et arrête le thread ; appelé aussi par le destructeur
+     */
+    void Stop();
+
+    bool IsRunning() const { return thread.joinable(); }
+
+    // Cadence en pas par seconde, appliquée dès le pas suivant
+    void SetRate(double rateHz);
+    double GetRate() const { return rate.load(); }
+
+    // Pas effectués, durée du dernier pas et pas abandonnés faute de temps
+    size_t GetStepCount() const { return stepCount.load(); }
+    double GetLastStepMs() const { return lastStepMs.load(); }
+    size_t GetDroppedStepCount() const { return droppedStepCount.load(); }
+
+    /**
+     * @brief Horloge commune à la simulation et au rendu, en secondes
+     */
+    static double Now();
+
+private:
+    SimulationThread() = default;
+    ~SimulationThread();
+    SimulationThread(const SimulationThread&) = delete;
+    SimulationThread& operator=(const SimulationThread&) = delete;
+
+    void Run();
+
+    SceneManager* scenes = nullptr;
+    std::thread thread;
+    std::atomic<double> rate{DEFAULT_RATE};
+    std::atomic<size_t> stepCount{0};
+    std::atomic<double> lastStepMs{0.0};
+    std::atomic<size_t> droppedStepCount{0};
+
+    std::mutex sleepMutex;
+    std::condition_variable wake;  // Réveille le thread pour l'arrêter
+    bool stopping = false;
+};
+
+#endif // SIMULATION_THREAD_H
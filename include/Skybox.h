@@ -7,23 +7,44 @@
 #include <glm/glm.hpp>
 #include <memory>
 #include "Shader.h"
+#include "TextureCompressor.h"
 
 class Skybox {
 public:
     // Constructeur : charge les faces et initialise le VAO/VBO
-    Skybox(const std::vector<std::string>& faces);
+    // (streamed : faces décodées par l'AssetLoader, cubemap unie en attendant)
+    Skybox(const std::vector<std::string>& faces, bool streamed = false);
     ~Skybox();
 
+    Skybox(const Skybox&) = delete;
+    Skybox& operator=(const Skybox&) = delete;
+
     // Render : view should have translation removed, projection usual
     void Render(const glm::mat4& view, const glm::mat4& projection);
 
+    // État du chargement des faces
+    bool IsLoaded() const { return loaded; }
+
 private:
     unsigned int skyboxVAO, skyboxVBO;
     unsigned int cubemapTexture;
-    std::unique_ptr<Shader> shader;
+    Shader* shader = nullptr;                   // Appartient au ShaderManager
+    UniformHandle<glm::mat4> viewUniform;       // Résolus une fois à la construction
+    UniformHandle<glm::mat4> projectionUniform;
+    bool loaded = true;
+    std::shared_ptr<int> streamToken;
 
     // Charge une cubemap à partir des 6 faces
     unsigned int LoadCubemap(const std::vector<std::string>& faces);
+
+    // Lit les faces compressées (cache KTX) si compress vaut true, les décode sinon ;
+    // images[i] n'est renseignée que si compressed[i] est invalide
+    static void DecodeFaces(const std::vector<std::string>& faces, bool compress,
+                            std::vector<CompressedImage>& compressed, std::vector<DecodedImage>& images);
+
+    // Envoie les faces décodées dans la cubemap existante
+    void UploadFaces(unsigned int textureID, const std::vector<std::string>& faces,
+                     const std::vector<CompressedImage>& compressed, const std::vector<DecodedImage>& images);
 };
 
 #endif // SKYBOX_H
@@ -0,0 +1,106 @@
+#ifndef SNAPSHOT_BUFFER_H
+#define SNAPSHOT_BUFFER_H
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+/**
+ * @brief Instantanés immuables d'un état simulé, partagés entre simulation et rendu
+ *
+ * Le thread de simulation remplit un instantané obtenu par Acquire puis le
+ * publie ; le thread de rendu lit les deux derniers publiés (Read) et mélange
+ * leurs états avec le coefficient renvoyé. Un instantané publié n'est plus
+ * jamais modifié : le rendu le lit sans verrou pendant que la simulation en
+ * remplit un autre. Les instantanés sont recyclés dès que plus personne ne
+ * les tient, si bien qu'après quelques pas il n'y a plus d'allocation.
+ *
+ * Les temps sont ceux de SimulationThread::Now : le temps d'un instantané est
+ * l'instant que représente son état.
+ */
+template <typename T>
+class SnapshotBuffer {
+public:
+    struct Snapshot {
+        T state;
+        double time = 0.0;
+    };
+
+    /**
+     * @brief Les deux derniers instantanés et la position de l'instant demandé entre eux
+     *
+     * previous vaut latest tant qu'un seul instantané a été publié ; alpha est
+     * ramené dans [0, 1] (0 : previous, 1 : latest).
+     */
+    struct View {
+        std::shared_ptr<const Snapshot> previous;
+        std::shared_ptr<const Snapshot> latest;
+        float alpha = 1.0f;
+    };
+
+    /**
+     * @brief Instantané à remplir (côté simulation), recyclé ou alloué
+     *
+     * Son contenu est celui d'un ancien état : à réécrire entièrement.
+     */
+    std::shared_ptr<Snapshot> Acquire() {
+        std::lock_guard<std::mutex> lock(mutex);
+        for (const std::shared_ptr<Snapshot>& snapshot : pool) {
+            // Tenu par la seule réserve : ni publié, ni en lecture. La barrière ordonne
+            // les dernières lectures du rendu avant la réécriture
+            if (snapshot.use_count() == 1) {
+                std::atomic_thread_fence(std::memory_order_acquire);
+                return snapshot;
+            }
+        }
+        pool.push_back(std::make_shared<Snapshot>());
+        return pool.back();
+    }
+
+    /**
+     * @brief Publie un instantané rempli ; il devient le plus récent
+     */
+    void Publish(std::shared_ptr<Snapshot> snapshot) {
+        std::lock_guard<std::mutex> lock(mutex);
+        previous = latest ? latest : snapshot;
+        latest = std::move(snapshot);
+    }
+
+    /**
+     * @brief Derniers instantanés, placés par rapport à time (côté rendu)
+     */
+    View Read(double time) const {
+        View view;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            view.previous = previous;
+            view.latest = latest;
+        }
+        if (view.latest) {
+            double span = view.latest->time - view.previous->time;
+            if (span > 0.0) {
+                view.alpha = static_cast<float>(std::clamp((time - view.previous->time) / span, 0.0, 1.0));
+            }
+        }
+        return view;
+    }
+
+    /**
+     * @brief Oublie les instantanés publiés (réinitialisation de l'état)
+     */
+    void Clear() {
+        std::lock_guard<std::mutex> lock(mutex);
+        previous.reset();
+        latest.reset();
+    }
+
+private:
+    mutable std::mutex mutex;
+    std::shared_ptr<const Snapshot> previous;
+    std::shared_ptr<const Snapshot> latest;
+    std::vector<std::shared_ptr<Snapshot>> pool; // Tous les instantanés créés
+};
+
+#endif // SNAPSHOT_BUFFER_H
@@ -0,0 +1,27 @@
+#ifndef SOURCE_STAMP_H
+#define SOURCE_STAMP_H
+
+#include <cstdint>
+#include <string>
+
+/**
+ * @brief Empreinte d'un fichier source, enregistrée dans les caches disque
+ *
+ * Un cache reste valide si la taille et la date de modification de la source
+ * sont inchangées ; si seule la date diffère (copie, checkout), le hachage
+ * FNV-1a du contenu tranche. Structure écrite telle quelle dans les en-têtes.
+ */
+struct SourceStamp
+{
+    uint64_t size = 0;
+    int64_t time = 0;
+    uint64_t hash = 0;
+
+    // Lit l'empreinte de la source (hachage compris) ; false si le fichier est illisible
+    static bool Read(const std::string &path, SourceStamp &stamp);
+
+    // Vérifie que la source correspond toujours à cette empreinte
+    bool Matches(const std::string &path) const;
+};
+
+#endif // SOURCE_STAMP_H
@@ -6,28 +6,51 @@
 #include <glm/gtc/constants.hpp>
 #include <vector>
 #include <string>
+#include <memory>
+#include "Bounds.h"
 #include "Mesh.h"
 #include "Shader.h"
-#include "TextureLoader.h"
+#include "RenderQueue.h"
+#include "TextureCache.h"
 
 class Sphere {
 public:
     // Constructeur avec paramètres pour la résolution de la sphère
     Sphere(float radius = 1.0f, unsigned int sectors = 36, unsigned int stacks = 18);
 
-    // Constructeur avec texture
-    Sphere(const std::string &texturePath, float radius = 1.0f, unsigned int sectors = 36, unsigned int stacks = 18);
+    // Constructeur avec texture, partagée via le TextureCache
+    // (streamed : décodage de la texture délégué à l'AssetLoader)
+    Sphere(const std::string &texturePath, float radius = 1.0f, unsigned int sectors = 36, unsigned int stacks = 18,
+           bool streamed = false);
 
     // Destructeur pour libérer la mémoire
     ~Sphere();
 
-    // Dessiner la sphère
+    Sphere(const Sphere&) = delete;
+    Sphere& operator=(const Sphere&) = delete;
+
+    // Dessiner la sphère (texture grise de substitution tant que la texture est en chargement)
     void Draw(const Shader &shader) const;
 
+    // Soumettre la sphère au RenderQueue (packet.mesh renseigné ici)
+    void Submit(RenderQueue &queue, DrawPacket packet) const;
+
+    // État du chargement de la texture
+    bool IsLoaded() const { return !texture || texture->loaded; }
+
+    // Volumes englobants locaux (centrés sur l'origine), pour le culling
+    const BoundingSphere &GetBoundingSphere() const { return boundingSphere; }
+    AABB GetBounds() const { return {glm::vec3(-boundingSphere.radius), glm::vec3(boundingSphere.radius)}; }
+
 private:
     // Pointeur vers le mesh de la sphère (pour éviter le problème de constructeur par défaut)
     Mesh* pMesh;
 
+    // Texture partagée, libérée avec le dernier handle
+    TextureHandle texture;
+
+    BoundingSphere boundingSphere;
+
     // Méthode pour générer la géométrie de la sphère
     void generateSphere(std::vector<Vertex> &vertices, std::vector<unsigned int> &indices,
                         float radius, unsigned int sectors, unsigned int stacks);
@@ -0,0 +1,67 @@
+#ifndef TEXTURE_CACHE_H
+#define TEXTURE_CACHE_H
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include "TextureCompressor.h"
+
+/**
+ * @brief Texture 2D partagée, détenue par le TextureCache
+ *
+ * La texture OpenGL est libérée lorsque le dernier handle est détruit.
+ * Tant que le décodage est en cours (mode streamed), id désigne la texture
+ * grise de substitution et loaded vaut false.
+ */
+struct CachedTexture {
+    unsigned int id = 0;     ///< Texture à lier pour le rendu
+    size_t gpuBytes = 0;     ///< Mémoire GPU estimée (chaîne de mipmaps comprise)
+    bool loaded = false;
+    std::string key;         ///< Chemin canonique + paramètres
+};
+
+using TextureHandle = std::shared_ptr<CachedTexture>;
+
+/**
+ * @brief Cache de textures 2D partagées, compté par références
+ *
+ * Les textures sont indexées par chemin canonique et paramètres de chargement :
+ * deux demandes identiques renvoient le même handle et un seul envoi GPU.
+ * Le cache ne garde que des références faibles ; une texture inutilisée est
+ * supprimée immédiatement. Si le contexte accepte le S3TC, les images passent
+ * par le cache compressé de TextureCompressor. À utiliser depuis le thread
+ * OpenGL uniquement.
+ */
+class TextureCache {
+public:
+    static TextureCache& getInstance();
+
+    /**
+     * @brief Renvoie la texture demandée, en la chargeant si nécessaire
+     * @param path Chemin de l'image
+     * @param params Paramètres d'échantillonnage (font partie de la clé)
+     * @param streamed Décodage délégué à l'AssetLoader, substitut gris en attendant
+     */
+    TextureHandle Load(const std::string& path, const TextureParams& params = TextureParams(), bool streamed = false);
+
+    size_t GetTextureCount() const { return entries.size(); }
+    size_t GetTotalBytes() const { return totalBytes; }
+
+private:
+    TextureCache() = default;
+    ~TextureCache() = default;
+    TextureCache(const TextureCache&) = delete;
+    TextureCache& operator=(const TextureCache&) = delete;
+
+    static std::string MakeKey(const std::string& path, const TextureParams& params);
+
+    void Upload(CachedTexture& texture, const CompressedImage& compressed, const DecodedImage& image,
+                const std::string& path, const TextureParams& params);
+    void Release(CachedTexture* texture);
+
+    std::unordered_map<std::string, std::weak_ptr<CachedTexture>> entries;
+    size_t totalBytes = 0;
+};
+
+#endif // TEXTURE_CACHE_H
@@ -0,0 +1,78 @@
+#ifndef TEXTURE_COMPRESSOR_H
+#define TEXTURE_COMPRESSOR_H
+
+#include <GL/glew.h>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+#include "TextureLoader.h"
+
+// Niveau de mipmap compressé (blocs 4x4 contigus, ligne de blocs par ligne de blocs)
+struct CompressedLevel
+{
+    int width = 0;
+    int height = 0;
+    const unsigned char *data = nullptr;
+    size_t size = 0;
+};
+
+// Image compressée par blocs, prête pour glCompressedTexImage2D
+struct CompressedImage
+{
+    GLenum internalFormat = 0; // GL_COMPRESSED_RGB_S3TC_DXT1_EXT ou GL_COMPRESSED_RGBA_S3TC_DXT5_EXT
+    int width = 0;
+    int height = 0;
+    std::vector<CompressedLevel> levels;
+    std::shared_ptr<const void> storage; // projection du cache ou blocs fraîchement encodés
+
+    bool IsValid() const { return !levels.empty(); }
+    size_t Size() const;
+};
+
+/**
+ * @brief Transcodage des textures en formats compressés par blocs, avec cache disque
+ *
+ * Les images RGB sont encodées en BC1 (DXT1), les images RGBA en BC3 (DXT5),
+ * avec leur chaîne de mipmaps précalculée (filtre boîte). Le résultat est
+ * écrit dans "<source>.ktx" (KTX 1.1, empreinte de la source dans les
+ * métadonnées) ; aux lancements suivants, les blocs sont lus directement
+ * depuis la projection du fichier, sans décodage PNG/JPEG.
+ *
+ * Les images à 1 ou 2 composantes ne sont pas compressées.
+ */
+class TextureCompressor
+{
+public:
+    static const uint32_t VERSION = 1;
+
+    // Le contexte OpenGL accepte-t-il les formats S3TC (à appeler sur le thread OpenGL)
+    static bool IsSupported();
+
+    // Chemin du cache associé à une image source
+    static std::string GetCachePath(const std::string &sourcePath);
+
+    /**
+     * @brief Charge une image compressée, depuis le cache ou en transcodant la source
+     *
+     * Utilisable depuis un thread de travail (aucun appel OpenGL).
+     * @param mipmaps Chaîne de mipmaps complète ou niveau 0 seul
+     * @param compressed Image compressée, si la source s'y prête
+     * @param decoded Image décodée, renseignée seulement si compressed est invalide
+     * @return true si compressed est valide
+     */
+    static bool Load(const std::string &sourcePath, bool mipmaps, CompressedImage &compressed, DecodedImage &decoded);
+
+    // Encode une image 3 ou 4 composantes (image invalide sinon)
+    static CompressedImage Compress(const DecodedImage &image, bool mipmaps);
+
+    // Lit et valide le cache ; false s'il est absent, corrompu ou périmé
+    static bool ReadCache(const std::string &sourcePath, bool mipmaps, CompressedImage &image);
+    static bool WriteCache(const std::string &sourcePath, const CompressedImage &image);
+
+    // Envoie tous les niveaux dans la cible liée (GL_TEXTURE_2D ou une face de cubemap)
+    static void Upload(GLenum target, const CompressedImage &image);
+};
+
+#endif // TEXTURE_COMPRESSOR_H
@@ -2,10 +2,41 @@
 #define TEXTURE_LOADER_H
 
 #include <GL/glew.h>
+#include <memory>
 #include <string>
 #include <iostream>
 
-// Fonction utilitaire pour charger une texture
+// Image décodée en mémoire, prête à être envoyée au GPU
+struct DecodedImage
+{
+    int width = 0;
+    int height = 0;
+    int components = 0;
+    std::shared_ptr<unsigned char> pixels; // libéré par stbi_image_free
+
+    bool IsValid() const { return pixels != nullptr; }
+    size_t Size() const { return static_cast<size_t>(width) * height * components; }
+};
+
+// Paramètres d'échantillonnage appliqués à l'envoi d'une texture 2D
+struct TextureParams
+{
+    GLint wrap = GL_REPEAT;
+    bool mipmaps = true;
+};
+
+// Décode une image depuis le disque (sans appel OpenGL, utilisable depuis un thread de travail)
+DecodedImage decodeImage(const char* path);
+
+// Envoie une image décodée dans une texture 2D (créée si textureID vaut 0)
+unsigned int uploadTexture(const DecodedImage& image, const char* path, unsigned int textureID = 0,
+                           const TextureParams& params = TextureParams());
+
+// Fonction utilitaire pour charger une texture (l'appelant libère la texture ;
+// préférer TextureCache pour les textures partagées)
 unsigned int loadTexture(const char* path);
 
+// Texture 1x1 grise partagée, affichée tant qu'une texture est en chargement
+unsigned int getPlaceholderTexture();
+
 #endif
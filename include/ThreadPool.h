@@ -0,0 +1,63 @@
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief Pool de threads de travail exécutant des tâches dans l'ordre de soumission
+ *
+ * Les tâches ne doivent faire aucun appel OpenGL : le contexte n'est courant
+ * que sur le thread principal. À la destruction, les tâches encore en file
+ * sont abandonnées et celles en cours d'exécution sont attendues.
+ */
+class ThreadPool {
+public:
+    /**
+     * @brief Démarre les threads
+     * @param threadCount Nombre de threads, 0 pour hardware_concurrency() - 1 (au moins 1)
+     */
+    explicit ThreadPool(unsigned int threadCount = 0);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    /**
+     * @brief Ajoute une tâche à la file
+     */
+    void Submit(std::function<void()> task);
+
+    /**
+     * @brief Exécute body(i) pour i dans [0, count) sur les threads du pool
+     *
+     * Le thread appelant traite lui aussi des indices et ne revient qu'une fois
+     * tous terminés : l'appel est donc possible depuis une tâche du pool, même
+     * si tous les autres threads sont occupés.
+     */
+    void ParallelFor(size_t count, const std::function<void(size_t)>& body);
+
+    /**
+     * @brief Bloque jusqu'à ce que la file soit vide et toutes les tâches terminées
+     */
+    void WaitIdle();
+
+    unsigned int GetThreadCount() const { return static_cast<unsigned int>(workers.size()); }
+
+private:
+    std::vector<std::thread> workers;
+    std::deque<std::function<void()>> tasks;
+    std::mutex mutex;
+    std::condition_variable taskAvailable;
+    std::condition_variable idle;
+    unsigned int activeTasks = 0;
+    bool stopping = false;
+
+    void WorkerLoop();
+};
+
+#endif // THREAD_POOL_H
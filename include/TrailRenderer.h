@@ -0,0 +1,94 @@
+#ifndef TRAIL_RENDERER_H
+#define TRAIL_RENDERER_H
+
+#include <GL/glew.h>
+#include <glm/glm.hpp>
+#include <cstddef>
+#include <vector>
+
+/**
+ * @brief Traînées en rubans face caméra, stockées dans des anneaux de taille fixe
+ *
+ * Chaque traînée réserve capacity échantillons dans un même tableau : Push
+ * écrit le nouvel échantillon à la place du plus ancien, sans rien décaler.
+ * Le tableau entier est envoyé une fois par frame dans un texture buffer, et
+ * toutes les traînées sont dessinées en un seul appel instancié (une instance
+ * par traînée, deux sommets par échantillon). Le shader trail.vert relit
+ * l'anneau, oriente le ruban vers la caméra et calcule l'affinement et le
+ * fondu vers la queue.
+ *
+ * Push, SetHead et Reset ne touchent que la copie CPU et peuvent être appelés
+ * depuis une tâche du JobSystem ; Draw doit l'être sur le thread OpenGL.
+ */
+class TrailRenderer {
+public:
+    TrailRenderer() = default;
+    ~TrailRenderer();
+
+    TrailRenderer(const TrailRenderer&) = delete;
+    TrailRenderer& operator=(const TrailRenderer&) = delete;
+
+    /**
+     * @brief Réserve trailCount anneaux de capacity échantillons, tous vides
+     */
+    void Resize(size_t trailCount, size_t capacity);
+
+    /**
+     * @brief Vide une traînée et fixe la longueur de son anneau
+     * @param length Nombre d'échantillons conservés, ramené à la capacité
+     */
+    void Reset(size_t trail, const glm::vec3& position, size_t length);
+
+    /**
+     * @brief Ajoute un échantillon en tête, le plus ancien est écrasé si l'anneau est plein
+     */
+    void Push(size_t trail, const glm::vec3& position);
+
+    /**
+     * @brief Déplace l'échantillon le plus récent sans en ajouter (tête qui suit un objet entre deux échantillons)
+     */
+    void SetHead(size_t trail, const glm::vec3& position);
+
+    /**
+     * @brief Échantillon d'âge donné, 0 pour le plus récent ; age < nombre d'échantillons valides
+     */
+    glm::vec3 GetSample(size_t trail, size_t age) const;
+
+    /**
+     * @brief Couleur et demi-largeur du ruban à la tête
+     */
+    void SetStyle(size_t trail, const glm::vec3& color, float halfWidth);
+
+    /**
+     * @brief Envoie les anneaux et dessine toutes les traînées (shader trail déjà actif)
+     *
+     * Le mélange additif et la profondeur en lecture seule sont à la charge de l'appelant.
+     */
+    void Draw();
+
+    size_t GetTrailCount() const { return trails.size(); }
+    size_t GetCapacity() const { return capacity; }
+
+private:
+    // Attributs par instance, lus par trail.vert
+    struct Trail {
+        glm::vec4 style{0.0f};  // rgb : couleur, a : demi-largeur à la tête
+        GLint first = 0;        // Premier échantillon de l'anneau dans samples
+        GLint head = 0;         // Emplacement de l'échantillon le plus récent, relatif à first
+        GLint count = 0;        // Échantillons valides
+        GLint length = 1;       // Taille de l'anneau, <= capacity
+    };
+
+    void CreateBuffers();
+
+    std::vector<Trail> trails;
+    std::vector<glm::vec4> samples;           // trailCount * capacity positions (w inutilisé)
+    size_t capacity = 0;
+
+    GLuint vao = 0;
+    GLuint trailVBO = 0;
+    GLuint sampleBuffer = 0;
+    GLuint sampleTexture = 0;
+};
+
+#endif // TRAIL_RENDERER_H
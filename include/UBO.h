@@ -35,7 +35,8 @@ struct LightingUBO {
 enum UBOBindingPoints {
     CAMERA_UBO_BINDING = 0,
     TRANSFORM_UBO_BINDING = 1,
-    LIGHTING_UBO_BINDING = 2
+    LIGHTING_UBO_BINDING = 2,
+    CULL_PARAMS_UBO_BINDING = 3   // Paramètres du culling GPU (voir GpuCuller)
 };
 
 // Classe pour gérer les UBOs
@@ -48,9 +49,13 @@ public:
     bool Initialize();
     void Cleanup();
     
+    // Délimitation des frames pour l'anneau de transformations
+    void BeginFrame();
+    void EndFrame();
+    
     // Mise à jour des données
     void UpdateCameraUBO(const glm::mat4& projection, const glm::mat4& view, const glm::vec3& viewPos);
-    void UpdateTransformUBO(const glm::mat4& model);
+    void UpdateTransformUBO(const glm::mat4& model); // Nouvel emplacement de l'anneau à chaque appel
     void UpdateLightingUBO(const glm::vec3& lightPos, const glm::vec3& lightColor, 
                           const glm::vec3& ambientColor = glm::vec3(0.1f), 
                           float ambientStrength = 0.1f, 
@@ -70,11 +75,27 @@ private:
     GLuint transformUBO;
     GLuint lightingUBO;
     
+    // Anneau de transformations : une région de TRANSFORM_SLOTS_PER_FRAME emplacements
+    // alignés par frame, TRANSFORM_FRAME_COUNT régions protégées par des fences.
+    // Projection persistante si ARB_buffer_storage est disponible ; sinon une seule
+    // région, orphelinée à chaque frame. transformUBO sert de repli si la région déborde.
+    static const int TRANSFORM_FRAME_COUNT = 3;
+    static const size_t TRANSFORM_SLOTS_PER_FRAME = 4096;
+    GLuint transformRing;
+    unsigned char* transformRingData;   // nullptr en mode orphelinage
+    GLsync transformFences[TRANSFORM_FRAME_COUNT];
+    size_t transformSlotSize;
+    size_t transformSlot;               // Prochain emplacement de la région courante
+    int transformFrame;                 // Région courante
+    TransformUBO lastTransform;         // Reportée en début de frame
+    
     bool initialized;
     
     // Méthodes utilitaires privées
     bool CreateUBO(GLuint& ubo, size_t size, GLuint bindingPoint);
+    bool CreateTransformRing();
     void UpdateUBO(GLuint ubo, const void* data, size_t size);
+    void WriteTransform(const TransformUBO& data);
 };
 
 // Instance globale du gestionnaire UBO
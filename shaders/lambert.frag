@@ -3,6 +3,7 @@ out vec4 FragColor;
 
 in vec3 FragPos;
 in vec3 Normal;
+in vec3 Color; // objectColor, ou couleur de l'instance pour lambert_instanced.vert
 
 // UBO pour les données de caméra
 layout (std140) uniform CameraUBO {
@@ -21,8 +22,6 @@ layout (std140) uniform LightingUBO {
     float shininess;
 };
 
-uniform vec3 objectColor = vec3(0.8, 0.2, 0.6);
-
 void main()
 {
     // Ambient
@@ -35,6 +34,6 @@ void main()
     vec3 diffuse = diff * lightColor;
 
     // Pas de composante spéculaire dans Lambert
-    vec3 result = (ambient + diffuse) * objectColor;
+    vec3 result = (ambient + diffuse) * Color;
     FragColor = vec4(result, 1.0);
 }
@@ -16,12 +16,21 @@ layout (std140) uniform TransformUBO {
     mat4 normalMatrix;
 };
 
+// Déquantification des positions compressées (voir VertexFormat)
+uniform vec3 positionScale;
+uniform vec3 positionOffset;
+
+uniform vec3 objectColor = vec3(0.8, 0.2, 0.6);
+
 out vec3 FragPos;
 out vec3 Normal;
+out vec3 Color;
 
 void main()
 {
-    FragPos = vec3(model * vec4(aPos, 1.0));
+    vec3 position = aPos * positionScale + positionOffset;
+    FragPos = vec3(model * vec4(position, 1.0));
     Normal = mat3(normalMatrix) * aNormal;
+    Color = objectColor;
     gl_Position = projection * view * vec4(FragPos, 1.0);
 }
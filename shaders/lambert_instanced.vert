@@ -0,0 +1,33 @@
+#version 330 core
+
+layout (location = 0) in vec3 aPos;
+layout (location = 1) in vec3 aNormal;
+
+// Attributs par instance (glVertexAttribDivisor = 1, voir InstanceBuffer)
+layout (location = 3) in mat4 aInstanceModel;
+layout (location = 7) in vec4 aInstanceColor;
+
+// UBO pour les données de caméra
+layout (std140) uniform CameraUBO {
+    mat4 projection;
+    mat4 view;
+    vec3 viewPos;
+};
+
+// Déquantification des positions compressées (voir VertexFormat)
+uniform vec3 positionScale;
+uniform vec3 positionOffset;
+
+out vec3 FragPos;
+out vec3 Normal;
+out vec3 Color;
+
+void main()
+{
+    vec3 position = aPos * positionScale + positionOffset;
+    FragPos = vec3(aInstanceModel * vec4(position, 1.0));
+    // Instances à échelle uniforme : la partie 3x3 du modèle suffit, la normale est renormalisée ensuite
+    Normal = mat3(aInstanceModel) * aNormal;
+    Color = aInstanceColor.rgb;
+    gl_Position = projection * view * vec4(FragPos, 1.0);
+}
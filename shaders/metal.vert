@@ -17,13 +17,18 @@ layout (std140) uniform TransformUBO {
     mat4 normalMatrix;
 };
 
+// Déquantification des positions compressées (voir VertexFormat)
+uniform vec3 positionScale;
+uniform vec3 positionOffset;
+
 out vec3 FragPos;
 out vec3 Normal;
 out vec3 ViewDir;
 
 void main()
 {
-    FragPos = vec3(model * vec4(aPos, 1.0));
+    vec3 position = aPos * positionScale + positionOffset;
+    FragPos = vec3(model * vec4(position, 1.0));
     Normal = mat3(normalMatrix) * aNormal;
     
     // Calculer le vecteur de vue pour les effets
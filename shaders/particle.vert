@@ -0,0 +1,33 @@
+#version 330 core
+
+layout (location = 0) in vec2 aCorner;   // coin du quad, dans [-1, 1]
+layout (location = 1) in vec4 aParticle; // xyz : position monde, w : rayon (par instance)
+
+// UBO pour les données de caméra
+layout (std140) uniform CameraUBO {
+    mat4 projection;
+    mat4 view;
+    vec3 viewPos;
+};
+
+uniform float time;
+
+out vec2 Corner;
+out vec3 Center;
+out float Radius;
+out float Time;
+
+void main()
+{
+    // Axes droite/haut de la caméra en espace monde (lignes de la matrice de vue)
+    vec3 right = vec3(view[0][0], view[1][0], view[2][0]);
+    vec3 up = vec3(view[0][1], view[1][1], view[2][1]);
+
+    Corner = aCorner;
+    Center = aParticle.xyz;
+    Radius = abs(aParticle.w);
+    Time = time;
+
+    vec3 worldPos = Center + (right * aCorner.x + up * aCorner.y) * Radius;
+    gl_Position = projection * view * vec4(worldPos, 1.0);
+}
@@ -3,6 +3,7 @@ out vec4 FragColor;
 
 in vec3 FragPos;
 in vec3 Normal;
+in vec3 Color; // objectColor, ou couleur de l'instance pour phong_instanced.vert
 
 // UBO pour les données de caméra
 layout (std140) uniform CameraUBO {
@@ -21,8 +22,6 @@ layout (std140) uniform LightingUBO {
     float shininess;
 };
 
-uniform vec3 objectColor = vec3(1.0, 0.5, 0.3);
-
 void main()
 {
     // Ambient
@@ -40,6 +39,6 @@ void main()
     float spec = pow(max(dot(viewDir, reflectDir), 0.0), shininess);
     vec3 specular = specularStrength * spec * lightColor;
 
-    vec3 result = (ambient + diffuse + specular) * objectColor;
+    vec3 result = (ambient + diffuse + specular) * Color;
     FragColor = vec4(result, 1.0);
 }
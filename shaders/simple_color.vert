@@ -15,7 +15,12 @@ layout (std140) uniform TransformUBO {
     mat4 normalMatrix;
 };
 
+// Déquantification des positions compressées (voir VertexFormat)
+uniform vec3 positionScale;
+uniform vec3 positionOffset;
+
 void main()
 {
-    gl_Position = projection * view * model * vec4(aPos, 1.0);
+    vec3 position = aPos * positionScale + positionOffset;
+    gl_Position = projection * view * model * vec4(position, 1.0);
 }
@@ -17,6 +17,10 @@ layout (std140) uniform TransformUBO {
     mat4 normalMatrix;
 };
 
+// Déquantification des positions compressées (voir VertexFormat)
+uniform vec3 positionScale;
+uniform vec3 positionOffset;
+
 uniform float time;
 
 out vec3 FragPos;
@@ -25,10 +29,11 @@ out float Time;
 
 void main()
 {
+    vec3 position = aPos * positionScale + positionOffset;
     Time = time;
     
     // Calcul des positions et normales
-    FragPos = vec3(model * vec4(aPos, 1.0));
+    FragPos = vec3(model * vec4(position, 1.0));
     Normal = mat3(normalMatrix) * aNormal;
     
     gl_Position = projection * view * vec4(FragPos, 1.0);
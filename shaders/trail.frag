@@ -0,0 +1,16 @@
+#version 330 core
+out vec4 FragColor;
+
+in vec3 Color;
+in float Fade;
+in float Side;
+
+void main()
+{
+    //bords adoucis : opaque au centre du ruban, transparent sur les côtés
+    float edge = 1.0 - abs(Side);
+    float alpha = Fade * edge * edge;
+
+    //mélange additif, l'ordre des traînées n'importe pas
+    FragColor = vec4(Color, alpha);
+}
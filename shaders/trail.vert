@@ -0,0 +1,52 @@
+#version 330 core
+
+layout (location = 0) in vec4 aStyle; // rgb : couleur, a : demi-largeur à la tête (par instance)
+layout (location = 1) in ivec4 aRing; // premier échantillon, tête, échantillons valides, taille de l'anneau
+
+// UBO pour les données de caméra
+layout (std140) uniform CameraUBO {
+    mat4 projection;
+    mat4 view;
+    vec3 viewPos;
+};
+
+// Échantillons de toutes les traînées (voir TrailRenderer)
+uniform samplerBuffer samples;
+
+out vec3 Color;
+out float Fade;
+out float Side;
+
+// Échantillon d'âge donné : 0 pour le plus récent
+vec3 fetchSample(int age)
+{
+    int slot = (aRing.y - age + aRing.w) % aRing.w;
+    return texelFetch(samples, aRing.x + slot).xyz;
+}
+
+void main()
+{
+    // Deux sommets par échantillon, un de chaque côté du ruban
+    int age = gl_VertexID / 2;
+    Side = (gl_VertexID % 2 == 0) ? -1.0 : 1.0;
+
+    // Au-delà des échantillons valides, le ruban se replie sur le dernier (largeur nulle)
+    int lastAge = max(aRing.z - 1, 0);
+    int sampleAge = min(age, lastAge);
+    vec3 position = fetchSample(sampleAge);
+    vec3 tangent = fetchSample(max(sampleAge - 1, 0)) - fetchSample(min(sampleAge + 1, lastAge));
+
+    // Largeur perpendiculaire à la traînée et à la direction de la caméra
+    vec3 across = cross(tangent, viewPos - position);
+    float acrossLength = length(across);
+    across = acrossLength > 1e-6 ? across / acrossLength : vec3(0.0);
+
+    // 0 à la tête, 1 au bout de l'anneau : affinement et fondu vers la queue
+    float t = float(sampleAge) / float(max(aRing.w - 1, 1));
+    float width = age < aRing.z ? aStyle.a * (1.0 - t) : 0.0;
+
+    Color = aStyle.rgb;
+    Fade = (1.0 - t) * (1.0 - t);
+
+    gl_Position = projection * view * vec4(position + across * width * Side, 1.0);
+}
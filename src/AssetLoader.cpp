@@ -0,0 +1,111 @@
+#include "AssetLoader.h"
+
+#include <chrono>
+#include <iostream>
+
+AssetLoader& AssetLoader::getInstance() {
+    static AssetLoader instance;
+    return instance;
+}
+
+bool AssetLoader::Initialize(unsigned int workerCount) {
+    if (pool) {
+        return true;
+    }
+
+    pool = std::make_unique<ThreadPool>(workerCount);
+    std::cout << "AssetLoader initialisé avec " << pool->GetThreadCount() << " thread(s) de chargement" << std::endl;
+    return true;
+}
+
+void AssetLoader::Shutdown() {
+    // Le destructeur du pool attend les tâches en cours et abandonne les autres
+    pool.reset();
+
+    std::lock_guard<std::mutex> lock(readyMutex);
+    readyUploads.clear();
+    pendingCount = 0;
+}
+
+void AssetLoader::Submit(DecodeJob job) {
+    if (!pool) {
+        // Pas de threads : chargement bloquant immédiat
+        Upload upload = job();
+        if (upload.apply) {
+            upload.apply();
+        }
+        return;
+    }
+
+    pendingCount++;
+    pool->Submit([this, job]() {
+        Upload upload = job();
+        std::lock_guard<std::mutex> lock(readyMutex);
+        readyUploads.push_back(std::move(upload));
+    });
+}
+
+void AssetLoader::ParallelFor(size_t count, const std::function<void(size_t)>& body) {
+    if (!pool) {
+        for (size_t i = 0; i < count; i++) {
+            body(i);
+        }
+        return;
+    }
+    pool->ParallelFor(count, body);
+}
+
+void AssetLoader::SetUploadBudget(size_t bytesPerFrame, double msPerFrame) {
+    budgetBytes = bytesPerFrame;
+    budgetMs = msPerFrame;
+}
+
+size_t AssetLoader::ProcessUploads() {
+    auto start = std::chrono::steady_clock::now();
+    size_t applied = 0;
+    size_t bytes = 0;
+    double elapsedMs = 0.0;
+
+    while (elapsedMs < budgetMs) {
+        Upload upload;
+        {
+            std::lock_guard<std::mutex> lock(readyMutex);
+            if (readyUploads.empty()) {
+                break;
+            }
+            // Au moins un envoi par frame pour que les grosses ressources progressent
+            if (applied > 0 && bytes + readyUploads.front().bytes > budgetBytes) {
+                break;
+            }
+            upload = std::move(readyUploads.front());
+            readyUploads.pop_front();
+        }
+
+        if (upload.apply) {
+            upload.apply();
+        }
+        bytes += upload.bytes;
+        applied++;
+        pendingCount--;
+        elapsedMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    lastFrameBytes = bytes;
+    lastFrameMs = elapsedMs;
+    return applied;
+}
+
+void AssetLoader::Flush() {
+    if (!pool) {
+        return;
+    }
+
+    pool->WaitIdle();
+    size_t savedBytes = budgetBytes;
+    double savedMs = budgetMs;
+    budgetBytes = static_cast<size_t>(-1);
+    budgetMs = 1e9;
+    ProcessUploads();
+    budgetBytes = savedBytes;
+    budgetMs = savedMs;
+}
@@ -0,0 +1,118 @@
+#include "Bounds.h"
+
+#include <algorithm>
+#include <cmath>
+
+BoundingSphere BoundingSphere::Transformed(const glm::mat4& transform) const {
+    float scaleSq = std::max(glm::dot(glm::vec3(transform[0]), glm::vec3(transform[0])),
+                    std::max(glm::dot(glm::vec3(transform[1]), glm::vec3(transform[1])),
+                             glm::dot(glm::vec3(transform[2]), glm::vec3(transform[2]))));
+
+    BoundingSphere result;
+    result.center = glm::vec3(transform * glm::vec4(center, 1.0f));
+    result.radius = radius * std::sqrt(scaleSq);
+    return result;
+}
+
+Frustum Frustum::FromMatrix(const glm::mat4& viewProjection) {
+    // glm est en colonnes majeures : la ligne i est (m[0][i], m[1][i], m[2][i], m[3][i])
+    glm::vec4 rows[4];
+    for (int i = 0; i < 4; ++i) {
+        rows[i] = glm::vec4(viewProjection[0][i], viewProjection[1][i], viewProjection[2][i], viewProjection[3][i]);
+    }
+
+    Frustum frustum;
+    frustum.planes[0] = rows[3] + rows[0];
+    frustum.planes[1] = rows[3] - rows[0];
+    frustum.planes[2] = rows[3] + rows[1];
+    frustum.planes[3] = rows[3] - rows[1];
+    frustum.planes[4] = rows[3] + rows[2];
+    frustum.planes[5] = rows[3] - rows[2];
+
+    for (glm::vec4& plane : frustum.planes) {
+        plane /= glm::length(glm::vec3(plane));
+    }
+    return frustum;
+}
+
+bool Frustum::Intersects(const BoundingSphere& sphere) const {
+    for (const glm::vec4& plane : planes) {
+        if (glm::dot(glm::vec3(plane), sphere.center) + plane.w < -sphere.radius) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool Frustum::Intersects(const AABB& box) const {
+    // Sommet de la boîte le plus avancé dans la direction de chaque normale
+    for (const glm::vec4& plane : planes) {
+        glm::vec3 positive(plane.x >= 0.0f ? box.max.x : box.min.x,
+                           plane.y >= 0.0f ? box.max.y : box.min.y,
+                           plane.z >= 0.0f ? box.max.z : box.min.z);
+        if (glm::dot(glm::vec3(plane), positive) + plane.w < 0.0f) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void CullingBatch::Clear() {
+    xs.clear();
+    ys.clear();
+    zs.clear();
+    radii.clear();
+    visible.clear();
+    visibleCount = 0;
+}
+
+void CullingBatch::Reserve(size_t count) {
+    xs.reserve(count);
+    ys.reserve(count);
+    zs.reserve(count);
+    radii.reserve(count);
+    visible.reserve(count);
+}
+
+size_t CullingBatch::Add(const BoundingSphere& sphere) {
+    xs.push_back(sphere.center.x);
+    ys.push_back(sphere.center.y);
+    zs.push_back(sphere.center.z);
+    radii.push_back(sphere.radius);
+    return xs.size() - 1;
+}
+
+size_t CullingBatch::Run(const Frustum& frustum) {
+    size_t count = xs.size();
+    visible.resize(count);
+
+    // Coefficients copiés en locaux : le compilateur les garde en registres
+    float a[Frustum::PLANE_COUNT], b[Frustum::PLANE_COUNT], c[Frustum::PLANE_COUNT], d[Frustum::PLANE_COUNT];
+    for (int p = 0; p < Frustum::PLANE_COUNT; ++p) {
+        a[p] = frustum.planes[p].x;
+        b[p] = frustum.planes[p].y;
+        c[p] = frustum.planes[p].z;
+        d[p] = frustum.planes[p].w;
+    }
+
+    const float* x = xs.data();
+    const float* y = ys.data();
+    const float* z = zs.data();
+    const float* r = radii.data();
+    uint8_t* out = visible.data();
+
+    // Plus petite distance signée aux six plans, sans branchement
+    size_t visibleTotal = 0;
+    for (size_t i = 0; i < count; ++i) {
+        float minDistance = a[0] * x[i] + b[0] * y[i] + c[0] * z[i] + d[0];
+        for (int p = 1; p < Frustum::PLANE_COUNT; ++p) {
+            float distance = a[p] * x[i] + b[p] * y[i] + c[p] * z[i] + d[p];
+            minDistance = distance < minDistance ? distance : minDistance;
+        }
+        out[i] = static_cast<uint8_t>(minDistance + r[i] >= 0.0f);
+        visibleTotal += out[i];
+    }
+
+    visibleCount = visibleTotal;
+    return visibleCount;
+}
@@ -16,6 +16,11 @@ glm::mat4 Camera::GetViewMatrix() const
     return glm::lookAt(Position, Position + Front, Up);
 }
 
+Frustum Camera::GetFrustum(const glm::mat4 &projection) const
+{
+    return Frustum::FromMatrix(projection * GetViewMatrix());
+}
+
 void Camera::ProcessKeyboard(Camera_Movement direction, float deltaTime)
 {
     float velocity = MovementSpeed * deltaTime;
@@ -0,0 +1,214 @@
+#include "EntityKernels.h"
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define ENTITY_KERNELS_X86 1
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#endif
+
+// Les variantes vectorielles sont compilées pour leur jeu d'instructions seul ;
+// le reste du programme garde la cible de base
+#if defined(ENTITY_KERNELS_X86) && defined(__GNUC__)
+#define TARGET_SSE2 __attribute__((target("sse2")))
+#define TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define TARGET_SSE2
+#define TARGET_AVX2
+#endif
+
+namespace {
+    // === Scalaire (référence et fin des colonnes) ===
+
+    void integrateScalar(float* values, const float* rates, size_t count, float dt) {
+        for (size_t i = 0; i < count; ++i) {
+            values[i] += rates[i] * dt;
+        }
+    }
+
+    void integrateWrappedScalar(float* values, const float* rates, size_t count, float dt, float period) {
+        for (size_t i = 0; i < count; ++i) {
+            float value = values[i] + rates[i] * dt;
+            values[i] = value > period ? value - period : value;
+        }
+    }
+
+    void addScalar(float* values, size_t count, float step) {
+        for (size_t i = 0; i < count; ++i) {
+            values[i] += step;
+        }
+    }
+
+    void addWrappedScalar(float* values, size_t count, float step, float period) {
+        for (size_t i = 0; i < count; ++i) {
+            float value = values[i] + step;
+            values[i] = value > period ? value - period : value;
+        }
+    }
+
+#ifdef ENTITY_KERNELS_X86
+    // === SSE2 : 4 flottants par instruction ===
+
+    TARGET_SSE2 void integrateSSE2(float* values, const float* rates, size_t count, float dt) {
+        const __m128 step = _mm_set1_ps(dt);
+        size_t i = 0;
+        for (; i + 4 <= count; i += 4) {
+            __m128 value = _mm_add_ps(_mm_loadu_ps(values + i), _mm_mul_ps(_mm_loadu_ps(rates + i), step));
+            _mm_storeu_ps(values + i, value);
+        }
+        integrateScalar(values + i, rates + i, count - i, dt);
+    }
+
+    TARGET_SSE2 void integrateWrappedSSE2(float* values, const float* rates, size_t count, float dt, float period) {
+        const __m128 step = _mm_set1_ps(dt);
+        const __m128 bound = _mm_set1_ps(period);
+        size_t i = 0;
+        for (; i + 4 <= count; i += 4) {
+            __m128 value = _mm_add_ps(_mm_loadu_ps(values + i), _mm_mul_ps(_mm_loadu_ps(rates + i), step));
+            __m128 wrap = _mm_and_ps(_mm_cmpgt_ps(value, bound), bound);
+            _mm_storeu_ps(values + i, _mm_sub_ps(value, wrap));
+        }
+        integrateWrappedScalar(values + i, rates + i, count - i, dt, period);
+    }
+
+    TARGET_SSE2 void addSSE2(float* values, size_t count, float step) {
+        const __m128 increment = _mm_set1_ps(step);
+        size_t i = 0;
+        for (; i + 4 <= count; i += 4) {
+            _mm_storeu_ps(values + i, _mm_add_ps(_mm_loadu_ps(values + i), increment));
+        }
+        addScalar(values + i, count - i, step);
+    }
+
+    TARGET_SSE2 void addWrappedSSE2(float* values, size_t count, float step, float period) {
+        const __m128 increment = _mm_set1_ps(step);
+        const __m128 bound = _mm_set1_ps(period);
+        size_t i = 0;
+        for (; i + 4 <= count; i += 4) {
+            __m128 value = _mm_add_ps(_mm_loadu_ps(values + i), increment);
+            __m128 wrap = _mm_and_ps(_mm_cmpgt_ps(value, bound), bound);
+            _mm_storeu_ps(values + i, _mm_sub_ps(value, wrap));
+        }
+        addWrappedScalar(values + i, count - i, step, period);
+    }
+
+    // === AVX2 : 8 flottants par instruction ===
+
+    TARGET_AVX2 void integrateAVX2(float* values, const float* rates, size_t count, float dt) {
+        const __m256 step = _mm256_set1_ps(dt);
+        size_t i = 0;
+        for (; i + 8 <= count; i += 8) {
+            __m256 value = _mm256_add_ps(_mm256_loadu_ps(values + i), _mm256_mul_ps(_mm256_loadu_ps(rates + i), step));
+            _mm256_storeu_ps(values + i, value);
+        }
+        integrateScalar(values + i, rates + i, count - i, dt);
+    }
+
+    TARGET_AVX2 void integrateWrappedAVX2(float* values, const float* rates, size_t count, float dt, float period) {
+        const __m256 step = _mm256_set1_ps(dt);
+        const __m256 bound = _mm256_set1_ps(period);
+        size_t i = 0;
+        for (; i + 8 <= count; i += 8) {
+            __m256 value = _mm256_add_ps(_mm256_loadu_ps(values + i), _mm256_mul_ps(_mm256_loadu_ps(rates + i), step));
+            __m256 wrap = _mm256_and_ps(_mm256_cmp_ps(value, bound, _CMP_GT_OQ), bound);
+            _mm256_storeu_ps(values + i, _mm256_sub_ps(value, wrap));
+        }
+        integrateWrappedScalar(values + i, rates + i, count - i, dt, period);
+    }
+
+    TARGET_AVX2 void addAVX2(float* values, size_t count, float step) {
+        const __m256 increment = _mm256_set1_ps(step);
+        size_t i = 0;
+        for (; i + 8 <= count; i += 8) {
+            _mm256_storeu_ps(values + i, _mm256_add_ps(_mm256_loadu_ps(values + i), increment));
+        }
+        addScalar(values + i, count - i, step);
+    }
+
+    TARGET_AVX2 void addWrappedAVX2(float* values, size_t count, float step, float period) {
+        const __m256 increment = _mm256_set1_ps(step);
+        const __m256 bound = _mm256_set1_ps(period);
+        size_t i = 0;
+        for (; i + 8 <= count; i += 8) {
+            __m256 value = _mm256_add_ps(_mm256_loadu_ps(values + i), increment);
+            __m256 wrap = _mm256_and_ps(_mm256_cmp_ps(value, bound, _CMP_GT_OQ), bound);
+            _mm256_storeu_ps(values + i, _mm256_sub_ps(value, wrap));
+        }
+        addWrappedScalar(values + i, count - i, step, period);
+    }
+#endif
+
+    const EntityKernels SCALAR_KERNELS = {
+        integrateScalar, integrateWrappedScalar, addScalar, addWrappedScalar, SimdLevel::Scalar
+    };
+#ifdef ENTITY_KERNELS_X86
+    const EntityKernels SSE2_KERNELS = {
+        integrateSSE2, integrateWrappedSSE2, addSSE2, addWrappedSSE2, SimdLevel::SSE2
+    };
+    const EntityKernels AVX2_KERNELS = {
+        integrateAVX2, integrateWrappedAVX2, addAVX2, addWrappedAVX2, SimdLevel::AVX2
+    };
+#endif
+}
+
+SimdLevel EntityKernels::DetectLevel() {
+#if defined(ENTITY_KERNELS_X86) && defined(__GNUC__)
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+        return SimdLevel::AVX2;
+    }
+    if (__builtin_cpu_supports("sse2")) {
+        return SimdLevel::SSE2;
+    }
+#elif defined(ENTITY_KERNELS_X86) && defined(_MSC_VER)
+    int info[4];
+    __cpuid(info, 0);
+    int maxLeaf = info[0];
+    __cpuid(info, 1);
+    bool sse2 = (info[3] & (1 << 26)) != 0;
+    bool osxsave = (info[2] & (1 << 27)) != 0;
+    bool avx = (info[2] & (1 << 28)) != 0;
+
+    // AVX2 utilisable seulement si le système sauvegarde les registres YMM
+    if (maxLeaf >= 7 && osxsave && avx && (_xgetbv(0) & 0x6) == 0x6) {
+        __cpuidex(info, 7, 0);
+        if (info[1] & (1 << 5)) {
+            return SimdLevel::AVX2;
+        }
+    }
+    if (sse2) {
+        return SimdLevel::SSE2;
+    }
+#endif
+    return SimdLevel::Scalar;
+}
+
+const EntityKernels& EntityKernels::Get() {
+    static const EntityKernels& kernels = Get(DetectLevel());
+    return kernels;
+}
+
+const EntityKernels& EntityKernels::Get(SimdLevel level) {
+#ifdef ENTITY_KERNELS_X86
+    static const SimdLevel available = DetectLevel();
+    if (level > available) {
+        level = available;
+    }
+    if (level == SimdLevel::AVX2) {
+        return AVX2_KERNELS;
+    }
+    if (level == SimdLevel::SSE2) {
+        return SSE2_KERNELS;
+    }
+#endif
+    return SCALAR_KERNELS;
+}
+
+const char* EntityKernels::GetLevelName(SimdLevel level) {
+    switch (level) {
+        case SimdLevel::AVX2: return "AVX2";
+        case SimdLevel::SSE2: return "SSE2";
+        default: return "scalaire";
+    }
+}
@@ -0,0 +1,314 @@
+#include "GeometryBuffer.h"
+#include "InstanceBuffer.h"
+#include "Mesh.h"
+
+#include <algorithm>
+#include <iostream>
+
+namespace {
+    // Capacités de départ : de quoi contenir les modèles et sphères des deux scènes
+    const size_t INITIAL_VERTEX_BYTES = 4 * 1024 * 1024;
+    const size_t INITIAL_INDEX_COUNT = 1024 * 1024;
+
+    static_assert(static_cast<int>(VertexFormat::PackedUnorm16) + 1 == GeometryBuffer::FORMAT_COUNT,
+                  "GeometryBuffer::FORMAT_COUNT doit suivre VertexFormat");
+    static_assert(GeometryBuffer::VERTEX_ALIGNMENT % sizeof(Vertex) == 0 &&
+                  GeometryBuffer::VERTEX_ALIGNMENT % sizeof(PackedVertex) == 0,
+                  "Les plages de sommets doivent commencer sur un sommet entier");
+}
+
+GeometryRange::~GeometryRange() {
+    if (allocated) {
+        GeometryBuffer::getInstance().Free(*this);
+    }
+}
+
+GeometryRange::GeometryRange(GeometryRange&& other) noexcept
+    : vertexOffset(other.vertexOffset), vertexBytes(other.vertexBytes), firstIndex(other.firstIndex),
+      indexCount(other.indexCount), baseVertex(other.baseVertex), allocated(other.allocated) {
+    other.allocated = false;
+}
+
+GeometryRange& GeometryRange::operator=(GeometryRange&& other) noexcept {
+    if (this != &other) {
+        if (allocated) {
+            GeometryBuffer::getInstance().Free(*this);
+        }
+        vertexOffset = other.vertexOffset;
+        vertexBytes = other.vertexBytes;
+        firstIndex = other.firstIndex;
+        indexCount = other.indexCount;
+        baseVertex = other.baseVertex;
+        allocated = other.allocated;
+        other.allocated = false;
+    }
+    return *this;
+}
+
+GeometryBuffer& GeometryBuffer::getInstance() {
+    static GeometryBuffer instance;
+    return instance;
+}
+
+bool GeometryBuffer::FreeList::Allocate(size_t size, size_t alignment, size_t& offset) {
+    // Premier bloc libre assez grand une fois le début aligné
+    for (size_t i = 0; i < blocks.size(); ++i) {
+        Block& block = blocks[i];
+        size_t start = (block.offset + alignment - 1) / alignment * alignment;
+        size_t blockEnd = block.offset + block.size;
+        if (start + size > blockEnd) {
+            continue;
+        }
+
+        size_t end = start + size;
+        if (start > block.offset) {
+            // Le remplissage d'alignement reste libre devant la plage
+            block.size = start - block.offset;
+            if (end < blockEnd) {
+                blocks.insert(blocks.begin() + i + 1, Block{end, blockEnd - end});
+            }
+        } else if (end < blockEnd) {
+            block.offset = end;
+            block.size = blockEnd - end;
+        } else {
+            blocks.erase(blocks.begin() + i);
+        }
+
+        used += size;
+        offset = start;
+        return true;
+    }
+    return false;
+}
+
+void GeometryBuffer::FreeList::Free(size_t offset, size_t size) {
+    auto next = std::lower_bound(blocks.begin(), blocks.end(), offset,
+                                 [](const Block& block, size_t value) { return block.offset < value; });
+    auto inserted = blocks.insert(next, Block{offset, size});
+    used -= size;
+
+    // Fusion avec le bloc suivant puis avec le précédent
+    auto following = inserted + 1;
+    if (following != blocks.end() && inserted->offset + inserted->size == following->offset) {
+        inserted->size += following->size;
+        blocks.erase(following);
+    }
+    if (inserted != blocks.begin()) {
+        auto previous = inserted - 1;
+        if (previous->offset + previous->size == inserted->offset) {
+            previous->size += inserted->size;
+            blocks.erase(inserted);
+        }
+    }
+}
+
+void GeometryBuffer::FreeList::Grow(size_t newCapacity) {
+    size_t added = newCapacity - capacity;
+    if (!blocks.empty() && blocks.back().offset + blocks.back().size == capacity) {
+        blocks.back().size += added;
+    } else {
+        blocks.push_back(Block{capacity, added});
+    }
+    capacity = newCapacity;
+}
+
+void GeometryBuffer::Reserve(GLuint& buffer, FreeList& space, size_t unitSize, size_t required) {
+    size_t newCapacity = std::max(space.capacity * 2, space.capacity + required);
+
+    // Les cibles de copie ne touchent pas à l'état du VAO courant
+    GLuint newBuffer = 0;
+    glGenBuffers(1, &newBuffer);
+    glBindBuffer(GL_COPY_WRITE_BUFFER, newBuffer);
+    glBufferData(GL_COPY_WRITE_BUFFER, newCapacity * unitSize, nullptr, GL_STATIC_DRAW);
+    if (buffer != 0) {
+        glBindBuffer(GL_COPY_READ_BUFFER, buffer);
+        glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, 0, 0, space.capacity * unitSize);
+        glBindBuffer(GL_COPY_READ_BUFFER, 0);
+        glDeleteBuffers(1, &buffer);
+        std::cout << "GeometryBuffer: buffer agrandi à " << newCapacity * unitSize / (1024.0 * 1024.0) << " Mo" << std::endl;
+    }
+    glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+
+    buffer = newBuffer;
+    space.Grow(newCapacity);
+
+    // Les VAO déjà créés pointent encore sur l'ancien buffer
+    for (int format = 0; format < FORMAT_COUNT; ++format) {
+        if (vertexArrays[format] != 0) {
+            SetupVertexArray(format);
+        }
+    }
+}
+
+GeometryRange GeometryBuffer::Allocate(const void* vertexData, size_t vertexCount, size_t stride,
+                                       const unsigned int* indexData, size_t indexCount) {
+    GeometryRange range;
+    range.vertexBytes = vertexCount * stride;
+    range.indexCount = indexCount;
+
+    if (range.vertexBytes > 0 && !vertexSpace.Allocate(range.vertexBytes, VERTEX_ALIGNMENT, range.vertexOffset)) {
+        Reserve(vertexBuffer, vertexSpace, 1, std::max(range.vertexBytes + VERTEX_ALIGNMENT, INITIAL_VERTEX_BYTES));
+        vertexSpace.Allocate(range.vertexBytes, VERTEX_ALIGNMENT, range.vertexOffset);
+    }
+    if (indexCount > 0 && !indexSpace.Allocate(indexCount, 1, range.firstIndex)) {
+        Reserve(indexBuffer, indexSpace, sizeof(unsigned int), std::max(indexCount, INITIAL_INDEX_COUNT));
+        indexSpace.Allocate(indexCount, 1, range.firstIndex);
+    }
+    range.baseVertex = static_cast<GLint>(range.vertexOffset / stride);
+    range.allocated = true;
+    rangeCount++;
+
+    if (range.vertexBytes > 0) {
+        glBindBuffer(GL_COPY_WRITE_BUFFER, vertexBuffer);
+        glBufferSubData(GL_COPY_WRITE_BUFFER, range.vertexOffset, range.vertexBytes, vertexData);
+    }
+    if (indexCount > 0) {
+        glBindBuffer(GL_COPY_WRITE_BUFFER, indexBuffer);
+        glBufferSubData(GL_COPY_WRITE_BUFFER, range.firstIndex * sizeof(unsigned int),
+                        indexCount * sizeof(unsigned int), indexData);
+    }
+    glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+    return range;
+}
+
+void GeometryBuffer::Free(GeometryRange& range) {
+    if (range.vertexBytes > 0) {
+        vertexSpace.Free(range.vertexOffset, range.vertexBytes);
+    }
+    if (range.indexCount > 0) {
+        indexSpace.Free(range.firstIndex, range.indexCount);
+    }
+    range.allocated = false;
+    rangeCount--;
+}
+
+GLuint GeometryBuffer::GetVertexArray(VertexFormat format) {
+    int index = static_cast<int>(format);
+    if (vertexArrays[index] == 0) {
+        // Un VAO sans buffer ne peut pas recevoir de pointeurs d'attributs
+        if (vertexBuffer == 0) {
+            Reserve(vertexBuffer, vertexSpace, 1, INITIAL_VERTEX_BYTES);
+        }
+        if (indexBuffer == 0) {
+            Reserve(indexBuffer, indexSpace, sizeof(unsigned int), INITIAL_INDEX_COUNT);
+        }
+        glGenVertexArrays(1, &vertexArrays[index]);
+        SetupVertexArray(index);
+    }
+    return vertexArrays[index];
+}
+
+void GeometryBuffer::SetupVertexArray(int format) {
+    glBindVertexArray(vertexArrays[format]);
+    glBindBuffer(GL_ARRAY_BUFFER, vertexBuffer);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, indexBuffer);
+
+    glEnableVertexAttribArray(0);
+    glEnableVertexAttribArray(1);
+    glEnableVertexAttribArray(2);
+    if (static_cast<VertexFormat>(format) == VertexFormat::Float) {
+        // Position
+        glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)0);
+        // Normale
+        glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, Normal));
+        // Coordonnées de texture
+        glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, TexCoords));
+    } else {
+        // Position : demi-flottants ou entiers 16 bits normalisés
+        if (static_cast<VertexFormat>(format) == VertexFormat::PackedUnorm16) {
+            glVertexAttribPointer(0, 3, GL_UNSIGNED_SHORT, GL_TRUE, sizeof(PackedVertex), (void*)offsetof(PackedVertex, Position));
+        } else {
+            glVertexAttribPointer(0, 3, GL_HALF_FLOAT, GL_FALSE, sizeof(PackedVertex), (void*)offsetof(PackedVertex, Position));
+        }
+        // Normale : 10 bits signés normalisés par composante (le shader n'en lit que xyz)
+        glVertexAttribPointer(1, 4, GL_INT_2_10_10_10_REV, GL_TRUE, sizeof(PackedVertex), (void*)offsetof(PackedVertex, Normal));
+        // Coordonnées de texture
+        glVertexAttribPointer(2, 2, GL_HALF_FLOAT, GL_FALSE, sizeof(PackedVertex), (void*)offsetof(PackedVertex, TexCoords));
+    }
+
+    glBindVertexArray(0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+}
+
+bool GeometryBuffer::IsIndirectSupported() const {
+    return GLEW_VERSION_4_3 || (GLEW_ARB_multi_draw_indirect && (GLEW_VERSION_4_2 || GLEW_ARB_base_instance));
+}
+
+void GeometryBuffer::Draw(const DrawElementsIndirectCommand* commands, size_t count, const InstanceBuffer* instances) {
+    if (count == 0) {
+        return;
+    }
+
+    if (IsIndirectSupported()) {
+        if (indirectBuffer == 0) {
+            glGenBuffers(1, &indirectBuffer);
+        }
+        glBindBuffer(GL_DRAW_INDIRECT_BUFFER, indirectBuffer);
+
+        // Orphelinage à chaque appel, comme InstanceBuffer
+        if (count > indirectCapacity) {
+            indirectCapacity = std::max(count, indirectCapacity * 2);
+        }
+        glBufferData(GL_DRAW_INDIRECT_BUFFER, indirectCapacity * sizeof(DrawElementsIndirectCommand), nullptr, GL_STREAM_DRAW);
+        glBufferSubData(GL_DRAW_INDIRECT_BUFFER, 0, count * sizeof(DrawElementsIndirectCommand), commands);
+        DrawIndirect(indirectBuffer, count, instances);
+        return;
+    }
+
+    if (instances) {
+        // Sans baseInstance, le décalage passe par les pointeurs d'attributs : un tirage par commande
+        for (size_t i = 0; i < count; ++i) {
+            const DrawElementsIndirectCommand& command = commands[i];
+            if (command.instanceCount == 0) {
+                continue;
+            }
+            instances->BindAttributes(command.baseInstance);
+            glDrawElementsInstancedBaseVertex(GL_TRIANGLES, command.count, GL_UNSIGNED_INT,
+                                              (void*)(command.firstIndex * sizeof(unsigned int)),
+                                              command.instanceCount, command.baseVertex);
+        }
+        InstanceBuffer::UnbindAttributes();
+        return;
+    }
+
+    counts.resize(count);
+    offsets.resize(count);
+    baseVertices.resize(count);
+    for (size_t i = 0; i < count; ++i) {
+        counts[i] = static_cast<GLsizei>(commands[i].count);
+        offsets[i] = (const void*)(commands[i].firstIndex * sizeof(unsigned int));
+        baseVertices[i] = commands[i].baseVertex;
+    }
+    glMultiDrawElementsBaseVertex(GL_TRIANGLES, counts.data(), GL_UNSIGNED_INT, offsets.data(),
+                                  static_cast<GLsizei>(count), baseVertices.data());
+}
+
+void GeometryBuffer::DrawIndirect(GLuint commandBuffer, size_t count, const InstanceBuffer* instances) {
+    glBindBuffer(GL_DRAW_INDIRECT_BUFFER, commandBuffer);
+
+    // baseInstance décale la lecture des attributs d'instance
+    if (instances) {
+        instances->BindAttributes(0);
+    }
+    glMultiDrawElementsIndirect(GL_TRIANGLES, GL_UNSIGNED_INT, nullptr, static_cast<GLsizei>(count), 0);
+    if (instances) {
+        InstanceBuffer::UnbindAttributes();
+    }
+    glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0);
+}
+
+void GeometryBuffer::Cleanup() {
+    for (GLuint& vao : vertexArrays) {
+        if (vao != 0) {
+            glDeleteVertexArrays(1, &vao);
+            vao = 0;
+        }
+    }
+    for (GLuint* buffer : {&vertexBuffer, &indexBuffer, &indirectBuffer}) {
+        if (*buffer != 0) {
+            glDeleteBuffers(1, buffer);
+            *buffer = 0;
+        }
+    }
+    indirectCapacity = 0;
+}
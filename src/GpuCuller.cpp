@@ -0,0 +1,186 @@
+#include "GpuCuller.h"
+#include "Model.h"
+#include "Shader.h"
+#include "UBO.h"
+
+#include <algorithm>
+
+namespace {
+    // Bloc CullParams de cull_instances.comp (std140)
+    struct CullParams {
+        glm::vec4 planes[Frustum::PLANE_COUNT];
+        glm::vec4 boundingSphere;
+        glm::vec4 cameraPosition;
+        glm::vec4 lodErrors[8];
+        GLuint instanceCount;
+        GLuint lodCount;
+        GLuint commandsPerLod;
+        GLuint capacity;
+        float pixelScale;
+        float pixelError;
+        float hysteresis;
+        float padding;
+    };
+
+    // Points de liaison des SSBO déclarés dans cull_instances.comp
+    const GLuint INPUT_BINDING = 0;
+    const GLuint OUTPUT_BINDING = 1;
+    const GLuint COMMAND_BINDING = 2;
+    const GLuint LOD_BINDING = 3;
+}
+
+bool GpuCuller::IsSupported() {
+    return GLEW_VERSION_4_3 && GeometryBuffer::getInstance().IsIndirectSupported();
+}
+
+GpuCuller::~GpuCuller() {
+    for (GLuint* buffer : {&inputBuffer, &lodBuffer, &commandBuffer, &paramsBuffer}) {
+        if (*buffer != 0) {
+            glDeleteBuffers(1, buffer);
+        }
+    }
+    for (Readback& readback : readbacks) {
+        if (readback.fence) {
+            glDeleteSync(readback.fence);
+        }
+        if (readback.buffer != 0) {
+            glDeleteBuffers(1, &readback.buffer);
+        }
+    }
+}
+
+void GpuCuller::ReadBackVisibleCount() {
+    // Du plus ancien au plus récent : les fences sont signalées dans l'ordre, on s'arrête à la
+    // première en attente. Jamais d'attente, le dernier résultat lu est gardé
+    std::vector<DrawElementsIndirectCommand> results;
+    for (size_t i = 0; i < READBACK_COUNT; ++i) {
+        Readback& readback = readbacks[(nextReadback + i) % READBACK_COUNT];
+        if (!readback.fence) {
+            continue;
+        }
+        GLenum status = glClientWaitSync(readback.fence, 0, 0);
+        if (status != GL_ALREADY_SIGNALED && status != GL_CONDITION_SATISFIED) {
+            return;
+        }
+        glDeleteSync(readback.fence);
+        readback.fence = nullptr;
+
+        results.resize(readback.commandCount);
+        glBindBuffer(GL_COPY_READ_BUFFER, readback.buffer);
+        glGetBufferSubData(GL_COPY_READ_BUFFER, 0, results.size() * sizeof(DrawElementsIndirectCommand), results.data());
+        glBindBuffer(GL_COPY_READ_BUFFER, 0);
+
+        visibleCount = 0;
+        for (size_t c = 0; c < results.size(); c += readback.commandsPerLod) {
+            visibleCount += results[c].instanceCount;
+        }
+    }
+}
+
+void GpuCuller::QueueReadback() {
+    // Anneau plein (GPU très en retard) : ce tirage n'est pas relu, les relectures en vol sont gardées
+    Readback& readback = readbacks[nextReadback];
+    if (readback.fence || commands.empty()) {
+        return;
+    }
+    if (readback.buffer == 0) {
+        glGenBuffers(1, &readback.buffer);
+    }
+
+    // Copie côté GPU : commandBuffer est réalloué dès le Cull suivant
+    GLsizeiptr size = commands.size() * sizeof(DrawElementsIndirectCommand);
+    glBindBuffer(GL_COPY_READ_BUFFER, commandBuffer);
+    glBindBuffer(GL_COPY_WRITE_BUFFER, readback.buffer);
+    glBufferData(GL_COPY_WRITE_BUFFER, size, nullptr, GL_STREAM_READ);
+    glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, 0, 0, size);
+    glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+    glBindBuffer(GL_COPY_READ_BUFFER, 0);
+
+    readback.commandCount = commands.size();
+    readback.commandsPerLod = commandsPerLod;
+    readback.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    nextReadback = (nextReadback + 1) % READBACK_COUNT;
+}
+
+void GpuCuller::Cull(const Shader& program, const Model& model, const InstanceData* instances, size_t count,
+                     const Frustum& frustum, const glm::vec3& cameraPosition, float lodPixelScale) {
+    // Résultats des frames précédentes déjà terminées sur le GPU
+    ReadBackVisibleCount();
+
+    size_t lodCount = std::min(model.GetLodCount(), MAX_LODS);
+
+    if (count > capacity || inputBuffer == 0) {
+        capacity = std::max<size_t>(std::max(count, capacity * 2), WORKGROUP_SIZE);
+        if (inputBuffer == 0) {
+            glGenBuffers(1, &inputBuffer);
+            glGenBuffers(1, &lodBuffer);
+            glGenBuffers(1, &commandBuffer);
+            glGenBuffers(1, &paramsBuffer);
+        }
+
+        // Les LOD précédents sont perdus avec l'ancien buffer : retour au LOD 0
+        std::vector<GLuint> lods(capacity, 0);
+        glBindBuffer(GL_SHADER_STORAGE_BUFFER, lodBuffer);
+        glBufferData(GL_SHADER_STORAGE_BUFFER, capacity * sizeof(GLuint), lods.data(), GL_DYNAMIC_COPY);
+    }
+    outputInstances.Allocate(capacity * lodCount);
+
+    // Instances : nouveau stockage à chaque frame, comme InstanceBuffer::Update
+    glBindBuffer(GL_SHADER_STORAGE_BUFFER, inputBuffer);
+    glBufferData(GL_SHADER_STORAGE_BUFFER, capacity * sizeof(InstanceData), nullptr, GL_STREAM_DRAW);
+    if (count > 0) {
+        glBufferSubData(GL_SHADER_STORAGE_BUFFER, 0, count * sizeof(InstanceData), instances);
+    }
+
+    // Commandes de chaque LOD, instanceCount à zéro, baseInstance au début de la région du LOD
+    commands.clear();
+    for (size_t lod = 0; lod < lodCount; ++lod) {
+        model.AppendDrawCommands(commands, lod, 0, lod * capacity);
+    }
+    commandsPerLod = commands.size() / lodCount;
+    glBindBuffer(GL_SHADER_STORAGE_BUFFER, commandBuffer);
+    glBufferData(GL_SHADER_STORAGE_BUFFER, commands.size() * sizeof(DrawElementsIndirectCommand), commands.data(),
+                 GL_STREAM_DRAW);
+    glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+
+    CullParams params = {};
+    std::copy(std::begin(frustum.planes), std::end(frustum.planes), params.planes);
+    const BoundingSphere& bounds = model.GetBoundingSphere();
+    params.boundingSphere = glm::vec4(bounds.center, bounds.radius);
+    params.cameraPosition = glm::vec4(cameraPosition, 1.0f);
+    for (size_t lod = 0; lod < lodCount; ++lod) {
+        params.lodErrors[lod] = glm::vec4(model.GetLodError(lod), 0.0f, 0.0f, 0.0f);
+    }
+    params.instanceCount = static_cast<GLuint>(count);
+    params.lodCount = static_cast<GLuint>(lodCount);
+    params.commandsPerLod = static_cast<GLuint>(commandsPerLod);
+    params.capacity = static_cast<GLuint>(capacity);
+    params.pixelScale = lodPixelScale;
+    params.pixelError = Model::LOD_PIXEL_ERROR;
+    params.hysteresis = Model::LOD_HYSTERESIS;
+    glBindBuffer(GL_UNIFORM_BUFFER, paramsBuffer);
+    glBufferData(GL_UNIFORM_BUFFER, sizeof(CullParams), &params, GL_STREAM_DRAW);
+    glBindBuffer(GL_UNIFORM_BUFFER, 0);
+
+    if (count == 0) {
+        return;
+    }
+
+    glBindBufferBase(GL_UNIFORM_BUFFER, CULL_PARAMS_UBO_BINDING, paramsBuffer);
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, INPUT_BINDING, inputBuffer);
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, OUTPUT_BINDING, outputInstances.GetBuffer());
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, COMMAND_BINDING, commandBuffer);
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, LOD_BINDING, lodBuffer);
+
+    program.use();
+    glDispatchCompute(static_cast<GLuint>((count + WORKGROUP_SIZE - 1) / WORKGROUP_SIZE), 1, 1);
+
+    // Les commandes et les instances écrites sont lues par le tirage qui suit, et les commandes
+    // copiées pour la relecture
+    glMemoryBarrier(GL_COMMAND_BARRIER_BIT | GL_VERTEX_ATTRIB_ARRAY_BARRIER_BIT | GL_BUFFER_UPDATE_BARRIER_BIT);
+}
+
+void GpuCuller::Draw(const Model& model, const Shader& shader) {
+    model.DrawIndirect(shader, commandBuffer, commands.size(), outputInstances);
+    QueueReadback();
+}
@@ -0,0 +1,69 @@
+#include "InstanceBuffer.h"
+
+#include <algorithm>
+
+InstanceBuffer::~InstanceBuffer() {
+    if (vbo != 0) {
+        glDeleteBuffers(1, &vbo);
+    }
+}
+
+void InstanceBuffer::Update(const InstanceData* instances, size_t instanceCount) {
+    if (vbo == 0) {
+        glGenBuffers(1, &vbo);
+    }
+    glBindBuffer(GL_ARRAY_BUFFER, vbo);
+
+    // Nouveau stockage à chaque frame : le pilote peut garder l'ancien tant que le GPU le lit
+    if (instanceCount > capacity) {
+        capacity = instanceCount > capacity * 2 ? instanceCount : capacity * 2;
+    }
+    glBufferData(GL_ARRAY_BUFFER, capacity * sizeof(InstanceData), nullptr, GL_STREAM_DRAW);
+    if (instanceCount > 0) {
+        glBufferSubData(GL_ARRAY_BUFFER, 0, instanceCount * sizeof(InstanceData), instances);
+    }
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+    count = instanceCount;
+}
+
+void InstanceBuffer::Allocate(size_t instanceCount) {
+    if (vbo == 0) {
+        glGenBuffers(1, &vbo);
+    }
+    if (instanceCount > capacity || capacity == 0) {
+        capacity = std::max<size_t>(instanceCount > capacity * 2 ? instanceCount : capacity * 2, 1);
+        glBindBuffer(GL_ARRAY_BUFFER, vbo);
+        glBufferData(GL_ARRAY_BUFFER, capacity * sizeof(InstanceData), nullptr, GL_DYNAMIC_COPY);
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+    }
+    count = instanceCount;
+}
+
+void InstanceBuffer::BindAttributes(size_t first) const {
+    glBindBuffer(GL_ARRAY_BUFFER, vbo);
+
+    const GLsizei stride = sizeof(InstanceData);
+    size_t base = first * sizeof(InstanceData);
+    for (GLuint column = 0; column < 4; column++) {
+        GLuint location = FIRST_ATTRIBUTE + column;
+        glEnableVertexAttribArray(location);
+        glVertexAttribPointer(location, 4, GL_FLOAT, GL_FALSE, stride,
+                              (void*)(base + offsetof(InstanceData, model) + column * sizeof(glm::vec4)));
+        glVertexAttribDivisor(location, 1);
+    }
+
+    GLuint colorLocation = FIRST_ATTRIBUTE + 4;
+    glEnableVertexAttribArray(colorLocation);
+    glVertexAttribPointer(colorLocation, 4, GL_FLOAT, GL_FALSE, stride, (void*)(base + offsetof(InstanceData, color)));
+    glVertexAttribDivisor(colorLocation, 1);
+
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+}
+
+void InstanceBuffer::UnbindAttributes() {
+    for (GLuint location = FIRST_ATTRIBUTE; location < FIRST_ATTRIBUTE + 5; location++) {
+        glVertexAttribDivisor(location, 0);
+        glDisableVertexAttribArray(location);
+    }
+}
@@ -0,0 +1,226 @@
+#include "JobSystem.h"
+
+#include <algorithm>
+
+namespace {
+    // File du thread courant ; les threads extérieurs utilisent la file partagée
+    const size_t EXTERNAL_THREAD = static_cast<size_t>(-1);
+    thread_local size_t currentWorker = EXTERNAL_THREAD;
+
+    // Tranches par thread pour ParallelFor sans taille imposée : assez pour équilibrer par le vol
+    const size_t CHUNKS_PER_THREAD = 4;
+
+    // Cœurs laissés aux threads extérieurs (voir ReserveExternalThreads)
+    unsigned int externalThreads = 1;
+}
+
+JobSystem& JobSystem::getInstance() {
+    static JobSystem instance;
+    return instance;
+}
+
+void JobSystem::ReserveExternalThreads(unsigned int count) {
+    externalThreads = std::max(count, 1u);
+}
+
+JobSystem::JobSystem() {
+    // Un cœur reste à chaque thread extérieur (principal, simulation), qui travaille aussi dans Wait
+    unsigned int cores = std::thread::hardware_concurrency();
+    unsigned int workerCount = cores > externalThreads ? cores - externalThreads : 1;
+
+    for (unsigned int i = 0; i <= workerCount; i++) {
+        queues.push_back(std::make_unique<WorkQueue>());
+    }
+    workers.reserve(workerCount);
+    for (unsigned int i = 0; i < workerCount; i++) {
+        workers.emplace_back(&JobSystem::WorkerLoop, this, i);
+    }
+}
+
+JobSystem::~JobSystem() {
+    Shutdown();
+}
+
+void JobSystem::Shutdown() {
+    if (workers.empty()) {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(sleepMutex);
+        stopping = true;
+    }
+    jobAvailable.notify_all();
+    jobFinished.notify_all();
+
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+    workers.clear();
+
+    for (std::unique_ptr<WorkQueue>& queue : queues) {
+        std::lock_guard<std::mutex> lock(queue->mutex);
+        queue->jobs.clear();
+    }
+    queuedJobs = 0;
+}
+
+JobHandle JobSystem::Schedule(std::function<void()> task, std::initializer_list<JobHandle> dependencies) {
+    JobHandle job = std::make_shared<Job>();
+    job->task = std::move(task);
+
+    // Référence provisoire : la tâche ne part pas tant que les dépendances s'enregistrent
+    job->pendingDependencies = 1;
+    for (const JobHandle& dependency : dependencies) {
+        if (!dependency) {
+            continue;
+        }
+        std::lock_guard<std::mutex> lock(dependency->mutex);
+        if (!dependency->finished) {
+            job->pendingDependencies++;
+            dependency->continuations.push_back(job);
+        }
+    }
+
+    if (--job->pendingDependencies == 0) {
+        Push(job);
+    }
+    return job;
+}
+
+void JobSystem::Wait(const JobHandle& job) {
+    if (!job) {
+        return;
+    }
+
+    while (!job->finished) {
+        if (JobHandle other = FindJob()) {
+            Execute(other);
+            continue;
+        }
+
+        // Rien à voler : la tâche attendue tourne ailleurs
+        std::unique_lock<std::mutex> lock(sleepMutex);
+        jobFinished.wait(lock, [this, &job]() { return job->finished || queuedJobs > 0 || stopping; });
+        if (stopping) {
+            return;
+        }
+    }
+}
+
+void JobSystem::Wait(std::initializer_list<JobHandle> jobs) {
+    for (const JobHandle& job : jobs) {
+        Wait(job);
+    }
+}
+
+void JobSystem::ParallelFor(size_t count, size_t chunkSize, const std::function<void(size_t, size_t)>& body) {
+    if (count == 0) {
+        return;
+    }
+    if (chunkSize == 0) {
+        size_t chunkCount = (workers.size() + 1) * CHUNKS_PER_THREAD;
+        chunkSize = std::max<size_t>(1, (count + chunkCount - 1) / chunkCount);
+    }
+
+    // Toutes les tranches sauf la première en file, la première sur le thread appelant
+    std::vector<JobHandle> chunks;
+    chunks.reserve(count / chunkSize);
+    for (size_t begin = chunkSize; begin < count; begin += chunkSize) {
+        size_t end = std::min(begin + chunkSize, count);
+        chunks.push_back(Schedule([&body, begin, end]() { body(begin, end); }));
+    }
+    body(0, std::min(chunkSize, count));
+
+    for (const JobHandle& chunk : chunks) {
+        Wait(chunk);
+    }
+}
+
+void JobSystem::WorkerLoop(size_t index) {
+    currentWorker = index;
+    for (;;) {
+        if (JobHandle job = FindJob()) {
+            Execute(job);
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(sleepMutex);
+        jobAvailable.wait(lock, [this]() { return stopping || queuedJobs > 0; });
+        if (stopping) {
+            return;
+        }
+    }
+}
+
+size_t JobSystem::CurrentQueue() const {
+    return currentWorker == EXTERNAL_THREAD ? queues.size() - 1 : currentWorker;
+}
+
+void JobSystem::Push(JobHandle job) {
+    WorkQueue& queue = *queues[CurrentQueue()];
+    {
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        queue.jobs.push_back(std::move(job));
+    }
+    {
+        std::lock_guard<std::mutex> lock(sleepMutex);
+        queuedJobs++;
+    }
+    jobAvailable.notify_one();
+    // Un thread dans Wait peut aussi l'exécuter (continuation libérée, tâche planifiée ailleurs)
+    jobFinished.notify_all();
+}
+
+JobHandle JobSystem::FindJob() {
+    size_t own = CurrentQueue();
+
+    // Sa propre file d'abord, par l'arrière : la tâche la plus récente
+    {
+        WorkQueue& queue = *queues[own];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        if (!queue.jobs.empty()) {
+            JobHandle job = std::move(queue.jobs.back());
+            queue.jobs.pop_back();
+            queuedJobs--;
+            return job;
+        }
+    }
+
+    // Puis vol à l'avant des autres files, en partant de la voisine
+    for (size_t offset = 1; offset < queues.size(); offset++) {
+        WorkQueue& queue = *queues[(own + offset) % queues.size()];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        if (!queue.jobs.empty()) {
+            JobHandle job = std::move(queue.jobs.front());
+            queue.jobs.pop_front();
+            queuedJobs--;
+            stolenCount++;
+            return job;
+        }
+    }
+    return nullptr;
+}
+
+void JobSystem::Execute(const JobHandle& job) {
+    job->task();
+    job->task = nullptr; // Libère les captures au plus tôt
+    executedCount++;
+
+    std::vector<JobHandle> ready;
+    {
+        std::lock_guard<std::mutex> lock(job->mutex);
+        job->finished = true;
+        ready.swap(job->continuations);
+    }
+    for (JobHandle& continuation : ready) {
+        if (--continuation->pendingDependencies == 0) {
+            Push(std::move(continuation));
+        }
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(sleepMutex);
+    }
+    jobFinished.notify_all();
+}
@@ -3,9 +3,15 @@
 #include "AudioSource.h"
 #include "Sound.h"
 #include "ShaderManager.h"
+#include "RenderQueue.h"
 #include "UBO.h"
+#include "EntityKernels.h"
+#include "JobSystem.h"
+#include "Random.h"
+#include "SimulationThread.h"
 #include "imgui.h"
 #include <iostream>
+#include <algorithm>
 #include <cstdlib>
 #include <cmath>
 #include <glm/gtc/matrix_transform.hpp>
@@ -15,6 +21,31 @@
 #define M_PI 3.14159265358979323846
 #endif
 
+namespace {
+    // Identifiants des objets de l'index spatial : catégorie dans l'octet de poids fort
+    uint32_t makeEntityId(int category, size_t index) {
+        return (static_cast<uint32_t>(category) << 24) | static_cast<uint32_t>(index);
+    }
+    int entityCategory(uint32_t id) { return static_cast<int>(id >> 24); }
+    size_t entityIndex(uint32_t id) { return id & 0xFFFFFF; }
+    
+    // Colonne de vec3 vue comme 3 * n flottants, pour EntityKernels
+    static_assert(sizeof(glm::vec3) == 3 * sizeof(float), "glm::vec3 doit être compact");
+    float* components(std::vector<glm::vec3>& column) { return reinterpret_cast<float*>(column.data()); }
+    const float* components(const std::vector<glm::vec3>& column) { return reinterpret_cast<const float*>(column.data()); }
+    
+    // Angles ramenés dans [0, 2π) par la simulation : interpolés par le plus court chemin, et
+    // égaux à b pour t = 1
+    float mixAngle(float a, float b, float t) {
+        const float twoPi = 2.0f * static_cast<float>(M_PI);
+        float delta = std::remainder(b - a, twoPi);
+        float angle = b - delta * (1.0f - t);
+        if (angle < 0.0f) angle += twoPi;
+        if (angle >= twoPi) angle -= twoPi;
+        return angle;
+    }
+}
+
 LightScene::LightScene()
     : lightPosition(-50.0f, 20.0f, -50.0f),  // Position statique éloignée
       lightColor(1.0f, 1.0f, 0.8f),
@@ -57,7 +88,7 @@ bool LightScene::Initialize(Camera& camera, SoundManager& soundManager) {
       // Charger la skybox spatiale pour LightScene (vue spectaculaire de l'espace)
     currentSkyboxType = SkyboxManager::SkyboxType::SPACE;
     std::vector<std::string> skyboxFaces = SkyboxManager::GetSkyboxFaces(currentSkyboxType);
-    skybox = std::make_unique<Skybox>(skyboxFaces);
+    skybox = std::make_unique<Skybox>(skyboxFaces, true);
     std::cout << "Skybox chargée pour LightScene: " << SkyboxManager::GetSkyboxName(currentSkyboxType) << std::endl;
 
     initialized = true;
@@ -77,7 +108,7 @@ bool LightScene::CreateLightSphere() {
         sunSphere = std::make_unique<Sphere>("", sunRadius, 64, 32);
         
         // Créer la lune avec texture
-        moonSphere = std::make_unique<Sphere>("../textures/spherical_moon_texture.jpg", moonRadius, 36, 18);
+        moonSphere = std::make_unique<Sphere>("../textures/spherical_moon_texture.jpg", moonRadius, 36, 18, true);
         
         // Garder les anciennes sphères pour compatibilité
         lightSphere = std::make_unique<Sphere>("", lightRadius, 32, 16);
@@ -90,54 +121,201 @@ bool LightScene::CreateLightSphere() {
     }
 }
 
-void LightScene::Update(float deltaTime, GLFWwindow* window, Camera& camera, SoundManager& soundManager) {
+void LightScene::Update(float /*deltaTime*/, GLFWwindow* window, Camera& camera, SoundManager& soundManager) {
+    if (!initialized) return;
+    
+    // L'état animé avance dans Simulate (thread de simulation ou, sans thread, boucle principale)
+}
+
+void LightScene::Simulate(float deltaTime, double time) {
     if (!initialized) return;
 
     // Animation de la lune en orbite lointaine
-    moonCurrentAngle += moonOrbitSpeed * deltaTime;
-    if (moonCurrentAngle > 2.0f * M_PI) moonCurrentAngle -= 2.0f * M_PI;
+    sim.moonCurrentAngle += moonOrbitSpeed * deltaTime;
+    if (sim.moonCurrentAngle > 2.0f * M_PI) sim.moonCurrentAngle -= 2.0f * M_PI;
+    
+    sim.globalTime += deltaTime;
+    sim.step++;
+    
+    // Passes des éléments dynamiques en tâches : les passes indépendantes s'exécutent en
+    // parallèle. Comètes, débris et satellites tirent chacun dans leur propre flux Random,
+    // sans ordre imposé entre eux
+    JobSystem& jobs = JobSystem::getInstance();
+    JobHandle stationsJob = jobs.Schedule([this, deltaTime]() { UpdateStations(deltaTime); });
+    JobHandle cometsJob = jobs.Schedule([this, deltaTime]() { UpdateComets(deltaTime); });
+    JobHandle debrisJob = jobs.Schedule([this, deltaTime]() { UpdateDebris(deltaTime); });
+    JobHandle portalsJob = jobs.Schedule([this, deltaTime]() { UpdatePortals(deltaTime); });
+    JobHandle satellitesJob = jobs.Schedule([this, deltaTime]() { UpdateSatellites(deltaTime); });
+    JobHandle cloudsJob = jobs.Schedule([this, deltaTime]() { UpdateParticleClouds(deltaTime); });
+    
+    // L'index lit les positions de quatre passes ; les interactions lisent l'index et
+    // modifient les vitesses des débris et des comètes
+    JobHandle indexJob = jobs.Schedule([this]() { RebuildSpatialIndex(sim, interactionIndex); },
+                                       {stationsJob, cometsJob, debrisJob, satellitesJob});
+    JobHandle interactionsJob = jobs.Schedule([this, deltaTime]() { UpdateInteractions(deltaTime); },
+                                              {indexJob, debrisJob, cometsJob});
+    
+    // Anneau et flotte sur le thread appelant pendant ce temps
+    const EntityKernels& kernels = EntityKernels::Get();
+    const float twoPi = 2.0f * static_cast<float>(M_PI);
     
     // Animation de l'anneau d'astéroïdes
+    kernels.integrateWrapped(sim.asteroids.currentAngle, sim.asteroids.orbitSpeed, ASTEROID_COUNT, deltaTime, twoPi);
+    
+    // Animation de la flotte de vaisseaux spatiaux : angle orbital, phases d'oscillation
+    kernels.integrateWrapped(sim.spaceships.currentAngle, sim.spaceships.orbitSpeed, SPACESHIP_COUNT, deltaTime, twoPi);
+    kernels.addWrapped(sim.spaceships.randomPhase, SPACESHIP_COUNT, deltaTime * 2.0f, twoPi);
+    
+    // Oscillations verticales et horizontales
+    kernels.integrate(sim.spaceships.heightPhase1, sim.spaceships.heightFreq1, SPACESHIP_COUNT, deltaTime);
+    kernels.integrate(sim.spaceships.heightPhase2, sim.spaceships.heightFreq2, SPACESHIP_COUNT, deltaTime);
+    kernels.integrate(sim.spaceships.heightPhase3, sim.spaceships.heightFreq3, SPACESHIP_COUNT, deltaTime);
+    kernels.integrate(sim.spaceships.horizontalPhase1, sim.spaceships.horizontalFreq1, SPACESHIP_COUNT, deltaTime);
+    kernels.integrate(sim.spaceships.horizontalPhase2, sim.spaceships.horizontalFreq2, SPACESHIP_COUNT, deltaTime);
+    
+    // Le thread appelant exécute d'autres passes en attendant
+    jobs.Wait({interactionsJob, portalsJob, cloudsJob});
+    
+    PublishSnapshot(time);
+}
+
+void LightScene::PublishSnapshot(double time) {
+    std::shared_ptr<SnapshotBuffer<SimulationState>::Snapshot> snapshot = snapshots.Acquire();
+    snapshot->state = sim; // Réutilise la capacité des vecteurs d'un instantané recyclé
+    snapshot->time = time;
+    snapshots.Publish(std::move(snapshot));
+}
+
+void LightScene::BlendSnapshots() {
+    SnapshotBuffer<SimulationState>::View view = snapshots.Read(SimulationThread::Now());
+    if (!view.latest) return;
+    
+    // glm::mix(a, b, 1) vaut exactement b : sans thread de simulation, frame reproduit sim
+    const SimulationState& a = view.previous->state;
+    const SimulationState& b = view.latest->state;
+    float t = view.alpha;
+    
+    frame.globalTime = glm::mix(a.globalTime, b.globalTime, t);
+    frame.moonCurrentAngle = mixAngle(a.moonCurrentAngle, b.moonCurrentAngle, t);
+    
     for (int i = 0; i < ASTEROID_COUNT; ++i) {
-        AsteroidData& asteroid = asteroids[i];
-        asteroid.currentAngle += asteroid.orbitSpeed * deltaTime;
-        if (asteroid.currentAngle > 2.0f * M_PI) asteroid.currentAngle -= 2.0f * M_PI;
+        frame.asteroids.currentAngle[i] = mixAngle(a.asteroids.currentAngle[i], b.asteroids.currentAngle[i], t);
     }
     
-    // Animation de la flotte de vaisseaux spatiaux
+    const SpaceshipFleet& shipsA = a.spaceships;
+    const SpaceshipFleet& shipsB = b.spaceships;
+    SpaceshipFleet& ships = frame.spaceships;
     for (int i = 0; i < SPACESHIP_COUNT; ++i) {
-        SpaceshipData& ship = spaceships[i];
-        
-        // Mise à jour de l'angle orbital
-        ship.currentAngle += ship.orbitSpeed * deltaTime;
-        if (ship.currentAngle > 2.0f * M_PI) {
-            ship.currentAngle -= 2.0f * M_PI;
+        ships.currentAngle[i] = mixAngle(shipsA.currentAngle[i], shipsB.currentAngle[i], t);
+        ships.randomPhase[i] = mixAngle(shipsA.randomPhase[i], shipsB.randomPhase[i], t);
+        ships.heightPhase1[i] = glm::mix(shipsA.heightPhase1[i], shipsB.heightPhase1[i], t);
+        ships.heightPhase2[i] = glm::mix(shipsA.heightPhase2[i], shipsB.heightPhase2[i], t);
+        ships.heightPhase3[i] = glm::mix(shipsA.heightPhase3[i], shipsB.heightPhase3[i], t);
+        ships.horizontalPhase1[i] = glm::mix(shipsA.horizontalPhase1[i], shipsB.horizontalPhase1[i], t);
+        ships.horizontalPhase2[i] = glm::mix(shipsA.horizontalPhase2[i], shipsB.horizontalPhase2[i], t);
+        ships.randomOffset[i] = glm::mix(shipsA.randomOffset[i], shipsB.randomOffset[i], t);
+    }
+    
+    for (int i = 0; i < STATION_COUNT; ++i) {
+        const SpaceStation& stationA = a.stations[i];
+        const SpaceStation& stationB = b.stations[i];
+        SpaceStation& station = frame.stations[i];
+        station.position = glm::mix(stationA.position, stationB.position, t);
+        station.currentRotation = glm::mix(stationA.currentRotation, stationB.currentRotation, t);
+        station.orbitAngle = mixAngle(stationA.orbitAngle, stationB.orbitAngle, t);
+        station.turretRotation = glm::mix(stationA.turretRotation, stationB.turretRotation, t);
+    }
+    
+    // Traînées : un échantillon figé par pas de simulation, quelle que soit la cadence du rendu, et
+    // une tête qui suit la position interpolée. Les pas dépassés depuis la dernière frame (rendu plus
+    // lent que la simulation) sont complétés en ligne droite jusqu'à la position de previous
+    size_t newSamples = 0;
+    if (a.step > cometTrailStep) {
+        newSamples = static_cast<size_t>(std::min<uint64_t>(a.step - cometTrailStep, COMET_TRAIL_CAPACITY));
+        cometTrailStep = a.step;
+    }
+    
+    // Une comète réapparue entre les deux pas n'est pas interpolée : elle saute, et sa traînée
+    // repart de la nouvelle position
+    for (size_t i = 0; i < frame.comets.size(); ++i) {
+        const Comet& cometB = b.comets[i];
+        const Comet& cometA = a.comets[i].generation == cometB.generation ? a.comets[i] : cometB;
+        Comet& comet = frame.comets[i];
+        bool respawned = comet.generation != cometB.generation;
+        comet.position = glm::mix(cometA.position, cometB.position, t);
+        comet.brightness = glm::mix(cometA.brightness, cometB.brightness, t);
+        comet.currentPhase = glm::mix(cometA.currentPhase, cometB.currentPhase, t);
+        comet.generation = cometB.generation;
+        if (respawned) {
+            cometTrails.Reset(i, cometB.position, static_cast<size_t>(comet.trailLength));
+            cometTrails.Push(i, comet.position);
+            continue;
         }
-        
-        // Mise à jour des phases d'oscillation individuelles
-        ship.randomPhase += deltaTime * 2.0f;
-        if (ship.randomPhase > 2.0f * M_PI) {
-            ship.randomPhase -= 2.0f * M_PI;
+        if (newSamples == 0) {
+            cometTrails.SetHead(i, comet.position);
+            continue;
         }
         
-        // Oscillations verticales et horizontales
-        ship.heightPhase1 += deltaTime * ship.heightFreq1;
-        ship.heightPhase2 += deltaTime * ship.heightFreq2;
-        ship.heightPhase3 += deltaTime * ship.heightFreq3;
-        ship.horizontalPhase1 += deltaTime * ship.horizontalFreq1;
-        ship.horizontalPhase2 += deltaTime * ship.horizontalFreq2;
+        // L'ancienne tête devient le premier des nouveaux échantillons figés
+        glm::vec3 anchor = cometTrails.GetSample(i, 1);
+        for (size_t s = 1; s <= newSamples; ++s) {
+            glm::vec3 sample = glm::mix(anchor, cometA.position, static_cast<float>(s) / newSamples);
+            if (s == 1) {
+                cometTrails.SetHead(i, sample);
+            } else {
+                cometTrails.Push(i, sample);
+            }
+        }
+        cometTrails.Push(i, comet.position);
     }
     
-    globalTime += deltaTime;
+    // Débris : un respawn remet la durée de vie au maximum
+    const DebrisField& debrisA = a.debris;
+    const DebrisField& debrisB = b.debris;
+    DebrisField& debris = frame.debris;
+    for (size_t i = 0; i < debris.size(); ++i) {
+        if (debrisB.lifetime[i] > debrisA.lifetime[i]) {
+            debris.position[i] = debrisB.position[i];
+            debris.rotation[i] = debrisB.rotation[i];
+            debris.lifetime[i] = debrisB.lifetime[i];
+            continue;
+        }
+        debris.position[i] = glm::mix(debrisA.position[i], debrisB.position[i], t);
+        debris.rotation[i] = glm::mix(debrisA.rotation[i], debrisB.rotation[i], t);
+        debris.lifetime[i] = glm::mix(debrisA.lifetime[i], debrisB.lifetime[i], t);
+    }
+    
+    for (int i = 0; i < PORTAL_COUNT; ++i) {
+        const EnergyPortal& portalA = a.portals[i];
+        const EnergyPortal& portalB = b.portals[i];
+        EnergyPortal& portal = frame.portals[i];
+        portal.currentRotation = glm::mix(portalA.currentRotation, portalB.currentRotation, t);
+        portal.pulseIntensity = glm::mix(portalA.pulseIntensity, portalB.pulseIntensity, t);
+        portal.energyFlow = glm::mix(portalA.energyFlow, portalB.energyFlow, t);
+    }
     
-    // Mettre à jour tous les nouveaux éléments dynamiques
-    UpdateStations(deltaTime);
-    UpdateComets(deltaTime);
-    UpdateDebris(deltaTime);
-    UpdatePortals(deltaTime);
-    UpdateSatellites(deltaTime);
-    UpdateParticleClouds(deltaTime);
-    UpdateInteractions(deltaTime);
+    // L'état des satellites bascule d'un coup, au pas le plus récent
+    for (int i = 0; i < SATELLITE_COUNT; ++i) {
+        const Satellite& satA = a.satellites[i];
+        const Satellite& satB = b.satellites[i];
+        Satellite& sat = frame.satellites[i];
+        sat.currentAngle = mixAngle(satA.currentAngle, satB.currentAngle, t);
+        sat.antennaRotation = glm::mix(satA.antennaRotation, satB.antennaRotation, t);
+        sat.signalPulse = glm::mix(satA.signalPulse, satB.signalPulse, t);
+        sat.isActive = satB.isActive;
+        sat.color = satB.color;
+    }
+    
+    for (size_t c = 0; c < frame.particleClouds.size(); ++c) {
+        const ParticleCloud& cloudA = a.particleClouds[c];
+        const ParticleCloud& cloudB = b.particleClouds[c];
+        ParticleCloud& cloud = frame.particleClouds[c];
+        cloud.currentRotation = glm::mix(cloudA.currentRotation, cloudB.currentRotation, t);
+        cloud.intensity = glm::mix(cloudA.intensity, cloudB.intensity, t);
+        for (size_t i = 0; i < cloud.particlePositions.size(); ++i) {
+            cloud.particlePositions[i] = glm::mix(cloudA.particlePositions[i], cloudB.particlePositions[i], t);
+        }
+    }
 }
 
 
@@ -145,65 +323,89 @@ void LightScene::Update(float deltaTime, GLFWwindow* window, Camera& camera, Sou
 void LightScene::Render(Camera& camera, int screenWidth, int screenHeight) {
     if (!initialized) return;
     
+    // État de la frame, entre les deux derniers pas de simulation
+    BlendSnapshots();
+    
     // Rendu skybox
     glm::mat4 projection = glm::perspective(glm::radians(camera.Zoom), (float)screenWidth / screenHeight, 0.1f, 1000.0f);
     glm::mat4 view = glm::mat4(glm::mat3(camera.GetViewMatrix())); // Remove translation for skybox
     if (skybox) skybox->Render(view, projection);
     
+    // Frustum de la frame (vue complète, avec translation) et compteurs de visibilité
+    frustum = camera.GetFrustum(projection);
+    for (CullCounts& counts : cullCounts) {
+        counts = CullCounts();
+    }
+    RebuildSpatialIndex(frame, spatialIndex);
+    QuerySpatialIndex(camera);
+    
+    // Uniforms constants sur la frame, définis avant l'exécution de la file
+    Shader* sunShader = ShaderManager::getInstance().GetSunShader();
+    if (sunShader) {
+        sunShader->use();
+        sunShader->setFloat("time", frame.globalTime);
+    }
+    
+    // Les objets non instanciés passent par la file de rendu, triée avant exécution
+    RenderQueue& renderQueue = RenderQueue::getInstance();
+    renderQueue.Begin(camera.Position);
+    
     // Rendu du soleil central imposant
-    RenderSun(camera, screenWidth, screenHeight);
+    RenderSun();
     
     // Rendu de l'anneau d'astéroïdes dense
-    RenderAsteroidRing(camera, screenWidth, screenHeight);
+    RenderAsteroidRing(camera, screenHeight);
     
     // Rendu de la flotte de vaisseaux spatiaux
-    RenderSpaceships(camera, screenWidth, screenHeight);
+    RenderSpaceships(camera, screenHeight);
     
     // Rendu de la lune en orbite lointaine
-    RenderMoon(camera, screenWidth, screenHeight);
+    RenderMoon();
     
     // Garder le rendu de la lumière pour compatibilité
     RenderLight(camera, screenWidth, screenHeight);
     
     // Rendu de tous les nouveaux éléments dynamiques
-    RenderStations(camera, screenWidth, screenHeight);
-    RenderComets(camera, screenWidth, screenHeight);
-    RenderDebris(camera, screenWidth, screenHeight);
-    RenderPortals(camera, screenWidth, screenHeight);
-    RenderSatellites(camera, screenWidth, screenHeight);
-    RenderParticleClouds(camera, screenWidth, screenHeight);
+    RenderStations(camera, screenHeight);
+    RenderComets();
+    RenderDebris(camera, screenHeight);
+    RenderPortals();
+    RenderSatellites(camera, screenHeight);
+    RenderParticleClouds();
+    
+    renderQueue.Execute();
+    
+    // Transparents après l'opaque
+    RenderCometTrails();
 }
 
 void LightScene::RenderLight(Camera& camera, int screenWidth, int screenHeight) {
     // Obtenir le shader du soleil depuis le gestionnaire global
     Shader* sunShader = ShaderManager::getInstance().GetSunShader();
+    if (!sunShader) return;
     
-    if (!sunShader || !g_uboManager) return;
-
-    // Rendu de la sphère de lumière
-    sunShader->use();
-    sunShader->setFloat("time", static_cast<float>(glfwGetTime()));
+    RenderQueue& renderQueue = RenderQueue::getInstance();
 
-    // Positionner la sphère de lumière
-    glm::mat4 model = glm::mat4(1.0f);
-    model = glm::translate(model, lightPosition);
-    g_uboManager->UpdateTransformUBO(model);
-
-    // Dessiner la sphère
-    lightSphere->Draw(*sunShader);
+    // Sphère de lumière
+    DrawPacket packet;
+    packet.shader = sunShader;
+    packet.model = glm::translate(glm::mat4(1.0f), lightPosition);
+    if (IsBodyVisible(lightSphere->GetBoundingSphere().Transformed(packet.model))) {
+        lightSphere->Submit(renderQueue, packet);
+    }
 
     // Rendu de la sphère de test pour comparer les shaders d'éclairage
     Shader* currentLightingShader = ShaderManager::getInstance().GetCurrentLightingShader();
     if (currentLightingShader && testSphere) {
-        currentLightingShader->use();
-        currentLightingShader->setVec3("objectColor", glm::vec3(0.8f, 0.3f, 0.1f)); // Couleur orange
-
         // Positionner la sphère de test à côté de la source de lumière
-        glm::mat4 testModel = glm::mat4(1.0f);
-        testModel = glm::translate(testModel, lightPosition + glm::vec3(10.0f, 0.0f, 0.0f));
-        g_uboManager->UpdateTransformUBO(testModel);
-        
-        testSphere->Draw(*currentLightingShader);
+        DrawPacket testPacket;
+        testPacket.shader = currentLightingShader;
+        testPacket.model = glm::translate(glm::mat4(1.0f), lightPosition + glm::vec3(10.0f, 0.0f, 0.0f));
+        testPacket.color = glm::vec3(0.8f, 0.3f, 0.1f); // Couleur orange
+        testPacket.hasColor = true;
+        if (IsBodyVisible(testSphere->GetBoundingSphere().Transformed(testPacket.model))) {
+            testSphere->Submit(renderQueue, testPacket);
+        }
     }
 }
 
@@ -221,6 +423,46 @@ void LightScene::RenderUI(GLFWwindow* window, SoundManager& soundManager) {
     UIHelpers::RenderMainControlsUI(currentSkyboxType,
         [this](SkyboxManager::SkyboxType type) { ChangeSkybox(type); }
     );
+    
+    RenderCullingUI();
+}
+
+void LightScene::RenderCullingUI() {
+    static const char* const CATEGORY_NAMES[CULL_CATEGORY_COUNT] = {
+        "Corps célestes", "Astéroïdes", "Vaisseaux", "Stations", "Comètes",
+        "Débris", "Portails", "Satellites", "Particules"
+    };
+    
+    ImGui::SetNextWindowPos(ImVec2(10, 260), ImGuiCond_FirstUseEver);
+    ImGui::Begin("Visibilité (frustum culling)", nullptr, ImGuiWindowFlags_AlwaysAutoResize);
+    
+    size_t visibleTotal = 0;
+    size_t total = 0;
+    for (int i = 0; i < CULL_CATEGORY_COUNT; ++i) {
+        ImGui::Text("%s: %zu / %zu", CATEGORY_NAMES[i], cullCounts[i].visible, cullCounts[i].total);
+        visibleTotal += cullCounts[i].visible;
+        total += cullCounts[i].total;
+    }
+    ImGui::Separator();
+    ImGui::Text("Total: %zu / %zu", visibleTotal, total);
+    
+    if (ShaderManager::getInstance().GetCullInstancesShader()) {
+        ImGui::Checkbox("Culling GPU (compute shader)", &gpuCulling);
+        if (gpuCulling) {
+            ImGui::Text("Astéroïdes, débris, satellites : compte relu avec quelques frames de retard");
+        }
+    }
+    
+    ImGui::Separator();
+    ImGui::Text("Index spatial: %zu objets, %zu nœuds", spatialIndex.GetItemCount(), spatialIndex.GetNodeCount());
+    if (hasPickedEntity) {
+        ImGui::Text("Objet visé: %s n°%zu à %.0f", CATEGORY_NAMES[entityCategory(pickedEntity)],
+                    entityIndex(pickedEntity), pickedDistance);
+    } else {
+        ImGui::Text("Objet visé: aucun");
+    }
+    
+    ImGui::End();
 }
 
 const char* LightScene::GetName() const {
@@ -300,7 +542,7 @@ void LightScene::ChangeSkybox(SkyboxManager::SkyboxType newType) {
     if (newType != currentSkyboxType) {
         currentSkyboxType = newType;
         std::vector<std::string> skyboxFaces = SkyboxManager::GetSkyboxFaces(currentSkyboxType);
-        skybox = std::make_unique<Skybox>(skyboxFaces);
+        skybox = std::make_unique<Skybox>(skyboxFaces, true);
         std::cout << "Skybox changée pour LightScene: " << SkyboxManager::GetSkyboxName(currentSkyboxType) << std::endl;
     }
 }
@@ -345,10 +587,11 @@ std::string LightScene::GetCurrentSoundName() const {
 bool LightScene::LoadModels() {
     try {
         // Charger le modèle d'astéroïde (réutilisé pour tout l'anneau)
-        asteroidModel = std::make_unique<Model>("../models/astroid.obj");
+        // Sommets compressés sur 16 octets : ces modèles sont dessinés des centaines de fois par frame
+        asteroidModel = std::make_unique<Model>("../models/astroid.obj", true, VertexFormat::PackedUnorm16);
         
         // Charger le modèle de vaisseau spatial
-        spaceshipModel = std::make_unique<Model>("../models/map-bump.obj");
+        spaceshipModel = std::make_unique<Model>("../models/map-bump.obj", true, VertexFormat::PackedUnorm16);
         
         // Initialiser l'anneau d'astéroïdes avec des propriétés variées
         InitializeAsteroidRing();
@@ -365,11 +608,21 @@ bool LightScene::LoadModels() {
         InitializeParticleClouds();
         
         // Initialiser les interactions
-        globalTime = 0.0f;
+        sim.globalTime = 0.0f;
         attractionMode = false;
         repulsionMode = false;
         attractionPoint = glm::vec3(0.0f);
         attractionStrength = 100.0f;
+        RebuildSpatialIndex(sim, interactionIndex);
+        
+        // Premier instantané : le rendu part de l'état initial
+        frame = sim;
+        cometTrailStep = sim.step;
+        snapshots.Clear();
+        PublishSnapshot(SimulationThread::Now());
+        
+        std::cout << "Mise à jour des entités par colonnes : noyaux "
+                  << EntityKernels::GetLevelName(EntityKernels::Get().level) << std::endl;
         
         return true;
     } catch (const std::exception& e) {
@@ -380,210 +633,209 @@ bool LightScene::LoadModels() {
 
 void LightScene::InitializeAsteroidRing() {
     std::cout << "Initialisation de l'anneau d'astéroïdes dense..." << std::endl;
+    Random random = Random::ForStream("LightScene.asteroids");
     
     for (int i = 0; i < ASTEROID_COUNT; ++i) {
-        AsteroidData& asteroid = asteroids[i];
-        
         // Répartition angulaire uniforme avec variations
-        asteroid.angleOffset = (2.0f * M_PI * i / ASTEROID_COUNT) + 
-                              ((rand() % 100) / 100.0f - 0.5f) * 0.5f;
+        sim.asteroids.angleOffset[i] = (2.0f * M_PI * i / ASTEROID_COUNT) + 
+                                   (random.UniformInt(100) / 100.0f - 0.5f) * 0.5f;
         
         // Rayon orbital avec variations (anneau dense entre 150 et 250)
         float baseRadius = 150.0f + (100.0f * i / ASTEROID_COUNT);
-        asteroid.radiusOffset = baseRadius + ((rand() % 100) / 100.0f - 0.5f) * 30.0f;
+        sim.asteroids.radiusOffset[i] = baseRadius + (random.UniformInt(100) / 100.0f - 0.5f) * 30.0f;
         
         // Échelle variée pour créer de la diversité visuelle
-        asteroid.scale = 8.0f + ((rand() % 100) / 100.0f) * 12.0f;
+        sim.asteroids.scale[i] = 8.0f + (random.UniformInt(100) / 100.0f) * 12.0f;
         
         // Vitesse de rotation propre aléatoire
-        asteroid.rotationSpeed = 0.5f + ((rand() % 100) / 100.0f) * 2.0f;
-        if (rand() % 2) asteroid.rotationSpeed *= -1; // Rotation dans les deux sens
+        sim.asteroids.rotationSpeed[i] = 0.5f + (random.UniformInt(100) / 100.0f) * 2.0f;
+        if (random.UniformInt(2)) sim.asteroids.rotationSpeed[i] *= -1; // Rotation dans les deux sens
         
         // Axe de rotation aléatoire
-        asteroid.rotationAxis = glm::normalize(glm::vec3(
-            (rand() % 100) / 100.0f - 0.5f,
-            (rand() % 100) / 100.0f - 0.5f,
-            (rand() % 100) / 100.0f - 0.5f
+        sim.asteroids.rotationAxis[i] = glm::normalize(glm::vec3(
+            random.UniformInt(100) / 100.0f - 0.5f,
+            random.UniformInt(100) / 100.0f - 0.5f,
+            random.UniformInt(100) / 100.0f - 0.5f
         ));
         
         // Couleur variée (tons rocheux/métalliques)
-        float colorVariation = (rand() % 100) / 100.0f;
-        asteroid.color = glm::mix(
+        float colorVariation = random.UniformInt(100) / 100.0f;
+        sim.asteroids.color[i] = glm::mix(
             glm::vec3(0.4f, 0.3f, 0.2f), // Brun rocheux
             glm::vec3(0.6f, 0.5f, 0.4f), // Beige métallique
             colorVariation
         );
         
         // Vitesse orbitale légèrement variée
-        asteroid.orbitSpeed = 0.3f + ((rand() % 100) / 100.0f) * 0.4f;
+        sim.asteroids.orbitSpeed[i] = 0.3f + (random.UniformInt(100) / 100.0f) * 0.4f;
         
         // Angle initial
-        asteroid.currentAngle = asteroid.angleOffset;
+        sim.asteroids.currentAngle[i] = sim.asteroids.angleOffset[i];
     }
 }
 
 void LightScene::InitializeSpaceships() {
     std::cout << "Initialisation de la flotte de vaisseaux spatiaux..." << std::endl;
+    Random random = Random::ForStream("LightScene.spaceships");
     
     for (int i = 0; i < SPACESHIP_COUNT; ++i) {
-        SpaceshipData& ship = spaceships[i];
-        
         // Couleurs variées pour la flotte
-        if (i % 5 == 0) ship.color = glm::vec3(0.2f, 0.4f, 1.0f); // Bleu
-        else if (i % 5 == 1) ship.color = glm::vec3(1.0f, 0.8f, 0.2f); // Doré
-        else if (i % 5 == 2) ship.color = glm::vec3(0.8f, 0.2f, 0.2f); // Rouge
-        else if (i % 5 == 3) ship.color = glm::vec3(0.2f, 0.8f, 0.2f); // Vert
-        else ship.color = glm::vec3(0.9f, 0.9f, 0.9f); // Blanc/Argent
+        if (i % 5 == 0) sim.spaceships.color[i] = glm::vec3(0.2f, 0.4f, 1.0f); // Bleu
+        else if (i % 5 == 1) sim.spaceships.color[i] = glm::vec3(1.0f, 0.8f, 0.2f); // Doré
+        else if (i % 5 == 2) sim.spaceships.color[i] = glm::vec3(0.8f, 0.2f, 0.2f); // Rouge
+        else if (i % 5 == 3) sim.spaceships.color[i] = glm::vec3(0.2f, 0.8f, 0.2f); // Vert
+        else sim.spaceships.color[i] = glm::vec3(0.9f, 0.9f, 0.9f); // Blanc/Argent
         
         // Position orbitale avec répartition en plusieurs anneaux
-        ship.angleOffset = (2.0f * M_PI * i / SPACESHIP_COUNT) + 
-                          ((rand() % 100) / 100.0f - 0.5f) * 0.3f;
+        sim.spaceships.angleOffset[i] = (2.0f * M_PI * i / SPACESHIP_COUNT) + 
+                                    (random.UniformInt(100) / 100.0f - 0.5f) * 0.3f;
         
         // Rayons orbitaux variés (plusieurs anneaux de vaisseaux)
         if (i < SPACESHIP_COUNT / 3) {
-            ship.orbitRadius = 300.0f + ((rand() % 100) / 100.0f) * 50.0f; // Anneau intérieur
+            sim.spaceships.orbitRadius[i] = 300.0f + (random.UniformInt(100) / 100.0f) * 50.0f; // Anneau intérieur
         } else if (i < 2 * SPACESHIP_COUNT / 3) {
-            ship.orbitRadius = 400.0f + ((rand() % 100) / 100.0f) * 50.0f; // Anneau moyen
+            sim.spaceships.orbitRadius[i] = 400.0f + (random.UniformInt(100) / 100.0f) * 50.0f; // Anneau moyen
         } else {
-            ship.orbitRadius = 500.0f + ((rand() % 100) / 100.0f) * 50.0f; // Anneau extérieur
+            sim.spaceships.orbitRadius[i] = 500.0f + (random.UniformInt(100) / 100.0f) * 50.0f; // Anneau extérieur
         }
         
         // Vitesse orbitale inversement proportionnelle au rayon
-        ship.orbitSpeed = 200.0f / ship.orbitRadius;
+        sim.spaceships.orbitSpeed[i] = 200.0f / sim.spaceships.orbitRadius[i];
         
-        ship.currentAngle = ship.angleOffset;
+        sim.spaceships.currentAngle[i] = sim.spaceships.angleOffset[i];
         
         // Décalages aléatoires pour mouvements naturels
-        ship.randomOffset = glm::vec3(
-            ((rand() % 100) / 100.0f - 0.5f) * 10.0f,
-            ((rand() % 100) / 100.0f - 0.5f) * 10.0f,
-            ((rand() % 100) / 100.0f - 0.5f) * 10.0f
+        sim.spaceships.randomOffset[i] = glm::vec3(
+            (random.UniformInt(100) / 100.0f - 0.5f) * 10.0f,
+            (random.UniformInt(100) / 100.0f - 0.5f) * 10.0f,
+            (random.UniformInt(100) / 100.0f - 0.5f) * 10.0f
         );
-        ship.randomPhase = (rand() % 100) / 100.0f * 2.0f * M_PI;
+        sim.spaceships.randomPhase[i] = random.UniformInt(100) / 100.0f * 2.0f * M_PI;
         
         // Paramètres d'oscillation verticale individuels
-        ship.heightFreq1 = 0.5f + ((rand() % 100) / 100.0f) * 1.0f;
-        ship.heightFreq2 = 1.0f + ((rand() % 100) / 100.0f) * 1.5f;
-        ship.heightFreq3 = 0.3f + ((rand() % 100) / 100.0f) * 0.7f;
-        ship.heightAmp1 = 5.0f + ((rand() % 100) / 100.0f) * 10.0f;
-        ship.heightAmp2 = 3.0f + ((rand() % 100) / 100.0f) * 6.0f;
-        ship.heightAmp3 = 2.0f + ((rand() % 100) / 100.0f) * 4.0f;
-        ship.heightPhase1 = (rand() % 100) / 100.0f * 2.0f * M_PI;
-        ship.heightPhase2 = (rand() % 100) / 100.0f * 2.0f * M_PI;
-        ship.heightPhase3 = (rand() % 100) / 100.0f * 2.0f * M_PI;
+        sim.spaceships.heightFreq1[i] = 0.5f + (random.UniformInt(100) / 100.0f) * 1.0f;
+        sim.spaceships.heightFreq2[i] = 1.0f + (random.UniformInt(100) / 100.0f) * 1.5f;
+        sim.spaceships.heightFreq3[i] = 0.3f + (random.UniformInt(100) / 100.0f) * 0.7f;
+        sim.spaceships.heightAmp1[i] = 5.0f + (random.UniformInt(100) / 100.0f) * 10.0f;
+        sim.spaceships.heightAmp2[i] = 3.0f + (random.UniformInt(100) / 100.0f) * 6.0f;
+        sim.spaceships.heightAmp3[i] = 2.0f + (random.UniformInt(100) / 100.0f) * 4.0f;
+        sim.spaceships.heightPhase1[i] = random.UniformInt(100) / 100.0f * 2.0f * M_PI;
+        sim.spaceships.heightPhase2[i] = random.UniformInt(100) / 100.0f * 2.0f * M_PI;
+        sim.spaceships.heightPhase3[i] = random.UniformInt(100) / 100.0f * 2.0f * M_PI;
         
         // Paramètres d'oscillation horizontale individuels
-        ship.horizontalFreq1 = 0.8f + ((rand() % 100) / 100.0f) * 1.2f;
-        ship.horizontalFreq2 = 1.2f + ((rand() % 100) / 100.0f) * 1.8f;
-        ship.horizontalAmp1 = 8.0f + ((rand() % 100) / 100.0f) * 12.0f;
-        ship.horizontalAmp2 = 5.0f + ((rand() % 100) / 100.0f) * 8.0f;
-        ship.horizontalPhase1 = (rand() % 100) / 100.0f * 2.0f * M_PI;
-        ship.horizontalPhase2 = (rand() % 100) / 100.0f * 2.0f * M_PI;
+        sim.spaceships.horizontalFreq1[i] = 0.8f + (random.UniformInt(100) / 100.0f) * 1.2f;
+        sim.spaceships.horizontalFreq2[i] = 1.2f + (random.UniformInt(100) / 100.0f) * 1.8f;
+        sim.spaceships.horizontalAmp1[i] = 8.0f + (random.UniformInt(100) / 100.0f) * 12.0f;
+        sim.spaceships.horizontalAmp2[i] = 5.0f + (random.UniformInt(100) / 100.0f) * 8.0f;
+        sim.spaceships.horizontalPhase1[i] = random.UniformInt(100) / 100.0f * 2.0f * M_PI;
+        sim.spaceships.horizontalPhase2[i] = random.UniformInt(100) / 100.0f * 2.0f * M_PI;
         
         // Échelle variée
-        ship.scale = 3.0f + ((rand() % 100) / 100.0f) * 2.0f;
+        sim.spaceships.scale[i] = 3.0f + (random.UniformInt(100) / 100.0f) * 2.0f;
     }
 }
 
-void LightScene::RenderSun(Camera& camera, int screenWidth, int screenHeight) {
+void LightScene::RenderSun() {
     if (!sunSphere) return;
     
     Shader* sunShader = ShaderManager::getInstance().GetSunShader();
     if (!sunShader) return;
     
-    sunShader->use();
-    sunShader->setFloat("time", static_cast<float>(glfwGetTime()));
-    
-    glm::mat4 model = glm::translate(glm::mat4(1.0f), sunPosition);
-    model = glm::scale(model, glm::vec3(sunRadius));
-    
-    glm::mat4 view = camera.GetViewMatrix();
-    glm::mat4 projection = glm::perspective(glm::radians(camera.Zoom), 
-                                          (float)screenWidth / screenHeight, 0.1f, 1000.0f);
-    
-    sunShader->setMat4("model", model);
-    sunShader->setMat4("view", view);
-    sunShader->setMat4("projection", projection);
-    
-    sunSphere->Draw(*sunShader);
+    // La sphère est déjà construite au rayon du soleil
+    DrawPacket packet;
+    packet.shader = sunShader;
+    packet.model = glm::translate(glm::mat4(1.0f), sunPosition);
+    if (IsBodyVisible(sunSphere->GetBoundingSphere().Transformed(packet.model))) {
+        sunSphere->Submit(RenderQueue::getInstance(), packet);
+    }
 }
 
-void LightScene::RenderAsteroidRing(Camera& camera, int screenWidth, int screenHeight) {
+void LightScene::RenderAsteroidRing(Camera& camera, int screenHeight) {
     if (!asteroidModel) return;
     
-    Shader* shader = ShaderManager::getInstance().GetCurrentLightingShader();
+    Shader* shader = ShaderManager::getInstance().GetCurrentInstancedLightingShader();
     if (!shader) return;
     
-    shader->use();
-    
-    glm::mat4 view = camera.GetViewMatrix();
-    glm::mat4 projection = glm::perspective(glm::radians(camera.Zoom), 
-                                          (float)screenWidth / screenHeight, 0.1f, 1000.0f);
+    float lodPixelScale = Model::GetLodPixelScale(camera.Zoom, screenHeight);
+    // Les échelles de l'anneau sont des rayons dans la scène : modèle ramené à un rayon unité
+    float unitScale = 1.0f / asteroidModel->GetBoundingRadius();
+    const BoundingSphere& bounds = asteroidModel->GetBoundingSphere();
     
-    shader->setMat4("view", view);
-    shader->setMat4("projection", projection);
+    bool onGpu = IsGpuCullingActive();
     
+    BeginCulling();
+    instanceData.resize(ASTEROID_COUNT);
+    instanceLods.resize(ASTEROID_COUNT);
     for (int i = 0; i < ASTEROID_COUNT; ++i) {
-        const AsteroidData& asteroid = asteroids[i];
-        
         // Position orbitale
-        float x = asteroid.radiusOffset * cos(asteroid.currentAngle);
-        float z = asteroid.radiusOffset * sin(asteroid.currentAngle);
-        float y = sin(asteroid.currentAngle * 3.0f) * 10.0f; // Légère ondulation verticale
+        float x = frame.asteroids.radiusOffset[i] * cos(frame.asteroids.currentAngle[i]);
+        float z = frame.asteroids.radiusOffset[i] * sin(frame.asteroids.currentAngle[i]);
+        float y = sin(frame.asteroids.currentAngle[i] * 3.0f) * 10.0f; // Légère ondulation verticale
         
         glm::mat4 model = glm::translate(glm::mat4(1.0f), glm::vec3(x, y, z));
         
         // Rotation propre
         model = glm::rotate(model, 
-                           asteroid.rotationSpeed * static_cast<float>(glfwGetTime()), 
-                           asteroid.rotationAxis);
+                           frame.asteroids.rotationSpeed[i] * static_cast<float>(glfwGetTime()), 
+                           frame.asteroids.rotationAxis[i]);
         
         // Échelle
-        model = glm::scale(model, glm::vec3(asteroid.scale));
+        float scale = frame.asteroids.scale[i] * unitScale;
+        model = glm::scale(model, glm::vec3(scale));
         
-        shader->setMat4("model", model);
-        shader->setVec3("objectColor", asteroid.color);
-        
-        asteroidModel->Draw(*shader);
+        instanceData[i].model = model;
+        instanceData[i].color = glm::vec4(frame.asteroids.color[i], 1.0f);
+        if (onGpu) {
+            continue; // LOD et visibilité décidés par le compute shader
+        }
+        frame.asteroids.lod[i] = asteroidModel->SelectLod(glm::distance(camera.Position, glm::vec3(x, y, z)),
+                                                    scale, lodPixelScale, frame.asteroids.lod[i]);
+        instanceLods[i] = frame.asteroids.lod[i];
+        cullBatch.Add(bounds.Transformed(model));
+    }
+    
+    if (onGpu) {
+        DrawInstancesOnGpu(asteroidCuller, *asteroidModel, *shader, CULL_ASTEROIDS, camera, lodPixelScale);
+        return;
     }
+    RunCulling(CULL_ASTEROIDS);
+    KeepVisibleInstances();
+    
+    shader->use();
+    DrawInstancesByLod(*asteroidModel, *shader, asteroidInstances);
 }
 
-void LightScene::RenderSpaceships(Camera& camera, int screenWidth, int screenHeight) {
+void LightScene::RenderSpaceships(Camera& camera, int screenHeight) {
     if (!spaceshipModel) return;
     
     Shader* shader = ShaderManager::getInstance().GetCurrentLightingShader();
     if (!shader) return;
     
-    shader->use();
-    
-    glm::mat4 view = camera.GetViewMatrix();
-    glm::mat4 projection = glm::perspective(glm::radians(camera.Zoom), 
-                                          (float)screenWidth / screenHeight, 0.1f, 1000.0f);
-    
-    shader->setMat4("view", view);
-    shader->setMat4("projection", projection);
+    float lodPixelScale = Model::GetLodPixelScale(camera.Zoom, screenHeight);
+    float unitScale = 1.0f / spaceshipModel->GetBoundingRadius();
+    const BoundingSphere& bounds = spaceshipModel->GetBoundingSphere();
     
+    BeginCulling();
     for (int i = 0; i < SPACESHIP_COUNT; ++i) {
-        const SpaceshipData& ship = spaceships[i];
-        
         // Position orbitale de base
-        float baseX = ship.orbitRadius * cos(ship.currentAngle);
-        float baseZ = ship.orbitRadius * sin(ship.currentAngle);
+        float baseX = frame.spaceships.orbitRadius[i] * cos(frame.spaceships.currentAngle[i]);
+        float baseZ = frame.spaceships.orbitRadius[i] * sin(frame.spaceships.currentAngle[i]);
         
         // Oscillations verticales complexes
-        float heightOffset = ship.heightAmp1 * sin(ship.heightPhase1) +
-                           ship.heightAmp2 * sin(ship.heightPhase2) +
-                           ship.heightAmp3 * sin(ship.heightPhase3);
+        float heightOffset = frame.spaceships.heightAmp1[i] * sin(frame.spaceships.heightPhase1[i]) +
+                           frame.spaceships.heightAmp2[i] * sin(frame.spaceships.heightPhase2[i]) +
+                           frame.spaceships.heightAmp3[i] * sin(frame.spaceships.heightPhase3[i]);
         
         // Oscillations horizontales
-        float horizontalOffset1 = ship.horizontalAmp1 * sin(ship.horizontalPhase1);
-        float horizontalOffset2 = ship.horizontalAmp2 * sin(ship.horizontalPhase2);
+        float horizontalOffset1 = frame.spaceships.horizontalAmp1[i] * sin(frame.spaceships.horizontalPhase1[i]);
+        float horizontalOffset2 = frame.spaceships.horizontalAmp2[i] * sin(frame.spaceships.horizontalPhase2[i]);
         
         // Position finale avec tous les mouvements
         glm::vec3 finalPos = glm::vec3(
-            baseX + horizontalOffset1 * cos(ship.currentAngle + M_PI/2) + ship.randomOffset.x,
-            heightOffset + ship.randomOffset.y,
-            baseZ + horizontalOffset1 * sin(ship.currentAngle + M_PI/2) + ship.randomOffset.z
+            baseX + horizontalOffset1 * cos(frame.spaceships.currentAngle[i] + M_PI/2) + frame.spaceships.randomOffset[i].x,
+            heightOffset + frame.spaceships.randomOffset[i].y,
+            baseZ + horizontalOffset1 * sin(frame.spaceships.currentAngle[i] + M_PI/2) + frame.spaceships.randomOffset[i].z
         );
         
         glm::mat4 model = glm::translate(glm::mat4(1.0f), finalPos);
@@ -593,28 +845,36 @@ void LightScene::RenderSpaceships(Camera& camera, int screenWidth, int screenHei
         float rotationAngle = atan2(direction.x, direction.z);
         model = glm::rotate(model, rotationAngle, glm::vec3(0.0f, 1.0f, 0.0f));
         
-        // Échelle
-        model = glm::scale(model, glm::vec3(ship.scale));
-        
-        shader->setMat4("model", model);
-        shader->setVec3("objectColor", ship.color);
-        
-        spaceshipModel->Draw(*shader);
+        // Échelle (la colonne scale est le rayon voulu)
+        float scale = frame.spaceships.scale[i] * unitScale;
+        model = glm::scale(model, glm::vec3(scale));
+        
+        DrawPacket packet;
+        packet.shader = shader;
+        packet.model = model;
+        packet.color = frame.spaceships.color[i];
+        packet.hasColor = true;
+        
+        frame.spaceships.lod[i] = spaceshipModel->SelectLod(glm::distance(camera.Position, finalPos), scale, lodPixelScale,
+                                                      frame.spaceships.lod[i]);
+        cullBatch.Add(bounds.Transformed(model));
+        pendingPackets.push_back(packet);
+        pendingLods.push_back(frame.spaceships.lod[i]);
     }
+    RunCulling(CULL_SPACESHIPS);
+    SubmitVisiblePackets(*spaceshipModel);
 }
 
-void LightScene::RenderMoon(Camera& camera, int screenWidth, int screenHeight) {
+void LightScene::RenderMoon() {
     if (!moonSphere) return;
     
     Shader* shader = ShaderManager::getInstance().GetCurrentLightingShader();
     if (!shader) return;
     
-    shader->use();
-    
     // Position orbitale de la lune
-    float x = moonOrbitRadius * cos(moonCurrentAngle);
-    float z = moonOrbitRadius * sin(moonCurrentAngle);
-    float y = sin(moonCurrentAngle * 0.5f) * 20.0f; // Légère inclinaison orbitale
+    float x = moonOrbitRadius * cos(frame.moonCurrentAngle);
+    float z = moonOrbitRadius * sin(frame.moonCurrentAngle);
+    float y = sin(frame.moonCurrentAngle * 0.5f) * 20.0f; // Légère inclinaison orbitale
     
     glm::mat4 model = glm::translate(glm::mat4(1.0f), glm::vec3(x, y, z));
     
@@ -623,183 +883,173 @@ void LightScene::RenderMoon(Camera& camera, int screenWidth, int screenHeight) {
                        moonSelfRotSpeed * static_cast<float>(glfwGetTime()), 
                        glm::vec3(0.0f, 1.0f, 0.1f));
     
-    // Échelle
-    model = glm::scale(model, glm::vec3(moonRadius));
-    
-    glm::mat4 view = camera.GetViewMatrix();
-    glm::mat4 projection = glm::perspective(glm::radians(camera.Zoom), 
-                                          (float)screenWidth / screenHeight, 0.1f, 1000.0f);
-    
-    shader->setMat4("model", model);
-    shader->setMat4("view", view);
-    shader->setMat4("projection", projection);
-    shader->setVec3("objectColor", glm::vec3(0.9f, 0.9f, 0.8f)); // Couleur lunaire
-    
-    moonSphere->Draw(*shader);
+    // La sphère est déjà construite au rayon de la lune
+    DrawPacket packet;
+    packet.shader = shader;
+    packet.model = model;
+    packet.color = glm::vec3(0.9f, 0.9f, 0.8f); // Couleur lunaire
+    packet.hasColor = true;
+    if (IsBodyVisible(moonSphere->GetBoundingSphere().Transformed(model))) {
+        moonSphere->Submit(RenderQueue::getInstance(), packet);
+    }
 }
 
 // === IMPLÉMENTATION DES NOUVEAUX ÉLÉMENTS DYNAMIQUES ===
 
 void LightScene::InitializeStations() {
     std::cout << "Initialisation des stations spatiales rotatives..." << std::endl;
+    Random random = Random::ForStream("LightScene.stations");
     
     for (int i = 0; i < STATION_COUNT; ++i) {
-        SpaceStation& station = stations[i];
+        SpaceStation& station = sim.stations[i];
         
         // Position orbitale autour du soleil
         float angle = (2.0f * M_PI * i / STATION_COUNT);
-        float radius = 350.0f + (rand() % 100);
+        float radius = 350.0f + random.UniformInt(100);
         station.position = glm::vec3(radius * cos(angle), 
-                                   ((rand() % 100) - 50) * 2.0f, 
+                                   (random.UniformInt(100) - 50) * 2.0f, 
                                    radius * sin(angle));
         
         // Rotation propre
-        station.rotationSpeed = 0.5f + (rand() % 100) / 200.0f;
-        station.currentRotation = (rand() % 360) * M_PI / 180.0f;
+        station.rotationSpeed = 0.5f + random.UniformInt(100) / 200.0f;
+        station.currentRotation = random.UniformInt(360) * M_PI / 180.0f;
         station.rotationAxis = glm::normalize(glm::vec3(
-            (rand() % 100) / 100.0f - 0.5f,
+            random.UniformInt(100) / 100.0f - 0.5f,
             1.0f,
-            (rand() % 100) / 100.0f - 0.5f
+            random.UniformInt(100) / 100.0f - 0.5f
         ));
         
         // Apparence
-        station.scale = 5.0f + (rand() % 100) / 50.0f;
-        station.color = glm::vec3(0.7f + (rand() % 30) / 100.0f, 
-                                 0.7f + (rand() % 30) / 100.0f, 
+        station.scale = 5.0f + random.UniformInt(100) / 50.0f;
+        station.color = glm::vec3(0.7f + random.UniformInt(30) / 100.0f, 
+                                 0.7f + random.UniformInt(30) / 100.0f, 
                                  0.9f);
         
         // Orbite
         station.orbitAngle = angle;
         station.orbitRadius = radius;
-        station.orbitSpeed = 0.1f + (rand() % 50) / 500.0f;
+        station.orbitSpeed = 0.1f + random.UniformInt(50) / 500.0f;
         
         // Défenses
         station.turretRotation = 0.0f;
-        station.turretSpeed = 2.0f + (rand() % 100) / 50.0f;
+        station.turretSpeed = 2.0f + random.UniformInt(100) / 50.0f;
     }
 }
 
 void LightScene::InitializeComets() {
     std::cout << "Initialisation des comètes avec traînées..." << std::endl;
+    cometRandom = Random::ForStream("LightScene.comets");
     
-    comets.clear();
+    sim.comets.clear();
+    cometTrails.Resize(COMET_COUNT, COMET_TRAIL_CAPACITY);
     for (int i = 0; i < COMET_COUNT; ++i) {
         Comet comet;
         
         // Position de départ aléatoire lointaine
-        float angle = (rand() % 360) * M_PI / 180.0f;
-        float distance = 800.0f + (rand() % 400);
+        float angle = cometRandom.UniformInt(360) * M_PI / 180.0f;
+        float distance = 800.0f + cometRandom.UniformInt(400);
         comet.position = glm::vec3(distance * cos(angle), 
-                                  ((rand() % 200) - 100) * 3.0f, 
+                                  (cometRandom.UniformInt(200) - 100) * 3.0f, 
                                   distance * sin(angle));
         
         // Vitesse dirigée vers le centre avec variation
         glm::vec3 direction = glm::normalize(-comet.position);
-        direction += glm::vec3((rand() % 100) / 200.0f - 0.25f,
-                              (rand() % 100) / 200.0f - 0.25f,
-                              (rand() % 100) / 200.0f - 0.25f);
-        comet.velocity = direction * (30.0f + (rand() % 40));
-        
-        // Traînée
-        comet.trailLength = 20 + (rand() % 30);
-        comet.trailPositions.clear();
-        for (int j = 0; j < comet.trailLength; ++j) {
-            comet.trailPositions.push_back(comet.position);
-        }
+        direction += glm::vec3(cometRandom.UniformInt(100) / 200.0f - 0.25f,
+                              cometRandom.UniformInt(100) / 200.0f - 0.25f,
+                              cometRandom.UniformInt(100) / 200.0f - 0.25f);
+        comet.velocity = direction * (30.0f + cometRandom.UniformInt(40));
         
-        // Apparence
-        comet.color = glm::vec3(0.8f + (rand() % 20) / 100.0f,
-                               0.6f + (rand() % 40) / 100.0f,
-                               0.2f + (rand() % 30) / 100.0f);
-        comet.brightness = 0.5f + (rand() % 50) / 100.0f;
-        comet.pulseSpeed = 2.0f + (rand() % 100) / 50.0f;
-        comet.currentPhase = (rand() % 360) * M_PI / 180.0f;
-        comet.size = 2.0f + (rand() % 100) / 50.0f;
+        // Traînée : échantillon figé du pas initial, puis tête qui suivra la comète
+        comet.trailLength = 20 + cometRandom.UniformInt(30);
+        cometTrails.Reset(i, comet.position, static_cast<size_t>(comet.trailLength));
+        cometTrails.Push(i, comet.position);
         
-        comets.push_back(comet);
+        // Apparence
+        comet.color = glm::vec3(0.8f + cometRandom.UniformInt(20) / 100.0f,
+                               0.6f + cometRandom.UniformInt(40) / 100.0f,
+                               0.2f + cometRandom.UniformInt(30) / 100.0f);
+        comet.brightness = 0.5f + cometRandom.UniformInt(50) / 100.0f;
+        comet.pulseSpeed = 2.0f + cometRandom.UniformInt(100) / 50.0f;
+        comet.currentPhase = cometRandom.UniformInt(360) * M_PI / 180.0f;
+        comet.size = 2.0f + cometRandom.UniformInt(100) / 50.0f;
+        
+        sim.comets.push_back(comet);
     }
 }
 
 void LightScene::InitializeDebris() {
     std::cout << "Initialisation des débris spatiaux..." << std::endl;
+    debrisRandom = Random::ForStream("LightScene.debris");
     
-    debris.clear();
+    sim.debris.resize(DEBRIS_COUNT);
     for (int i = 0; i < DEBRIS_COUNT; ++i) {
-        SpaceDebris d;
-        
         // Position aléatoire dans un volume sphérique
-        float radius = 100.0f + (rand() % 600);
-        float theta = (rand() % 360) * M_PI / 180.0f;
-        float phi = (rand() % 180) * M_PI / 180.0f;
-        
-        d.position = glm::vec3(radius * sin(phi) * cos(theta),
-                              radius * cos(phi),
-                              radius * sin(phi) * sin(theta));
+        sim.debris.position[i] = debrisRandom.OnSphere() * debrisRandom.Uniform(100.0f, 700.0f);
         
         // Vitesse chaotique
-        d.velocity = glm::vec3((rand() % 100) / 50.0f - 1.0f,
-                              (rand() % 100) / 50.0f - 1.0f,
-                              (rand() % 100) / 50.0f - 1.0f) * 5.0f;
+        sim.debris.velocity[i] = glm::vec3(debrisRandom.UniformInt(100) / 50.0f - 1.0f,
+                                       debrisRandom.UniformInt(100) / 50.0f - 1.0f,
+                                       debrisRandom.UniformInt(100) / 50.0f - 1.0f) * 5.0f;
         
         // Rotation chaotique
-        d.angularVelocity = glm::vec3((rand() % 100) / 25.0f - 2.0f,
-                                     (rand() % 100) / 25.0f - 2.0f,
-                                     (rand() % 100) / 25.0f - 2.0f);
-        d.rotation = glm::vec3(0.0f);
+        sim.debris.angularVelocity[i] = glm::vec3(debrisRandom.UniformInt(100) / 25.0f - 2.0f,
+                                              debrisRandom.UniformInt(100) / 25.0f - 2.0f,
+                                              debrisRandom.UniformInt(100) / 25.0f - 2.0f);
+        sim.debris.rotation[i] = glm::vec3(0.0f);
         
         // Apparence
-        d.scale = 0.5f + (rand() % 100) / 100.0f;
-        d.color = glm::vec3(0.3f + (rand() % 40) / 100.0f,
-                           0.3f + (rand() % 40) / 100.0f,
-                           0.3f + (rand() % 40) / 100.0f);
+        sim.debris.scale[i] = 0.5f + debrisRandom.UniformInt(100) / 100.0f;
+        sim.debris.color[i] = glm::vec3(0.3f + debrisRandom.UniformInt(40) / 100.0f,
+                                    0.3f + debrisRandom.UniformInt(40) / 100.0f,
+                                    0.3f + debrisRandom.UniformInt(40) / 100.0f);
         
         // Durée de vie
-        d.maxLifetime = 60.0f + (rand() % 120);
-        d.lifetime = d.maxLifetime;
-        
-        debris.push_back(d);
+        sim.debris.maxLifetime[i] = 60.0f + debrisRandom.UniformInt(120);
+        sim.debris.lifetime[i] = sim.debris.maxLifetime[i];
     }
 }
 
 void LightScene::InitializePortals() {
     std::cout << "Initialisation des portails énergétiques..." << std::endl;
+    Random random = Random::ForStream("LightScene.portals");
     
     for (int i = 0; i < PORTAL_COUNT; ++i) {
-        EnergyPortal& portal = portals[i];
+        EnergyPortal& portal = sim.portals[i];
         
         // Position stratégique
         float angle = (2.0f * M_PI * i / PORTAL_COUNT);
-        float radius = 600.0f + (rand() % 200);
+        float radius = 600.0f + random.UniformInt(200);
         portal.position = glm::vec3(radius * cos(angle),
-                                   ((rand() % 100) - 50) * 4.0f,
+                                   (random.UniformInt(100) - 50) * 4.0f,
                                    radius * sin(angle));
         
         // Rotation
-        portal.rotationSpeed = 1.0f + (rand() % 100) / 50.0f;
-        portal.currentRotation = (rand() % 360) * M_PI / 180.0f;
+        portal.rotationSpeed = 1.0f + random.UniformInt(100) / 50.0f;
+        portal.currentRotation = random.UniformInt(360) * M_PI / 180.0f;
         
         // Pulsation énergétique
-        portal.pulseIntensity = 0.5f + (rand() % 50) / 100.0f;
-        portal.pulseSpeed = 2.0f + (rand() % 100) / 50.0f;
+        portal.pulseIntensity = 0.5f + random.UniformInt(50) / 100.0f;
+        portal.pulseSpeed = 2.0f + random.UniformInt(100) / 50.0f;
         
         // Couleurs énergétiques
-        portal.color1 = glm::vec3(0.2f + (rand() % 60) / 100.0f,
-                                 0.6f + (rand() % 40) / 100.0f,
+        portal.color1 = glm::vec3(0.2f + random.UniformInt(60) / 100.0f,
+                                 0.6f + random.UniformInt(40) / 100.0f,
                                  1.0f);
         portal.color2 = glm::vec3(1.0f,
-                                 0.2f + (rand() % 60) / 100.0f,
-                                 0.8f + (rand() % 20) / 100.0f);
+                                 0.2f + random.UniformInt(60) / 100.0f,
+                                 0.8f + random.UniformInt(20) / 100.0f);
         
-        portal.size = 8.0f + (rand() % 100) / 25.0f;
+        portal.size = 8.0f + random.UniformInt(100) / 25.0f;
         portal.energyFlow = 0.0f;
     }
 }
 
 void LightScene::InitializeSatellites() {
     std::cout << "Initialisation des satellites en formation..." << std::endl;
+    satelliteRandom = Random::ForStream("LightScene.satellites");
     
     for (int i = 0; i < SATELLITE_COUNT; ++i) {
-        Satellite& sat = satellites[i];
+        Satellite& sat = sim.satellites[i];
         
         // Formation en grille orbitale
         int layer = i / 10;
@@ -813,66 +1063,60 @@ void LightScene::InitializeSatellites() {
         
         // Antennes rotatives
         sat.antennaRotation = glm::vec3(0.0f);
-        sat.antennaSpeed = 1.0f + (rand() % 100) / 100.0f;
+        sat.antennaSpeed = 1.0f + satelliteRandom.UniformInt(100) / 100.0f;
         
         // État et apparence
-        sat.isActive = (rand() % 10) > 2; // 80% actifs
+        sat.isActive = satelliteRandom.UniformInt(10) > 2; // 80% actifs
         sat.color = sat.isActive ? 
                    glm::vec3(0.2f, 1.0f, 0.3f) :  // Vert si actif
                    glm::vec3(0.8f, 0.2f, 0.2f);   // Rouge si inactif
         
-        sat.signalPulse = (rand() % 360) * M_PI / 180.0f;
+        sat.signalPulse = satelliteRandom.UniformInt(360) * M_PI / 180.0f;
     }
 }
 
 void LightScene::InitializeParticleClouds() {
     std::cout << "Initialisation des nuages de particules énergétiques..." << std::endl;
+    Random random = Random::ForStream("LightScene.particleClouds");
     
-    particleClouds.clear();
+    sim.particleClouds.clear();
     for (int i = 0; i < PARTICLE_CLOUD_COUNT; ++i) {
         ParticleCloud cloud;
         
         // Position aléatoire
-        float angle = (rand() % 360) * M_PI / 180.0f;
-        float radius = 400.0f + (rand() % 300);
+        float angle = random.UniformInt(360) * M_PI / 180.0f;
+        float radius = 400.0f + random.UniformInt(300);
         cloud.center = glm::vec3(radius * cos(angle),
-                                ((rand() % 200) - 100) * 2.0f,
+                                (random.UniformInt(200) - 100) * 2.0f,
                                 radius * sin(angle));
         
-        cloud.radius = 30.0f + (rand() % 50);
-        cloud.rotationSpeed = 0.5f + (rand() % 100) / 200.0f;
+        cloud.radius = 30.0f + random.UniformInt(50);
+        cloud.rotationSpeed = 0.5f + random.UniformInt(100) / 200.0f;
         cloud.currentRotation = 0.0f;
         
         // Couleur énergétique
-        cloud.color = glm::vec3(0.5f + (rand() % 50) / 100.0f,
-                               0.2f + (rand() % 60) / 100.0f,
-                               0.8f + (rand() % 20) / 100.0f);
+        cloud.color = glm::vec3(0.5f + random.UniformInt(50) / 100.0f,
+                               0.2f + random.UniformInt(60) / 100.0f,
+                               0.8f + random.UniformInt(20) / 100.0f);
         
-        cloud.intensity = 0.3f + (rand() % 70) / 100.0f;
-        cloud.pulseSpeed = 1.0f + (rand() % 100) / 100.0f;
+        cloud.intensity = 0.3f + random.UniformInt(70) / 100.0f;
+        cloud.pulseSpeed = 1.0f + random.UniformInt(100) / 100.0f;
         
         // Particules individuelles
-        int particleCount = 50 + (rand() % 100);
-        cloud.particlePositions.clear();
-        cloud.particleVelocities.clear();
+        int particleCount = 50 + random.UniformInt(100);
         
-        for (int j = 0; j < particleCount; ++j) {
-            // Position aléatoire dans la sphère
-            float r = cloud.radius * pow((rand() % 1000) / 1000.0f, 1.0f/3.0f);
-            float theta = (rand() % 360) * M_PI / 180.0f;
-            float phi = (rand() % 180) * M_PI / 180.0f;
-            
-            glm::vec3 particlePos = glm::vec3(r * sin(phi) * cos(theta),
-                                             r * cos(phi),
-                                             r * sin(phi) * sin(theta));
-            cloud.particlePositions.push_back(particlePos);
-            
-            // Vitesse orbitale autour du centre
+        // Positions aléatoires dans la sphère, tirées d'un bloc
+        cloud.particlePositions.resize(particleCount);
+        random.FillInSphere(cloud.particlePositions.data(), cloud.particlePositions.size(), cloud.radius);
+        
+        // Vitesse orbitale autour du centre
+        cloud.particleVelocities.clear();
+        for (const glm::vec3& particlePos : cloud.particlePositions) {
             glm::vec3 velocity = glm::cross(particlePos, glm::vec3(0.0f, 1.0f, 0.0f)) * 0.1f;
             cloud.particleVelocities.push_back(velocity);
         }
         
-        particleClouds.push_back(cloud);
+        sim.particleClouds.push_back(cloud);
     }
 }
 
@@ -880,7 +1124,7 @@ void LightScene::InitializeParticleClouds() {
 
 void LightScene::UpdateStations(float deltaTime) {
     for (int i = 0; i < STATION_COUNT; ++i) {
-        SpaceStation& station = stations[i];
+        SpaceStation& station = sim.stations[i];
         
         // Rotation propre
         station.currentRotation += station.rotationSpeed * deltaTime;
@@ -898,15 +1142,11 @@ void LightScene::UpdateStations(float deltaTime) {
 }
 
 void LightScene::UpdateComets(float deltaTime) {
-    for (auto& comet : comets) {
-        // Mouvement
-        comet.position += comet.velocity * deltaTime;
+    for (size_t i = 0; i < sim.comets.size(); ++i) {
+        Comet& comet = sim.comets[i];
         
-        // Mise à jour de la traînée
-        comet.trailPositions.insert(comet.trailPositions.begin(), comet.position);
-        if (comet.trailPositions.size() > comet.trailLength) {
-            comet.trailPositions.pop_back();
-        }
+        // Mouvement (la traînée est échantillonnée au rendu, voir BlendSnapshots)
+        comet.position += comet.velocity * deltaTime;
         
         // Pulsation lumineuse
         comet.currentPhase += comet.pulseSpeed * deltaTime;
@@ -915,61 +1155,73 @@ void LightScene::UpdateComets(float deltaTime) {
         // Reset si trop loin du centre
         if (glm::length(comet.position) > 1200.0f) {
             // Nouvelle position lointaine
-            float angle = (rand() % 360) * M_PI / 180.0f;
-            float distance = 800.0f + (rand() % 400);
+            float angle = cometRandom.UniformInt(360) * M_PI / 180.0f;
+            float distance = 800.0f + cometRandom.UniformInt(400);
             comet.position = glm::vec3(distance * cos(angle), 
-                                      ((rand() % 200) - 100) * 3.0f, 
+                                      (cometRandom.UniformInt(200) - 100) * 3.0f, 
                                       distance * sin(angle));
             
             // Nouvelle direction vers le centre
             glm::vec3 direction = glm::normalize(-comet.position);
-            direction += glm::vec3((rand() % 100) / 200.0f - 0.25f,
-                                  (rand() % 100) / 200.0f - 0.25f,
-                                  (rand() % 100) / 200.0f - 0.25f);
-            comet.velocity = direction * (30.0f + (rand() % 40));
+            direction += glm::vec3(cometRandom.UniformInt(100) / 200.0f - 0.25f,
+                                  cometRandom.UniformInt(100) / 200.0f - 0.25f,
+                                  cometRandom.UniformInt(100) / 200.0f - 0.25f);
+            comet.velocity = direction * (30.0f + cometRandom.UniformInt(40));
             
-            // Reset traînée
-            comet.trailPositions.clear();
-            for (int j = 0; j < comet.trailLength; ++j) {
-                comet.trailPositions.push_back(comet.position);
-            }
+            // Reset traînée au prochain rendu
+            comet.generation++;
         }
     }
 }
 
 void LightScene::UpdateDebris(float deltaTime) {
-    for (auto& d : debris) {
-        // Mouvement
-        d.position += d.velocity * deltaTime;
-        d.rotation += d.angularVelocity * deltaTime;
-        
-        // Durée de vie
-        d.lifetime -= deltaTime;
-        
-        // Respawn si nécessaire
-        if (d.lifetime <= 0.0f) {
-            // Nouvelle position
-            float radius = 100.0f + (rand() % 600);
-            float theta = (rand() % 360) * M_PI / 180.0f;
-            float phi = (rand() % 180) * M_PI / 180.0f;
-            
-            d.position = glm::vec3(radius * sin(phi) * cos(theta),
-                                  radius * cos(phi),
-                                  radius * sin(phi) * sin(theta));
-            
-            // Nouvelle vitesse
-            d.velocity = glm::vec3((rand() % 100) / 50.0f - 1.0f,
-                                  (rand() % 100) / 50.0f - 1.0f,
-                                  (rand() % 100) / 50.0f - 1.0f) * 5.0f;
-            
-            d.lifetime = d.maxLifetime;
+    const EntityKernels& kernels = EntityKernels::Get();
+    size_t count = sim.debris.size();
+    
+    // Mouvement, rotation et durée de vie par tranches réparties sur les threads ; les
+    // colonnes de vec3 sont traitées composante par composante
+    JobSystem::getInstance().ParallelFor(count, DEBRIS_CHUNK_SIZE, [&](size_t begin, size_t end) {
+        size_t size = end - begin;
+        kernels.integrate(components(sim.debris.position) + begin * 3, components(sim.debris.velocity) + begin * 3,
+                          size * 3, deltaTime);
+        kernels.integrate(components(sim.debris.rotation) + begin * 3, components(sim.debris.angularVelocity) + begin * 3,
+                          size * 3, deltaTime);
+        kernels.add(sim.debris.lifetime.data() + begin, size, -deltaTime);
+    });
+    
+    // Respawn si nécessaire (rare, reste scalaire)
+    for (size_t i = 0; i < count; ++i) {
+        if (sim.debris.lifetime[i] > 0.0f) {
+            continue;
         }
+        
+        // Nouvelle position
+        sim.debris.position[i] = debrisRandom.OnSphere() * debrisRandom.Uniform(100.0f, 700.0f);
+        
+        // Nouvelle vitesse
+        sim.debris.velocity[i] = glm::vec3(debrisRandom.UniformInt(100) / 50.0f - 1.0f,
+                                       debrisRandom.UniformInt(100) / 50.0f - 1.0f,
+                                       debrisRandom.UniformInt(100) / 50.0f - 1.0f) * 5.0f;
+        
+        sim.debris.lifetime[i] = sim.debris.maxLifetime[i];
     }
 }
 
+void LightScene::DebrisField::resize(size_t count) {
+    position.resize(count);
+    velocity.resize(count);
+    angularVelocity.resize(count);
+    rotation.resize(count);
+    scale.resize(count);
+    color.resize(count);
+    lifetime.resize(count);
+    maxLifetime.resize(count);
+    lod.resize(count, 0);
+}
+
 void LightScene::UpdatePortals(float deltaTime) {
     for (int i = 0; i < PORTAL_COUNT; ++i) {
-        EnergyPortal& portal = portals[i];
+        EnergyPortal& portal = sim.portals[i];
         
         // Rotation continue
         portal.currentRotation += portal.rotationSpeed * deltaTime;
@@ -982,7 +1234,7 @@ void LightScene::UpdatePortals(float deltaTime) {
 
 void LightScene::UpdateSatellites(float deltaTime) {
     for (int i = 0; i < SATELLITE_COUNT; ++i) {
-        Satellite& sat = satellites[i];
+        Satellite& sat = sim.satellites[i];
         
         // Orbite
         sat.currentAngle += sat.orbitSpeed * deltaTime;
@@ -995,7 +1247,7 @@ void LightScene::UpdateSatellites(float deltaTime) {
         sat.signalPulse += deltaTime * 4.0f;
         
         // Changement d'état aléatoire
-        if ((rand() % 10000) < 5) { // 0.05% de chance par frame
+        if (satelliteRandom.UniformInt(10000) < 5) { // 0.05% de chance par frame
             sat.isActive = !sat.isActive;
             sat.color = sat.isActive ? 
                        glm::vec3(0.2f, 1.0f, 0.3f) : 
@@ -1005,22 +1257,29 @@ void LightScene::UpdateSatellites(float deltaTime) {
 }
 
 void LightScene::UpdateParticleClouds(float deltaTime) {
-    for (auto& cloud : particleClouds) {
-        // Rotation du nuage
-        cloud.currentRotation += cloud.rotationSpeed * deltaTime;
-        
-        // Pulsation d'intensité
-        cloud.intensity = 0.3f + 0.4f * sin(globalTime * cloud.pulseSpeed);
+    // Un nuage par tranche : chaque nuage n'écrit que ses propres particules
+    JobSystem::getInstance().ParallelFor(sim.particleClouds.size(), 1, [&](size_t begin, size_t end) {
+        for (size_t c = begin; c < end; ++c) {
+            UpdateParticleCloud(sim.particleClouds[c], deltaTime);
+        }
+    });
+}
+
+void LightScene::UpdateParticleCloud(ParticleCloud& cloud, float deltaTime) {
+    // Rotation du nuage
+    cloud.currentRotation += cloud.rotationSpeed * deltaTime;
+    
+    // Pulsation d'intensité
+    cloud.intensity = 0.3f + 0.4f * sin(sim.globalTime * cloud.pulseSpeed);
+    
+    // Mouvement des particules individuelles
+    for (size_t i = 0; i < cloud.particlePositions.size(); ++i) {
+        cloud.particlePositions[i] += cloud.particleVelocities[i] * deltaTime;
         
-        // Mouvement des particules individuelles
-        for (size_t i = 0; i < cloud.particlePositions.size(); ++i) {
-            cloud.particlePositions[i] += cloud.particleVelocities[i] * deltaTime;
-            
-            // Garder les particules dans le rayon du nuage
-            if (glm::length(cloud.particlePositions[i]) > cloud.radius) {
-                cloud.particlePositions[i] = glm::normalize(cloud.particlePositions[i]) * cloud.radius;
-                cloud.particleVelocities[i] = glm::cross(cloud.particlePositions[i], glm::vec3(0.0f, 1.0f, 0.0f)) * 0.1f;
-            }
+        // Garder les particules dans le rayon du nuage
+        if (glm::length(cloud.particlePositions[i]) > cloud.radius) {
+            cloud.particlePositions[i] = glm::normalize(cloud.particlePositions[i]) * cloud.radius;
+            cloud.particleVelocities[i] = glm::cross(cloud.particlePositions[i], glm::vec3(0.0f, 1.0f, 0.0f)) * 0.1f;
         }
     }
 }
@@ -1031,23 +1290,28 @@ void LightScene::UpdateInteractions(float deltaTime) {
     
     if (attractionMode || repulsionMode) {
         float strength = attractionMode ? attractionStrength : -attractionStrength;
-        
-        for (auto& d : debris) {
-            glm::vec3 direction = attractionPoint - d.position;
+        auto attract = [&](const glm::vec3& position, glm::vec3& velocity, float factor) {
+            glm::vec3 direction = attractionPoint - position;
             float distance = glm::length(direction);
             if (distance > 0.1f) {
                 direction = glm::normalize(direction);
-                d.velocity += direction * strength * deltaTime / (distance * distance + 1.0f);
+                velocity += direction * strength * factor * deltaTime / (distance * distance + 1.0f);
             }
-        }
-        
-        // Effet sur les comètes aussi
-        for (auto& comet : comets) {
-            glm::vec3 direction = attractionPoint - comet.position;
-            float distance = glm::length(direction);
-            if (distance > 0.1f) {
-                direction = glm::normalize(direction);
-                comet.velocity += direction * strength * 0.5f * deltaTime / (distance * distance + 1.0f);
+        };
+        
+        // Seuls les objets proches du point sont visités (débris, et comètes à moitié). Au-delà du
+        // rayon, la force (strength / (d² + 1)) reste sous ATTRACTION_MIN_ACCELERATION : moins de
+        // 0,1 unité/s gagnée en 100 s, négligeable devant les vitesses des débris (jusqu'à 5 unités/s
+        // par axe) et des comètes
+        float radius = std::sqrt(std::max(attractionStrength / ATTRACTION_MIN_ACCELERATION - 1.0f, 0.0f));
+        interactionResults.clear();
+        interactionIndex.QueryRadius(attractionPoint, radius, interactionResults);
+        for (uint32_t id : interactionResults) {
+            size_t index = entityIndex(id);
+            if (entityCategory(id) == CULL_DEBRIS) {
+                attract(sim.debris.position[index], sim.debris.velocity[index], 1.0f);
+            } else if (entityCategory(id) == CULL_COMETS) {
+                attract(sim.comets[index].position, sim.comets[index].velocity, 0.5f);
             }
         }
     }
@@ -1055,203 +1319,393 @@ void LightScene::UpdateInteractions(float deltaTime) {
 
 // === MÉTHODES DE RENDU ===
 
-void LightScene::RenderStations(Camera& camera, int screenWidth, int screenHeight) {
+void LightScene::RenderStations(Camera& camera, int screenHeight) {
     if (!spaceshipModel) return; // Utilise le modèle de vaisseau pour les stations
     
     Shader* shader = ShaderManager::getInstance().GetCurrentLightingShader();
     if (!shader) return;
     
-    shader->use();
-    glm::mat4 view = camera.GetViewMatrix();
-    glm::mat4 projection = glm::perspective(glm::radians(camera.Zoom), 
-                                          (float)screenWidth / screenHeight, 0.1f, 1000.0f);
-    shader->setMat4("view", view);
-    shader->setMat4("projection", projection);
+    float lodPixelScale = Model::GetLodPixelScale(camera.Zoom, screenHeight);
+    float unitScale = 1.0f / spaceshipModel->GetBoundingRadius();
+    RenderQueue& renderQueue = RenderQueue::getInstance();
     
-    for (int i = 0; i < STATION_COUNT; ++i) {
-        const SpaceStation& station = stations[i];
+    for (size_t i : GetVisibleEntities(CULL_STATIONS, STATION_COUNT)) {
+        SpaceStation& station = frame.stations[i];
         
         glm::mat4 model = glm::translate(glm::mat4(1.0f), station.position);
         model = glm::rotate(model, station.currentRotation, station.rotationAxis);
-        model = glm::scale(model, glm::vec3(station.scale));
-        
-        shader->setMat4("model", model);
-        shader->setVec3("objectColor", station.color);
-        
-        spaceshipModel->Draw(*shader);
+        float scale = station.scale * unitScale;
+        model = glm::scale(model, glm::vec3(scale));
+        
+        DrawPacket packet;
+        packet.shader = shader;
+        packet.model = model;
+        packet.color = station.color;
+        packet.hasColor = true;
+        
+        station.lod = spaceshipModel->SelectLod(glm::distance(camera.Position, station.position),
+                                                scale, lodPixelScale, station.lod);
+        spaceshipModel->Submit(renderQueue, packet, station.lod);
     }
 }
 
-void LightScene::RenderComets(Camera& camera, int screenWidth, int screenHeight) {
+void LightScene::RenderComets() {
     if (!lightSphere) return;
     
     Shader* shader = ShaderManager::getInstance().GetSunShader();
     if (!shader) return;
     
-    shader->use();
-    glm::mat4 view = camera.GetViewMatrix();
-    glm::mat4 projection = glm::perspective(glm::radians(camera.Zoom), 
-                                          (float)screenWidth / screenHeight, 0.1f, 1000.0f);
-    shader->setMat4("view", view);
-    shader->setMat4("projection", projection);
+    float unitScale = 1.0f / lightRadius; // Tailles exprimées en rayon monde
     
-    for (const auto& comet : comets) {
-        // Rendre la tête de la comète
-        glm::mat4 model = glm::translate(glm::mat4(1.0f), comet.position);
-        model = glm::scale(model, glm::vec3(comet.size * comet.brightness));
+    BeginCulling();
+    DrawPacket packet;
+    packet.shader = shader;
+    for (size_t i = 0; i < frame.comets.size(); ++i) {
+        const Comet& comet = frame.comets[i];
         
-        shader->setMat4("model", model);
-        shader->setFloat("time", globalTime);
-        
-        lightSphere->Draw(*shader);
-        
-        // Rendre la traînée (points plus petits)
-        for (size_t i = 1; i < comet.trailPositions.size(); ++i) {
-            float trailIntensity = 1.0f - (float)i / comet.trailPositions.size();
-            model = glm::translate(glm::mat4(1.0f), comet.trailPositions[i]);
-            model = glm::scale(model, glm::vec3(comet.size * trailIntensity * 0.3f));
-            
-            shader->setMat4("model", model);
-            lightSphere->Draw(*shader);
-        }
+        // Rendre la tête de la comète
+        float headRadius = comet.size * comet.brightness;
+        packet.model = glm::translate(glm::mat4(1.0f), comet.position);
+        packet.model = glm::scale(packet.model, glm::vec3(headRadius * unitScale));
+        cullBatch.Add({comet.position, headRadius});
+        pendingPackets.push_back(packet);
+        
+        // La traînée suit la couleur de la comète, dessinée après la file
+        cometTrails.SetStyle(i, comet.color, comet.size * 0.3f);
     }
+    RunCulling(CULL_COMETS);
+    SubmitVisiblePackets(*lightSphere);
 }
 
-void LightScene::RenderDebris(Camera& camera, int screenWidth, int screenHeight) {
-    if (!asteroidModel) return;
-    
-    Shader* shader = ShaderManager::getInstance().GetCurrentLightingShader();
+void LightScene::RenderCometTrails() {
+    Shader* shader = ShaderManager::getInstance().GetTrailShader();
     if (!shader) return;
     
+    // Mélange additif sans écriture de profondeur : les rubans restent cachés par l'opaque
+    glEnable(GL_BLEND);
+    glBlendFunc(GL_SRC_ALPHA, GL_ONE);
+    glDepthMask(GL_FALSE);
+    
+    // Vue et projection proviennent du CameraUBO
     shader->use();
-    glm::mat4 view = camera.GetViewMatrix();
-    glm::mat4 projection = glm::perspective(glm::radians(camera.Zoom), 
-                                          (float)screenWidth / screenHeight, 0.1f, 1000.0f);
-    shader->setMat4("view", view);
-    shader->setMat4("projection", projection);
+    shader->setInt("samples", 0);
+    cometTrails.Draw();
     
-    for (const auto& d : debris) {
-        glm::mat4 model = glm::translate(glm::mat4(1.0f), d.position);
-        model = glm::rotate(model, d.rotation.x, glm::vec3(1.0f, 0.0f, 0.0f));
-        model = glm::rotate(model, d.rotation.y, glm::vec3(0.0f, 1.0f, 0.0f));
-        model = glm::rotate(model, d.rotation.z, glm::vec3(0.0f, 0.0f, 1.0f));
-        model = glm::scale(model, glm::vec3(d.scale));
-        
-        shader->setMat4("model", model);
+    glDepthMask(GL_TRUE);
+    glDisable(GL_BLEND);
+}
+
+void LightScene::RenderDebris(Camera& camera, int screenHeight) {
+    if (!asteroidModel) return;
+    
+    Shader* shader = ShaderManager::getInstance().GetCurrentInstancedLightingShader();
+    if (!shader) return;
+    
+    float lodPixelScale = Model::GetLodPixelScale(camera.Zoom, screenHeight);
+    float unitScale = 1.0f / asteroidModel->GetBoundingRadius();
+    
+    // Sur GPU tous les débris sont envoyés ; sinon seuls les visibles d'après l'index spatial
+    bool onGpu = IsGpuCullingActive();
+    size_t count = onGpu ? frame.debris.size() : visibleEntities[CULL_DEBRIS].size();
+    const std::vector<size_t>* visible = onGpu ? nullptr : &GetVisibleEntities(CULL_DEBRIS, frame.debris.size());
+    instanceData.resize(count);
+    instanceLods.resize(count);
+    for (size_t i = 0; i < count; ++i) {
+        size_t index = visible ? (*visible)[i] : i;
+        float scale = frame.debris.scale[index] * unitScale;
+        
+        glm::mat4 model = glm::translate(glm::mat4(1.0f), frame.debris.position[index]);
+        model = glm::rotate(model, frame.debris.rotation[index].x, glm::vec3(1.0f, 0.0f, 0.0f));
+        model = glm::rotate(model, frame.debris.rotation[index].y, glm::vec3(0.0f, 1.0f, 0.0f));
+        model = glm::rotate(model, frame.debris.rotation[index].z, glm::vec3(0.0f, 0.0f, 1.0f));
+        model = glm::scale(model, glm::vec3(scale));
         
         // Couleur qui s'estompe avec la durée de vie
-        float lifeFactor = d.lifetime / d.maxLifetime;
-        glm::vec3 fadedColor = d.color * lifeFactor;
-        shader->setVec3("objectColor", fadedColor);
-        
-        asteroidModel->Draw(*shader);
+        float lifeFactor = frame.debris.lifetime[index] / frame.debris.maxLifetime[index];
+        glm::vec3 fadedColor = frame.debris.color[index] * lifeFactor;
+        
+        instanceData[i].model = model;
+        instanceData[i].color = glm::vec4(fadedColor, 1.0f);
+        if (!onGpu) {
+            frame.debris.lod[index] = asteroidModel->SelectLod(glm::distance(camera.Position, frame.debris.position[index]), scale,
+                                                         lodPixelScale, frame.debris.lod[index]);
+            instanceLods[i] = frame.debris.lod[index];
+        }
+    }
+    
+    if (onGpu) {
+        DrawInstancesOnGpu(debrisCuller, *asteroidModel, *shader, CULL_DEBRIS, camera, lodPixelScale);
+        return;
+    }
+    shader->use();
+    DrawInstancesByLod(*asteroidModel, *shader, debrisInstances);
+}
+
+void LightScene::DrawInstancesByLod(const Model& model, const Shader& shader, InstanceBuffer& buffer) {
+    // Tri par dénombrement : les instances d'un même LOD deviennent contiguës
+    size_t lodCount = model.GetLodCount();
+    std::vector<size_t> offsets(lodCount + 1, 0);
+    for (size_t& lod : instanceLods) {
+        lod = std::min(lod, lodCount - 1);
+        offsets[lod + 1]++;
+    }
+    for (size_t lod = 0; lod < lodCount; ++lod) {
+        offsets[lod + 1] += offsets[lod];
+    }
+    
+    sortedInstances.resize(instanceData.size());
+    std::vector<size_t> cursors(offsets.begin(), offsets.end() - 1);
+    for (size_t i = 0; i < instanceData.size(); ++i) {
+        sortedInstances[cursors[instanceLods[i]]++] = instanceData[i];
+    }
+    buffer.Update(sortedInstances.data(), sortedInstances.size());
+    
+    // Tous les LOD en un tirage groupé
+    model.DrawInstancedByLod(shader, buffer, offsets);
+}
+
+bool LightScene::IsGpuCullingActive() const {
+    return gpuCulling && ShaderManager::getInstance().GetCullInstancesShader() != nullptr;
+}
+
+void LightScene::DrawInstancesOnGpu(GpuCuller& culler, const Model& model, const Shader& shader,
+                                    CullCategory category, const Camera& camera, float lodPixelScale) {
+    const Shader* program = ShaderManager::getInstance().GetCullInstancesShader();
+    culler.Cull(*program, model, instanceData.data(), instanceData.size(), frustum, camera.Position, lodPixelScale);
+    
+    shader.use();
+    culler.Draw(model, shader);
+    
+    // Compte visible relu avec au moins une frame de retard
+    cullCounts[category].visible = culler.GetVisibleCount();
+    cullCounts[category].total = instanceData.size();
+}
+
+void LightScene::BeginCulling() {
+    cullBatch.Clear();
+    pendingPackets.clear();
+    pendingLods.clear();
+}
+
+void LightScene::RunCulling(CullCategory category) {
+    cullCounts[category].visible += cullBatch.Run(frustum);
+    cullCounts[category].total += cullBatch.GetCount();
+}
+
+void LightScene::SubmitVisiblePackets(const Model& model) {
+    RenderQueue& renderQueue = RenderQueue::getInstance();
+    for (size_t i = 0; i < pendingPackets.size(); ++i) {
+        if (cullBatch.IsVisible(i)) {
+            model.Submit(renderQueue, pendingPackets[i], pendingLods[i]);
+        }
+    }
+}
+
+void LightScene::SubmitVisiblePackets(const Sphere& sphere) {
+    RenderQueue& renderQueue = RenderQueue::getInstance();
+    for (size_t i = 0; i < pendingPackets.size(); ++i) {
+        if (cullBatch.IsVisible(i)) {
+            sphere.Submit(renderQueue, pendingPackets[i]);
+        }
+    }
+}
+
+void LightScene::KeepVisibleInstances() {
+    // Compactage en place, l'ordre des instances visibles est conservé
+    size_t visibleCount = 0;
+    for (size_t i = 0; i < instanceData.size(); ++i) {
+        if (cullBatch.IsVisible(i)) {
+            instanceData[visibleCount] = instanceData[i];
+            instanceLods[visibleCount] = instanceLods[i];
+            visibleCount++;
+        }
     }
+    instanceData.resize(visibleCount);
+    instanceLods.resize(visibleCount);
+}
+
+bool LightScene::IsBodyVisible(const BoundingSphere& sphere) {
+    bool visible = frustum.Intersects(sphere);
+    cullCounts[CULL_BODIES].visible += visible ? 1 : 0;
+    cullCounts[CULL_BODIES].total++;
+    return visible;
 }
 
-void LightScene::RenderPortals(Camera& camera, int screenWidth, int screenHeight) {
+void LightScene::RenderPortals() {
     if (!lightSphere) return;
     
     Shader* shader = ShaderManager::getInstance().GetSunShader();
     if (!shader) return;
     
-    shader->use();
-    glm::mat4 view = camera.GetViewMatrix();
-    glm::mat4 projection = glm::perspective(glm::radians(camera.Zoom), 
-                                          (float)screenWidth / screenHeight, 0.1f, 1000.0f);
-    shader->setMat4("view", view);
-    shader->setMat4("projection", projection);
+    float unitScale = 1.0f / lightRadius; // Tailles exprimées en rayon monde
     
+    BeginCulling();
+    DrawPacket packet;
+    packet.shader = shader;
     for (int i = 0; i < PORTAL_COUNT; ++i) {
-        const EnergyPortal& portal = portals[i];
+        const EnergyPortal& portal = frame.portals[i];
         
         // Anneau extérieur
-        glm::mat4 model = glm::translate(glm::mat4(1.0f), portal.position);
-        model = glm::rotate(model, portal.currentRotation, glm::vec3(0.0f, 1.0f, 0.0f));
-        model = glm::scale(model, glm::vec3(portal.size * (1.0f + portal.pulseIntensity * 0.3f)));
-        
-        shader->setMat4("model", model);
-        shader->setFloat("time", globalTime);
-        
-        lightSphere->Draw(*shader);
-        
-        // Anneau intérieur (couleur différente)
-        model = glm::translate(glm::mat4(1.0f), portal.position);
-        model = glm::rotate(model, -portal.currentRotation * 1.5f, glm::vec3(0.0f, 1.0f, 0.0f));
-        model = glm::scale(model, glm::vec3(portal.size * 0.6f * (1.0f + portal.pulseIntensity * 0.5f)));
-        
-        shader->setMat4("model", model);
-        lightSphere->Draw(*shader);
+        float outerRadius = portal.size * (1.0f + portal.pulseIntensity * 0.3f);
+        packet.model = glm::translate(glm::mat4(1.0f), portal.position);
+        packet.model = glm::rotate(packet.model, portal.currentRotation, glm::vec3(0.0f, 1.0f, 0.0f));
+        packet.model = glm::scale(packet.model, glm::vec3(outerRadius * unitScale));
+        cullBatch.Add({portal.position, outerRadius});
+        pendingPackets.push_back(packet);
+        
+        // Anneau intérieur
+        float innerRadius = portal.size * 0.6f * (1.0f + portal.pulseIntensity * 0.5f);
+        packet.model = glm::translate(glm::mat4(1.0f), portal.position);
+        packet.model = glm::rotate(packet.model, -portal.currentRotation * 1.5f, glm::vec3(0.0f, 1.0f, 0.0f));
+        packet.model = glm::scale(packet.model, glm::vec3(innerRadius * unitScale));
+        cullBatch.Add({portal.position, innerRadius});
+        pendingPackets.push_back(packet);
     }
+    RunCulling(CULL_PORTALS);
+    SubmitVisiblePackets(*lightSphere);
 }
 
-void LightScene::RenderSatellites(Camera& camera, int screenWidth, int screenHeight) {
+void LightScene::RenderSatellites(Camera& camera, int screenHeight) {
     if (!spaceshipModel) return;
     
     Shader* shader = ShaderManager::getInstance().GetCurrentLightingShader();
     if (!shader) return;
     
-    shader->use();
-    glm::mat4 view = camera.GetViewMatrix();
-    glm::mat4 projection = glm::perspective(glm::radians(camera.Zoom), 
-                                          (float)screenWidth / screenHeight, 0.1f, 1000.0f);
-    shader->setMat4("view", view);
-    shader->setMat4("projection", projection);
+    float lodPixelScale = Model::GetLodPixelScale(camera.Zoom, screenHeight);
+    float scale = SATELLITE_RADIUS / spaceshipModel->GetBoundingRadius();
+    RenderQueue& renderQueue = RenderQueue::getInstance();
     
-    for (int i = 0; i < SATELLITE_COUNT; ++i) {
-        const Satellite& sat = satellites[i];
-        
-        // Position orbitale
-        glm::vec3 pos = sat.basePosition + glm::vec3(
-            sat.orbitRadius * cos(sat.currentAngle),
-            0.0f,
-            sat.orbitRadius * sin(sat.currentAngle)
-        );
-        
-        glm::mat4 model = glm::translate(glm::mat4(1.0f), pos);
+    auto satelliteTransform = [&](const Satellite& sat, glm::mat4& model, glm::vec3& color) {
+        model = glm::translate(glm::mat4(1.0f), GetSatellitePosition(sat));
         model = glm::rotate(model, sat.antennaRotation.y, glm::vec3(0.0f, 1.0f, 0.0f));
-        model = glm::scale(model, glm::vec3(1.5f));
-        
-        shader->setMat4("model", model);
+        model = glm::scale(model, glm::vec3(scale));
         
         // Couleur avec pulsation si actif
-        glm::vec3 color = sat.color;
+        color = sat.color;
         if (sat.isActive) {
             float pulse = 1.0f + 0.3f * sin(sat.signalPulse);
             color *= pulse;
         }
-        shader->setVec3("objectColor", color);
+    };
+    
+    // Sur GPU, tous les satellites en un tirage instancié
+    Shader* instancedShader = ShaderManager::getInstance().GetCurrentInstancedLightingShader();
+    if (instancedShader && IsGpuCullingActive()) {
+        instanceData.resize(SATELLITE_COUNT);
+        for (int i = 0; i < SATELLITE_COUNT; ++i) {
+            glm::vec3 color;
+            satelliteTransform(frame.satellites[i], instanceData[i].model, color);
+            instanceData[i].color = glm::vec4(color, 1.0f);
+        }
+        DrawInstancesOnGpu(satelliteCuller, *spaceshipModel, *instancedShader, CULL_SATELLITES, camera, lodPixelScale);
+        return;
+    }
+    
+    for (size_t i : GetVisibleEntities(CULL_SATELLITES, SATELLITE_COUNT)) {
+        Satellite& sat = frame.satellites[i];
+        glm::vec3 pos = GetSatellitePosition(sat);
+        
+        glm::mat4 model;
+        glm::vec3 color;
+        satelliteTransform(sat, model, color);
         
-        spaceshipModel->Draw(*shader);
+        DrawPacket packet;
+        packet.shader = shader;
+        packet.model = model;
+        packet.color = color;
+        packet.hasColor = true;
+        
+        sat.lod = spaceshipModel->SelectLod(glm::distance(camera.Position, pos), scale, lodPixelScale, sat.lod);
+        spaceshipModel->Submit(renderQueue, packet, sat.lod);
     }
 }
 
-void LightScene::RenderParticleClouds(Camera& camera, int screenWidth, int screenHeight) {
-    if (!lightSphere) return;
+glm::vec3 LightScene::GetSatellitePosition(const Satellite& sat) const {
+    // Position orbitale
+    return sat.basePosition + glm::vec3(
+        sat.orbitRadius * cos(sat.currentAngle),
+        0.0f,
+        sat.orbitRadius * sin(sat.currentAngle)
+    );
+}
+
+void LightScene::RebuildSpatialIndex(const SimulationState& state, LooseOctree& index) {
+    index.Clear();
     
-    Shader* shader = ShaderManager::getInstance().GetSunShader();
+    // Sphères centrées sur l'origine des objets : leurs échelles sont des rayons monde
+    const DebrisField& debris = state.debris;
+    for (size_t i = 0; i < debris.size(); ++i) {
+        index.Insert(makeEntityId(CULL_DEBRIS, i), {debris.position[i], debris.scale[i]});
+    }
+    for (int i = 0; i < SATELLITE_COUNT; ++i) {
+        index.Insert(makeEntityId(CULL_SATELLITES, i), {GetSatellitePosition(state.satellites[i]), SATELLITE_RADIUS});
+    }
+    for (int i = 0; i < STATION_COUNT; ++i) {
+        index.Insert(makeEntityId(CULL_STATIONS, i), {state.stations[i].position, state.stations[i].scale});
+    }
+    for (size_t i = 0; i < state.comets.size(); ++i) {
+        const Comet& comet = state.comets[i];
+        index.Insert(makeEntityId(CULL_COMETS, i), {comet.position, comet.size * comet.brightness});
+    }
+}
+
+void LightScene::QuerySpatialIndex(const Camera& camera) {
+    for (std::vector<size_t>& entities : visibleEntities) {
+        entities.clear();
+    }
+    queryResults.clear();
+    spatialIndex.QueryFrustum(frustum, queryResults);
+    for (uint32_t id : queryResults) {
+        visibleEntities[entityCategory(id)].push_back(entityIndex(id));
+    }
+    // Ordre de la scène plutôt que celui des nœuds
+    for (std::vector<size_t>& entities : visibleEntities) {
+        std::sort(entities.begin(), entities.end());
+    }
+    
+    // Objet visé : rayon partant du centre de l'écran, jusqu'au plan lointain
+    hasPickedEntity = spatialIndex.Raycast(camera.Position, glm::normalize(camera.Front), 1000.0f,
+                                           pickedEntity, pickedDistance);
+}
+
+const std::vector<size_t>& LightScene::GetVisibleEntities(CullCategory category, size_t total) {
+    cullCounts[category].visible = visibleEntities[category].size();
+    cullCounts[category].total = total;
+    return visibleEntities[category];
+}
+
+void LightScene::RenderParticleClouds() {
+    Shader* shader = ShaderManager::getInstance().GetParticleShader();
     if (!shader) return;
     
-    shader->use();
-    glm::mat4 view = camera.GetViewMatrix();
-    glm::mat4 projection = glm::perspective(glm::radians(camera.Zoom), 
-                                          (float)screenWidth / screenHeight, 0.1f, 1000.0f);
-    shader->setMat4("view", view);
-    shader->setMat4("projection", projection);
-    shader->setFloat("time", globalTime);
-    
-    for (const auto& cloud : particleClouds) {
+    // Positions monde de toutes les particules, envoyées en un seul buffer
+    BeginCulling();
+    particleData.clear();
+    for (const auto& cloud : frame.particleClouds) {
         // Matrice de rotation du nuage
         glm::mat4 cloudRotation = glm::rotate(glm::mat4(1.0f), cloud.currentRotation, glm::vec3(0.0f, 1.0f, 0.0f));
+        float particleRadius = lightRadius * 0.5f * cloud.intensity;
         
-        // Rendre chaque particule
         for (const auto& particlePos : cloud.particlePositions) {
             glm::vec3 worldPos = cloud.center + glm::vec3(cloudRotation * glm::vec4(particlePos, 1.0f));
-            
-            glm::mat4 model = glm::translate(glm::mat4(1.0f), worldPos);
-            model = glm::scale(model, glm::vec3(0.5f * cloud.intensity));
-            
-            shader->setMat4("model", model);
-            lightSphere->Draw(*shader);
+            particleData.push_back(glm::vec4(worldPos, particleRadius));
+            cullBatch.Add({worldPos, particleRadius});
         }
     }
+    RunCulling(CULL_PARTICLES);
+    
+    // Seules les particules visibles sont envoyées
+    size_t visibleCount = 0;
+    for (size_t i = 0; i < particleData.size(); ++i) {
+        if (cullBatch.IsVisible(i)) {
+            particleData[visibleCount++] = particleData[i];
+        }
+    }
+    particleData.resize(visibleCount);
+    particleRenderer.Update(particleData.data(), particleData.size());
+    
+    // Vue et projection proviennent du CameraUBO
+    shader->use();
+    shader->setFloat("time", frame.globalTime);
+    particleRenderer.Draw();
 }
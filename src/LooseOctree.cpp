@@ -0,0 +1,194 @@
+#include "LooseOctree.h"
+
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+
+namespace {
+    // Bornes lâches : le cube du nœud agrandi deux fois
+    const float LOOSENESS = 2.0f;
+}
+
+LooseOctree::LooseOctree(const glm::vec3& center, float halfSize, int maxDepth)
+    : rootCenter(center), rootHalfSize(halfSize), maxDepth(maxDepth) {
+    Clear();
+}
+
+void LooseOctree::Clear() {
+    nodes.clear();
+    items.clear();
+    CreateNode(rootCenter, rootHalfSize);
+}
+
+int32_t LooseOctree::CreateNode(const glm::vec3& center, float halfSize) {
+    Node node;
+    node.center = center;
+    node.halfSize = halfSize;
+    std::fill(std::begin(node.children), std::end(node.children), -1);
+    node.firstItem = -1;
+    nodes.push_back(node);
+    return static_cast<int32_t>(nodes.size() - 1);
+}
+
+bool LooseOctree::IsInsideRoot(const glm::vec3& point) const {
+    glm::vec3 offset = glm::abs(point - rootCenter);
+    return offset.x <= rootHalfSize && offset.y <= rootHalfSize && offset.z <= rootHalfSize;
+}
+
+void LooseOctree::Insert(uint32_t id, const BoundingSphere& sphere) {
+    int32_t current = 0;
+
+    // Descente tant que l'objet tient dans les bornes lâches de l'enfant
+    if (IsInsideRoot(sphere.center)) {
+        for (int depth = 0; depth < maxDepth; ++depth) {
+            float childHalfSize = nodes[current].halfSize * 0.5f;
+            if (sphere.radius > childHalfSize) {
+                break;
+            }
+
+            glm::vec3 nodeCenter = nodes[current].center;
+            int octant = (sphere.center.x >= nodeCenter.x ? 1 : 0) |
+                         (sphere.center.y >= nodeCenter.y ? 2 : 0) |
+                         (sphere.center.z >= nodeCenter.z ? 4 : 0);
+            if (nodes[current].children[octant] < 0) {
+                glm::vec3 childCenter = nodeCenter + glm::vec3((octant & 1) ? childHalfSize : -childHalfSize,
+                                                               (octant & 2) ? childHalfSize : -childHalfSize,
+                                                               (octant & 4) ? childHalfSize : -childHalfSize);
+                // CreateNode peut réallouer nodes : l'index est relu après coup
+                int32_t child = CreateNode(childCenter, childHalfSize);
+                nodes[current].children[octant] = child;
+            }
+            current = nodes[current].children[octant];
+        }
+    }
+
+    Item item;
+    item.sphere = sphere;
+    item.id = id;
+    item.next = nodes[current].firstItem;
+    items.push_back(item);
+    nodes[current].firstItem = static_cast<int32_t>(items.size() - 1);
+}
+
+void LooseOctree::QueryFrustum(const Frustum& frustum, std::vector<uint32_t>& results) const {
+    QueryFrustumNode(0, frustum, false, results);
+}
+
+void LooseOctree::QueryFrustumNode(int32_t index, const Frustum& frustum, bool fullyInside,
+                                   std::vector<uint32_t>& results) const {
+    const Node& node = nodes[index];
+
+    // La racine garde les objets hors du cube : ses bornes sont considérées infinies
+    if (!fullyInside && index != 0) {
+        float looseHalfSize = node.halfSize * LOOSENESS;
+        fullyInside = true;
+        for (const glm::vec4& plane : frustum.planes) {
+            float distance = glm::dot(glm::vec3(plane), node.center) + plane.w;
+            float extent = looseHalfSize * (std::abs(plane.x) + std::abs(plane.y) + std::abs(plane.z));
+            if (distance < -extent) {
+                return;
+            }
+            if (distance < extent) {
+                fullyInside = false;
+            }
+        }
+    }
+
+    for (int32_t i = node.firstItem; i >= 0; i = items[i].next) {
+        if (fullyInside || frustum.Intersects(items[i].sphere)) {
+            results.push_back(items[i].id);
+        }
+    }
+    for (int32_t child : node.children) {
+        if (child >= 0) {
+            QueryFrustumNode(child, frustum, fullyInside, results);
+        }
+    }
+}
+
+void LooseOctree::QueryRadius(const glm::vec3& center, float radius, std::vector<uint32_t>& results) const {
+    QueryRadiusNode(0, center, radius, results);
+}
+
+void LooseOctree::QueryRadiusNode(int32_t index, const glm::vec3& center, float radius,
+                                  std::vector<uint32_t>& results) const {
+    const Node& node = nodes[index];
+
+    if (index != 0) {
+        // Distance du centre de la requête à la boîte lâche
+        float looseHalfSize = node.halfSize * LOOSENESS;
+        glm::vec3 outside = glm::max(glm::abs(center - node.center) - looseHalfSize, glm::vec3(0.0f));
+        if (glm::dot(outside, outside) > radius * radius) {
+            return;
+        }
+    }
+
+    for (int32_t i = node.firstItem; i >= 0; i = items[i].next) {
+        const BoundingSphere& sphere = items[i].sphere;
+        float reach = radius + sphere.radius;
+        glm::vec3 offset = sphere.center - center;
+        if (glm::dot(offset, offset) <= reach * reach) {
+            results.push_back(items[i].id);
+        }
+    }
+    for (int32_t child : node.children) {
+        if (child >= 0) {
+            QueryRadiusNode(child, center, radius, results);
+        }
+    }
+}
+
+bool LooseOctree::Raycast(const glm::vec3& origin, const glm::vec3& direction, float maxDistance,
+                          uint32_t& hitId, float& hitDistance) const {
+    glm::vec3 inverseDirection = 1.0f / direction;
+    float bestDistance = maxDistance;
+    bool hit = false;
+    RaycastNode(0, origin, inverseDirection, direction, bestDistance, hitId, hit);
+    if (hit) {
+        hitDistance = bestDistance;
+    }
+    return hit;
+}
+
+void LooseOctree::RaycastNode(int32_t index, const glm::vec3& origin, const glm::vec3& inverseDirection,
+                              const glm::vec3& direction, float& bestDistance, uint32_t& hitId, bool& hit) const {
+    const Node& node = nodes[index];
+
+    if (index != 0) {
+        // Test des dalles contre la boîte lâche, ignorée si elle commence après le meilleur impact
+        float looseHalfSize = node.halfSize * LOOSENESS;
+        glm::vec3 t0 = (node.center - looseHalfSize - origin) * inverseDirection;
+        glm::vec3 t1 = (node.center + looseHalfSize - origin) * inverseDirection;
+        glm::vec3 tNear = glm::min(t0, t1);
+        glm::vec3 tFar = glm::max(t0, t1);
+        float enter = std::max(std::max(tNear.x, tNear.y), std::max(tNear.z, 0.0f));
+        float exit = std::min(std::min(tFar.x, tFar.y), tFar.z);
+        if (enter > exit || enter > bestDistance) {
+            return;
+        }
+    }
+
+    for (int32_t i = node.firstItem; i >= 0; i = items[i].next) {
+        const BoundingSphere& sphere = items[i].sphere;
+        glm::vec3 offset = origin - sphere.center;
+        float b = glm::dot(offset, direction);
+        float c = glm::dot(offset, offset) - sphere.radius * sphere.radius;
+        float discriminant = b * b - c;
+        if (discriminant < 0.0f) {
+            continue;
+        }
+
+        // Origine dans la sphère : impact immédiat
+        float distance = c <= 0.0f ? 0.0f : -b - std::sqrt(discriminant);
+        if (distance >= 0.0f && distance < bestDistance) {
+            bestDistance = distance;
+            hitId = items[i].id;
+            hit = true;
+        }
+    }
+    for (int32_t child : node.children) {
+        if (child >= 0) {
+            RaycastNode(child, origin, inverseDirection, direction, bestDistance, hitId, hit);
+        }
+    }
+}
@@ -2,7 +2,9 @@
 #include "Skybox.h"
 #include "UIHelpers.h"
 #include "ShaderManager.h"
+#include "RenderQueue.h"
 #include "UBO.h"
+#include "Random.h"
 #include "imgui.h"
 #include <iostream>
 #include <cstdlib>
@@ -54,7 +56,7 @@ bool MainScene::Initialize(Camera& camera, SoundManager& soundManager) {
     }    // Charger la skybox spatiale pour MainScene (vue d'ensemble de l'espace)
     currentSkyboxType = SkyboxManager::SkyboxType::SPACE;
     std::vector<std::string> skyboxFaces = SkyboxManager::GetSkyboxFaces(currentSkyboxType);
-    skybox = std::make_unique<Skybox>(skyboxFaces);
+    skybox = std::make_unique<Skybox>(skyboxFaces, true);
     std::cout << "Skybox chargée pour MainScene: " << SkyboxManager::GetSkyboxName(currentSkyboxType) << std::endl;
 
     // Positionner la caméra pour une vue d'ensemble
@@ -75,10 +77,10 @@ bool MainScene::LoadShaders() {
 bool MainScene::LoadModels() {
     try {
         // Charger un seul modèle d'astéroïde (réutilisé pour tout l'anneau)
-        asteroidModel = std::make_unique<Model>("../models/astroid.obj");
+        asteroidModel = std::make_unique<Model>("../models/astroid.obj", true, VertexFormat::PackedUnorm16);
         
         // Charger le modèle de vaisseau (réutilisé pour les 3 vaisseaux français)
-        spaceshipModel = std::make_unique<Model>("../models/map-bump.obj"); // Utilise le même modèle pour les vaisseaux
+        spaceshipModel = std::make_unique<Model>("../models/map-bump.obj", true); // Utilise le même modèle pour les vaisseaux
         
         // Initialiser l'anneau d'astéroïdes avec des propriétés variées
         InitializeAsteroidRing();
@@ -86,7 +88,7 @@ bool MainScene::LoadModels() {
         // Initialiser les vaisseaux français
         InitializeSpaceships();
         
-        moonSphere = std::make_unique<Sphere>("../textures/spherical_moon_texture.jpg", 9.0f, 36, 18); // Lune très imposante (x3)
+        moonSphere = std::make_unique<Sphere>("../textures/spherical_moon_texture.jpg", 9.0f, 36, 18, true); // Lune très imposante (x3)
         sunSphere = std::make_unique<Sphere>("", sunRadius, 36, 18);
         
         return true;
@@ -300,10 +302,12 @@ void MainScene::RenderObjects(Camera& camera, int screenWidth, int screenHeight)
     Shader* sunShader = ShaderManager::getInstance().GetSunShader();
     Shader* currentLightingShader = ShaderManager::getInstance().GetCurrentLightingShader();
 
-    //======== LUNE (orbite autour du soleil, plus éloignée que les astéroïdes) ========
-    if (texturedShader && g_uboManager) {
-        texturedShader->use();
+    // Lune, soleil et vaisseaux passent par la file de rendu, triée avant exécution
+    RenderQueue& renderQueue = RenderQueue::getInstance();
+    renderQueue.Begin(camera.Position);
 
+    //======== LUNE (orbite autour du soleil, plus éloignée que les astéroïdes) ========
+    if (texturedShader) {
         // Orbite de la lune autour du soleil (plus éloignée que les astéroïdes)
         float orbitAngle = currentFrame * luneOrbitSpeed;
         float moonX = luneOrbitRadius * cos(orbitAngle);
@@ -322,26 +326,29 @@ void MainScene::RenderObjects(Camera& camera, int screenWidth, int screenHeight)
         // Rotation propre de la lune (synchronisée avec son orbite comme la vraie Lune)
         moonModel = glm::rotate(moonModel, orbitAngle, glm::vec3(0.0f, 1.0f, 0.0f));
         
-        g_uboManager->UpdateTransformUBO(moonModel);
-        moonSphere->Draw(*texturedShader);
+        DrawPacket packet;
+        packet.shader = texturedShader;
+        packet.model = moonModel;
+        moonSphere->Submit(renderQueue, packet);
     }
 
     //======== SOLEIL (utilise son shader spécialisé) ========
-    if (sunShader && g_uboManager) {
+    if (sunShader) {
+        // Uniform constant sur la frame : défini une fois, avant l'exécution de la file
         sunShader->use();
         sunShader->setFloat("time", currentFrame);
 
-        glm::mat4 sunModel = glm::mat4(1.0f);
-        sunModel = glm::translate(sunModel, lightPosition);
-        g_uboManager->UpdateTransformUBO(sunModel);
-        
-        sunSphere->Draw(*sunShader);    }    //======== ANNEAU D'ASTÉROÏDES (utilisent le shader d'éclairage sélectionné) ========
-    if (currentLightingShader && g_uboManager && asteroidModel) {
-        currentLightingShader->use();
-        
+        DrawPacket packet;
+        packet.shader = sunShader;
+        packet.model = glm::translate(glm::mat4(1.0f), lightPosition);
+        sunSphere->Submit(renderQueue, packet);
+    }    //======== ANNEAU D'ASTÉROÏDES (variante instanciée du shader d'éclairage sélectionné) ========
+    Shader* instancedLightingShader = ShaderManager::getInstance().GetCurrentInstancedLightingShader();
+    if (instancedLightingShader && asteroidModel) {
         const float baseOrbitRadius = 60.0f;
         const float orbitHeight = 12.0f; // Hauteur de variation augmentée pour plus de relief
         
+        asteroidInstanceData.resize(ASTEROID_COUNT);
         for (int i = 0; i < ASTEROID_COUNT; ++i) {
             const AsteroidData& asteroid = asteroids[i];
             
@@ -370,7 +377,6 @@ void MainScene::RenderObjects(Camera& camera, int screenWidth, int screenHeight)
             glm::vec3 finalColor = asteroid.color;
             float distanceFactor = 1.0f + (asteroid.radiusOffset / 50.0f); // Variation subtile
             finalColor *= distanceFactor;
-            currentLightingShader->setVec3("objectColor", finalColor);
             
             // Transformation de l'astéroïde
             glm::mat4 asteroidModel = glm::mat4(1.0f);
@@ -394,8 +400,14 @@ void MainScene::RenderObjects(Camera& camera, int screenWidth, int screenHeight)
             glm::vec3 secondaryAxis = glm::normalize(glm::vec3(asteroid.rotationAxis.z, asteroid.rotationAxis.x, asteroid.rotationAxis.y));
             asteroidModel = glm::rotate(asteroidModel, secondaryRotation, secondaryAxis);
             
-            g_uboManager->UpdateTransformUBO(asteroidModel);
-            this->asteroidModel->Draw(*currentLightingShader);        }
+            asteroidInstanceData[i].model = asteroidModel;
+            asteroidInstanceData[i].color = glm::vec4(finalColor, 1.0f);
+        }
+
+        // Tout l'anneau en un tirage par sous-mesh
+        asteroidInstances.Update(asteroidInstanceData.data(), asteroidInstanceData.size());
+        instancedLightingShader->use();
+        this->asteroidModel->DrawInstanced(*instancedLightingShader, asteroidInstances, asteroidInstanceData.size());
           // Afficher des informations de debug occasionnelles
         static int frameCounter = 0;
         frameCounter++;
@@ -405,9 +417,7 @@ void MainScene::RenderObjects(Camera& camera, int screenWidth, int screenHeight)
     }
     
     //======== VAISSEAUX FRANÇAIS (utilisent le shader d'éclairage sélectionné) ========
-    if (currentLightingShader && g_uboManager && spaceshipModel) {
-        currentLightingShader->use();
-        
+    if (currentLightingShader && spaceshipModel) {
         for (int i = 0; i < SPACESHIP_COUNT; ++i) {
             const SpaceshipData& ship = spaceships[i];            // Position orbitale de base
             float x = ship.orbitRadius * cos(ship.currentAngle);
@@ -451,9 +461,6 @@ void MainScene::RenderObjects(Camera& camera, int screenWidth, int screenHeight)
             // Calculer l'angle de rotation pour orienter le nez dans la direction du mouvement
             float orientationAngle = atan2(movementDirection.x, movementDirection.z);
             
-            // Couleur du vaisseau selon le drapeau français
-            currentLightingShader->setVec3("objectColor", ship.color);
-            
             // Matrice de transformation du vaisseau
             glm::mat4 spaceshipModel_mat = glm::mat4(1.0f);
             spaceshipModel_mat = glm::translate(spaceshipModel_mat, finalPosition);
@@ -475,8 +482,13 @@ void MainScene::RenderObjects(Camera& camera, int screenWidth, int screenHeight)
             float rollAngle = sin(ship.randomPhase * 0.5f) * 0.08f;
             spaceshipModel_mat = glm::rotate(spaceshipModel_mat, rollAngle, glm::vec3(0.0f, 1.0f, 0.0f));
             
-            g_uboManager->UpdateTransformUBO(spaceshipModel_mat);
-            this->spaceshipModel->Draw(*currentLightingShader);
+            // Couleur du vaisseau selon le drapeau français
+            DrawPacket packet;
+            packet.shader = currentLightingShader;
+            packet.model = spaceshipModel_mat;
+            packet.color = ship.color;
+            packet.hasColor = true;
+            this->spaceshipModel->Submit(renderQueue, packet);
         }
         
         // Debug occasionnel pour les vaisseaux
@@ -486,6 +498,8 @@ void MainScene::RenderObjects(Camera& camera, int screenWidth, int screenHeight)
             std::cout << "Vaisseaux français en formation : Bleu, Blanc, Rouge" << std::endl;
         }
     }
+    
+    renderQueue.Execute();
 }
 
 void MainScene::Cleanup() {
@@ -506,7 +520,7 @@ void MainScene::ChangeSkybox(SkyboxManager::SkyboxType newType) {
     if (newType != currentSkyboxType) {
         currentSkyboxType = newType;
         std::vector<std::string> skyboxFaces = SkyboxManager::GetSkyboxFaces(currentSkyboxType);
-        skybox = std::make_unique<Skybox>(skyboxFaces);
+        skybox = std::make_unique<Skybox>(skyboxFaces, true);
         std::cout << "Skybox changée pour MainScene: " << SkyboxManager::GetSkyboxName(currentSkyboxType) << std::endl;
     }
 }
@@ -586,58 +600,58 @@ void MainScene::InitializeAsteroidRing() {
         glm::vec3(0.41f, 0.37f, 0.32f)  // Fer-nickel avec traces
     };
 
-    // Initialiser le générateur de nombres aléatoires
-    srand(static_cast<unsigned int>(42)); // Graine fixe pour des résultats reproductibles
+    // Flux propre à l'anneau : mêmes astéroïdes à chaque exécution pour une graine donnée
+    Random random = Random::ForStream("MainScene.asteroids");
 
     for (int i = 0; i < ASTEROID_COUNT; ++i) {
         AsteroidData& asteroid = asteroids[i];
         
         // Répartition plus dense avec quelques variations pour éviter la régularité
         float baseAngle = (2.0f * M_PI * i) / ASTEROID_COUNT;
-        float angleVariation = (rand() % 20 - 10) * 0.01f; // ±0.1 radian de variation
+        float angleVariation = (random.UniformInt(20) - 10) * 0.01f; // ±0.1 radian de variation
         asteroid.angleOffset = baseAngle + angleVariation;
         
         // Variation plus importante du rayon orbital pour créer des "groupes" d'astéroïdes
         if (i % 8 == 0) {
             // Quelques astéroïdes plus éloignés pour simuler des "familles" d'astéroïdes
-            asteroid.radiusOffset = 8.0f + (rand() % 8); // Entre +8 et +15
+            asteroid.radiusOffset = 8.0f + random.UniformInt(8); // Entre +8 et +15
         } else if (i % 12 == 0) {
             // Quelques astéroïdes plus proches
-            asteroid.radiusOffset = -8.0f - (rand() % 6); // Entre -8 et -13
+            asteroid.radiusOffset = -8.0f - random.UniformInt(6); // Entre -8 et -13
         } else {
             // Majorité dans la ceinture principale
-            asteroid.radiusOffset = -3.0f + (rand() % 7); // Entre -3 et +3
+            asteroid.radiusOffset = -3.0f + random.UniformInt(7); // Entre -3 et +3
         }
         
         // Échelles plus variées avec quelques "gros" astéroïdes occasionnels
         float baseScale;
         if (i % 15 == 0) {
             // Gros astéroïdes occasionnels
-            baseScale = 0.08f + (rand() % 4) * 0.02f; // Entre 0.08 et 0.14
+            baseScale = 0.08f + random.UniformInt(4) * 0.02f; // Entre 0.08 et 0.14
         } else if (i % 7 == 0) {
             // Astéroïdes moyens
-            baseScale = 0.04f + (rand() % 4) * 0.01f; // Entre 0.04 et 0.07
+            baseScale = 0.04f + random.UniformInt(4) * 0.01f; // Entre 0.04 et 0.07
         } else {
             // Petits astéroïdes (majoritaires)
-            baseScale = 0.015f + (rand() % 4) * 0.005f; // Entre 0.015 et 0.03
+            baseScale = 0.015f + random.UniformInt(4) * 0.005f; // Entre 0.015 et 0.03
         }
         asteroid.scale = baseScale;
         
         // Vitesses de rotation plus variées
-        asteroid.rotationSpeed = 1.0f + (rand() % 15) * 0.5f; // Entre 1.0 et 8.5
+        asteroid.rotationSpeed = 1.0f + random.UniformInt(15) * 0.5f; // Entre 1.0 et 8.5
         
         // Axes de rotation aléatoires mais plus naturels
         asteroid.rotationAxis = glm::normalize(glm::vec3(
-            (rand() % 200 - 100) / 100.0f,  // -1.0 à 1.0
-            (rand() % 200 - 100) / 100.0f,
-            (rand() % 200 - 100) / 100.0f
+            (random.UniformInt(200) - 100) / 100.0f,  // -1.0 à 1.0
+            (random.UniformInt(200) - 100) / 100.0f,
+            (random.UniformInt(200) - 100) / 100.0f
         ));
         
         // Couleur réaliste avec plus de variété
         asteroid.color = asteroidColors[i % asteroidColors.size()];
         
         // Vitesse orbitale variée avec légère tendance selon la distance
-        float baseOrbitSpeed = 0.4f + (rand() % 6) * 0.05f; // Entre 0.4 et 0.65
+        float baseOrbitSpeed = 0.4f + random.UniformInt(6) * 0.05f; // Entre 0.4 et 0.65
         // Les astéroïdes plus éloignés vont légèrement plus lentement (3ème loi de Kepler simplifiée)
         if (asteroid.radiusOffset > 5.0f) {
             baseOrbitSpeed *= 0.9f;
@@ -658,8 +672,8 @@ void MainScene::InitializeSpaceships() {
         glm::vec3(0.8f, 0.1f, 0.1f)     // Rouge France
     };
     
-    // Initialiser le générateur avec une graine différente
-    srand(static_cast<unsigned int>(123));
+    // Flux différent de celui de l'anneau
+    Random random = Random::ForStream("MainScene.spaceships");
     
     for (int i = 0; i < SPACESHIP_COUNT; ++i) {
         SpaceshipData& ship = spaceships[i];
@@ -679,42 +693,42 @@ void MainScene::InitializeSpaceships() {
         
         // Mouvement aléatoire horizontal léger pour plus de réalisme
         ship.randomOffset = glm::vec3(
-            ((rand() % 200) - 100) / 1000.0f,  // ±0.1 unités de décalage horizontal
+            (random.UniformInt(200) - 100) / 1000.0f,  // ±0.1 unités de décalage horizontal
             0.0f,                               // Pas d'offset vertical initial
-            ((rand() % 200) - 100) / 1000.0f   // ±0.1 unités de décalage horizontal
+            (random.UniformInt(200) - 100) / 1000.0f   // ±0.1 unités de décalage horizontal
         );
           // Phase aléatoire différente pour chaque vaisseau pour des variations de hauteur uniques
-        ship.randomPhase = (rand() % 628) / 100.0f + (i * 2.1f); // 0 à 2π + décalage par vaisseau
+        ship.randomPhase = random.UniformInt(628) / 100.0f + (i * 2.1f); // 0 à 2π + décalage par vaisseau
         
         // === PARAMÈTRES INDIVIDUELS POUR MOUVEMENTS VERTICAUX NATURELS ===
         // Chaque vaisseau a ses propres fréquences, amplitudes et phases pour un comportement unique
         
         // Oscillation principale (lente et ample)
-        ship.heightFreq1 = 0.8f + ((rand() % 100) / 100.0f) * 0.6f;    // 0.8 à 1.4
-        ship.heightAmp1 = 6.0f + ((rand() % 100) / 100.0f) * 8.0f;     // 6 à 14 unités
-        ship.heightPhase1 = ((rand() % 628) / 100.0f);                  // 0 à 2π
+        ship.heightFreq1 = 0.8f + (random.UniformInt(100) / 100.0f) * 0.6f;    // 0.8 à 1.4
+        ship.heightAmp1 = 6.0f + (random.UniformInt(100) / 100.0f) * 8.0f;     // 6 à 14 unités
+        ship.heightPhase1 = (random.UniformInt(628) / 100.0f);                  // 0 à 2π
         
         // Oscillation secondaire (moyenne)
-        ship.heightFreq2 = 1.2f + ((rand() % 100) / 100.0f) * 1.0f;    // 1.2 à 2.2
-        ship.heightAmp2 = 2.0f + ((rand() % 100) / 100.0f) * 4.0f;     // 2 à 6 unités
-        ship.heightPhase2 = ((rand() % 628) / 100.0f);                  // 0 à 2π
+        ship.heightFreq2 = 1.2f + (random.UniformInt(100) / 100.0f) * 1.0f;    // 1.2 à 2.2
+        ship.heightAmp2 = 2.0f + (random.UniformInt(100) / 100.0f) * 4.0f;     // 2 à 6 unités
+        ship.heightPhase2 = (random.UniformInt(628) / 100.0f);                  // 0 à 2π
         
         // Oscillation rapide (petite et vive)
-        ship.heightFreq3 = 2.5f + ((rand() % 100) / 100.0f) * 2.0f;    // 2.5 à 4.5
-        ship.heightAmp3 = 0.5f + ((rand() % 100) / 100.0f) * 2.0f;     // 0.5 à 2.5 unités
-        ship.heightPhase3 = ((rand() % 628) / 100.0f);                  // 0 à 2π
+        ship.heightFreq3 = 2.5f + (random.UniformInt(100) / 100.0f) * 2.0f;    // 2.5 à 4.5
+        ship.heightAmp3 = 0.5f + (random.UniformInt(100) / 100.0f) * 2.0f;     // 0.5 à 2.5 unités
+        ship.heightPhase3 = (random.UniformInt(628) / 100.0f);                  // 0 à 2π
         
         // === PARAMÈTRES INDIVIDUELS POUR MOUVEMENTS HORIZONTAUX NATURELS ===
         
         // Oscillation horizontale lente (déviation générale)
-        ship.horizontalFreq1 = 0.3f + ((rand() % 100) / 100.0f) * 0.4f; // 0.3 à 0.7
-        ship.horizontalAmp1 = 1.0f + ((rand() % 100) / 100.0f) * 2.0f;  // 1 à 3 unités
-        ship.horizontalPhase1 = ((rand() % 628) / 100.0f);               // 0 à 2π
+        ship.horizontalFreq1 = 0.3f + (random.UniformInt(100) / 100.0f) * 0.4f; // 0.3 à 0.7
+        ship.horizontalAmp1 = 1.0f + (random.UniformInt(100) / 100.0f) * 2.0f;  // 1 à 3 unités
+        ship.horizontalPhase1 = (random.UniformInt(628) / 100.0f);               // 0 à 2π
         
         // Oscillation horizontale rapide (vibrations)
-        ship.horizontalFreq2 = 1.5f + ((rand() % 100) / 100.0f) * 1.0f; // 1.5 à 2.5
-        ship.horizontalAmp2 = 0.2f + ((rand() % 100) / 100.0f) * 0.6f;  // 0.2 à 0.8 unités
-        ship.horizontalPhase2 = ((rand() % 628) / 100.0f);               // 0 à 2π
+        ship.horizontalFreq2 = 1.5f + (random.UniformInt(100) / 100.0f) * 1.0f; // 1.5 à 2.5
+        ship.horizontalAmp2 = 0.2f + (random.UniformInt(100) / 100.0f) * 0.6f;  // 0.2 à 0.8 unités
+        ship.horizontalPhase2 = (random.UniformInt(628) / 100.0f);               // 0 à 2π
     }
     
     std::cout << "Vaisseaux français initialisés : Bleu, Blanc, Rouge" << std::endl;
@@ -1,48 +1,180 @@
 #include "Mesh.h"
+#include "Hash.h"
 
-Mesh::Mesh(std::vector<Vertex> vertices, std::vector<unsigned int> indices, std::vector<Texture> textures)
+#include <glm/gtc/packing.hpp>
+#include <utility>
+
+void MeshData::ComputeBounds()
+{
+    boundsMin = glm::vec3(0.0f);
+    boundsMax = glm::vec3(0.0f);
+    if (!vertices.empty())
+    {
+        boundsMin = boundsMax = vertices[0].Position;
+        for (const Vertex &vertex : vertices)
+        {
+            boundsMin = glm::min(boundsMin, vertex.Position);
+            boundsMax = glm::max(boundsMax, vertex.Position);
+        }
+    }
+}
+
+namespace
 {
-    this->vertices = vertices;
-    this->indices = indices;
-    this->textures = textures;
+    MeshData makeMeshData(std::vector<Vertex> vertices, std::vector<unsigned int> indices, std::vector<Texture> textures,
+                          VertexFormat format)
+    {
+        MeshData data;
+        data.vertices = std::move(vertices);
+        data.indices = std::move(indices);
+        data.textures = std::move(textures);
+        data.format = format;
 
-    setupMesh();
+        // Boîte englobante locale
+        data.ComputeBounds();
+        return data;
+    }
+
+    // Conversion des sommets au format compressé (positions déjà ramenées par scale/offset)
+    std::vector<PackedVertex> packVertices(const Vertex *vertexData, size_t vertexCount, VertexFormat format,
+                                           const glm::vec3 &scale, const glm::vec3 &offset)
+    {
+        std::vector<PackedVertex> packed(vertexCount);
+        for (size_t i = 0; i < vertexCount; i++)
+        {
+            const Vertex &vertex = vertexData[i];
+            PackedVertex &out = packed[i];
+            for (int c = 0; c < 3; c++)
+            {
+                float value = vertex.Position[c] - offset[c];
+                if (format == VertexFormat::PackedUnorm16)
+                    out.Position[c] = glm::packUnorm1x16(scale[c] > 0.0f ? value / scale[c] : 0.0f);
+                else
+                    out.Position[c] = glm::packHalf1x16(value);
+            }
+            out.Position[3] = 0;
+            out.Normal = glm::packSnorm3x10_1x2(glm::vec4(vertex.Normal, 0.0f));
+            out.TexCoords[0] = glm::packHalf1x16(vertex.TexCoords.x);
+            out.TexCoords[1] = glm::packHalf1x16(vertex.TexCoords.y);
+        }
+        return packed;
+    }
 }
 
-void Mesh::setupMesh()
+Mesh::Mesh(std::vector<Vertex> vertices, std::vector<unsigned int> indices, std::vector<Texture> textures,
+           VertexFormat format)
+    : Mesh(makeMeshData(std::move(vertices), std::move(indices), std::move(textures), format))
 {
-    // Créer les buffers
-    glGenVertexArrays(1, &VAO);
-    glGenBuffers(1, &VBO);
-    glGenBuffers(1, &EBO);
+}
+
+Mesh::Mesh(MeshData data, const AABB *quantization)
+    : vertices(std::move(data.vertices)), indices(std::move(data.indices)), textures(std::move(data.textures)),
+      format(data.format), boundsMin(data.boundsMin), boundsMax(data.boundsMax),
+      lodLevel(data.lodLevel), lodError(data.lodError)
+{
+    setupMesh(this->vertices.data(), this->vertices.size(), this->indices.data(), this->indices.size(), quantization);
+}
 
-    // Lier VAO
+Mesh::Mesh(const Vertex *vertexData, size_t vertexCount, const unsigned int *indexData, size_t indexCount,
+           const glm::vec3 &boundsMin, const glm::vec3 &boundsMax, std::vector<Texture> textures,
+           VertexFormat format, const AABB *quantization)
+    : textures(std::move(textures)), format(format), boundsMin(boundsMin), boundsMax(boundsMax)
+{
+    setupMesh(vertexData, vertexCount, indexData, indexCount, quantization);
+}
+
+void Mesh::setupMesh(const Vertex *vertexData, size_t vertexCount, const unsigned int *indexData, size_t indexCount,
+                     const AABB *quantization)
+{
+    this->indexCount = static_cast<unsigned int>(indexCount);
+
+    // Déquantification des positions relative à la boîte de quantification
+    glm::vec3 quantizeMin = quantization ? quantization->min : boundsMin;
+    glm::vec3 quantizeMax = quantization ? quantization->max : boundsMax;
+    if (format == VertexFormat::PackedUnorm16)
+    {
+        positionScale = quantizeMax - quantizeMin;
+        positionOffset = quantizeMin;
+    }
+    else if (format == VertexFormat::PackedHalf)
+    {
+        // Centrer les positions conserve la précision des demi-flottants
+        positionScale = glm::vec3(1.0f);
+        positionOffset = (quantizeMin + quantizeMax) * 0.5f;
+    }
+
+    // Plage dans les buffers partagés
+    GeometryBuffer &geometryBuffer = GeometryBuffer::getInstance();
+    if (format == VertexFormat::Float)
+    {
+        geometry = geometryBuffer.Allocate(vertexData, vertexCount, sizeof(Vertex), indexData, indexCount);
+    }
+    else
+    {
+        std::vector<PackedVertex> packed = packVertices(vertexData, vertexCount, format, positionScale, positionOffset);
+        geometry = geometryBuffer.Allocate(packed.data(), packed.size(), sizeof(PackedVertex), indexData, indexCount);
+    }
+    VAO = geometryBuffer.GetVertexArray(format);
+}
+
+void Mesh::Draw(const Shader &shader) const
+{
+    bindMaterial(shader);
+
+    // Dessiner la mesh
     glBindVertexArray(VAO);
+    DrawElements();
+    glBindVertexArray(0);
 
-    // VBO
-    glBindBuffer(GL_ARRAY_BUFFER, VBO);
-    glBufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(Vertex), &vertices[0], GL_STATIC_DRAW);
-
-    // EBO
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, EBO);
-    glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size() * sizeof(unsigned int), &indices[0], GL_STATIC_DRAW);
-
-    // Attributs de vertex
-    // Position
-    glEnableVertexAttribArray(0);
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void *)0);
-    // Normale
-    glEnableVertexAttribArray(1);
-    glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void *)offsetof(Vertex, Normal));
-    // Coordonnées de texture
-    glEnableVertexAttribArray(2);
-    glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void *)offsetof(Vertex, TexCoords));
+    // Remettre active texture par défaut
+    glActiveTexture(GL_TEXTURE0);
+}
+
+void Mesh::DrawInstanced(const Shader &shader, const InstanceBuffer &instances, size_t count, size_t first) const
+{
+    if (count == 0)
+        return;
+
+    bindMaterial(shader);
 
+    // Attributs d'instance attachés au VAO le temps du tirage : plusieurs buffers
+    // d'instances peuvent ainsi partager le même mesh
+    glBindVertexArray(VAO);
+    DrawElementsIndirectCommand command = GetDrawCommand(static_cast<unsigned int>(count), static_cast<unsigned int>(first));
+    GeometryBuffer::getInstance().Draw(&command, 1, &instances);
     glBindVertexArray(0);
+
+    glActiveTexture(GL_TEXTURE0);
 }
 
-void Mesh::Draw(const Shader &shader) const
+void Mesh::bindMaterial(const Shader &shader) const
+{
+    BindTextures(shader);
+    SetPositionDecoding(shader);
+}
+
+void Mesh::DrawElements() const
+{
+    glDrawElementsBaseVertex(GL_TRIANGLES, indexCount, GL_UNSIGNED_INT,
+                             (void *)(geometry.firstIndex * sizeof(unsigned int)), geometry.baseVertex);
+}
+
+DrawElementsIndirectCommand Mesh::GetDrawCommand(unsigned int instanceCount, unsigned int baseInstance) const
+{
+    DrawElementsIndirectCommand command;
+    command.count = indexCount;
+    command.instanceCount = instanceCount;
+    command.firstIndex = static_cast<GLuint>(geometry.firstIndex);
+    command.baseVertex = geometry.baseVertex;
+    command.baseInstance = baseInstance;
+    return command;
+}
+
+void Mesh::BindTextures(const Shader &shader) const
 {
+    static constexpr UniformName DIFFUSE("texture_diffuse");
+    static constexpr UniformName SPECULAR("texture_specular");
+
     // Lier textures
     unsigned int diffuseNr = 1;
     unsigned int specularNr = 1;
@@ -50,23 +182,52 @@ void Mesh::Draw(const Shader &shader) const
     for (unsigned int i = 0; i < textures.size(); i++)
     {
         glActiveTexture(GL_TEXTURE0 + i);
-        std::string number;
-        std::string name = textures[i].type;
+        const std::string &name = textures[i].type;
 
+        // Nom de l'échantillonneur haché sans construire de chaîne ("texture_diffuse1"...)
         if (name == "texture_diffuse")
-            number = std::to_string(diffuseNr++);
+            shader.setInt(DIFFUSE.Indexed(diffuseNr++), i);
         else if (name == "texture_specular")
-            number = std::to_string(specularNr++);
+            shader.setInt(SPECULAR.Indexed(specularNr++), i);
+        else
+            shader.setInt(name, i);
 
-        shader.setInt((name + number).c_str(), i);
         glBindTexture(GL_TEXTURE_2D, textures[i].id);
     }
+}
 
-    // Dessiner la mesh
-    glBindVertexArray(VAO);
-    glDrawElements(GL_TRIANGLES, static_cast<unsigned int>(indices.size()), GL_UNSIGNED_INT, 0);
-    glBindVertexArray(0);
+unsigned int Mesh::GetTextureKey() const
+{
+    if (textures.empty())
+        return 0;
 
-    // Remettre active texture par défaut
-    glActiveTexture(GL_TEXTURE0);
+    // Calculée à la demande : Sphere remplace l'identifiant de sa texture une fois chargée
+    uint64_t hash = Hash::FNV64_OFFSET;
+    for (const Texture &texture : textures)
+        hash = Hash::Fnv1a64(&texture.id, sizeof(texture.id), hash);
+    return static_cast<unsigned int>(hash ^ (hash >> 32));
+}
+
+bool Mesh::HasSameTextures(const Mesh &other) const
+{
+    if (textures.size() != other.textures.size())
+        return false;
+
+    // Même texture à chaque unité, sous le même échantillonneur
+    for (size_t i = 0; i < textures.size(); i++)
+    {
+        if (textures[i].id != other.textures[i].id || textures[i].type != other.textures[i].type)
+            return false;
+    }
+    return true;
+}
+
+void Mesh::SetPositionDecoding(const Shader &shader) const
+{
+    static constexpr UniformName POSITION_SCALE("positionScale");
+    static constexpr UniformName POSITION_OFFSET("positionOffset");
+
+    // Déquantification des positions (identité pour le format Float)
+    shader.setVec3(POSITION_SCALE, positionScale);
+    shader.setVec3(POSITION_OFFSET, positionOffset);
 }
@@ -0,0 +1,184 @@
+#include "MeshCache.h"
+#include "SourceStamp.h"
+
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <thread>
+
+namespace
+{
+    const char MAGIC[4] = {'M', 'S', 'H', 'C'};
+
+    struct CacheHeader
+    {
+        char magic[4];
+        uint32_t version;
+        uint32_t vertexStride;
+        uint32_t subMeshCount;
+        uint64_t vertexCount;
+        uint64_t indexCount;
+        SourceStamp source;
+        uint64_t vertexDataOffset;
+        uint64_t indexDataOffset;
+    };
+
+    size_t alignUp(size_t value, size_t alignment)
+    {
+        return (value + alignment - 1) / alignment * alignment;
+    }
+}
+
+std::string MeshCache::GetCachePath(const std::string &sourcePath)
+{
+    return sourcePath + ".meshcache";
+}
+
+bool MeshCache::Write(const std::string &sourcePath, const std::vector<MeshData> &meshes)
+{
+    CacheHeader header;
+    std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+    header.version = VERSION;
+    header.vertexStride = sizeof(Vertex);
+    header.subMeshCount = static_cast<uint32_t>(meshes.size());
+    if (!SourceStamp::Read(sourcePath, header.source))
+        return false;
+
+    std::vector<SubMeshRange> ranges;
+    ranges.reserve(meshes.size());
+    uint64_t vertexCount = 0;
+    uint64_t indexCount = 0;
+    for (const MeshData &mesh : meshes)
+    {
+        SubMeshRange range;
+        range.vertexOffset = static_cast<uint32_t>(vertexCount);
+        range.vertexCount = static_cast<uint32_t>(mesh.vertices.size());
+        range.indexOffset = static_cast<uint32_t>(indexCount);
+        range.indexCount = static_cast<uint32_t>(mesh.indices.size());
+        range.boundsMin = mesh.boundsMin;
+        range.boundsMax = mesh.boundsMax;
+        range.acmrBefore = mesh.acmrBefore;
+        range.acmrAfter = mesh.acmrAfter;
+        range.lodLevel = mesh.lodLevel;
+        range.lodError = mesh.lodError;
+        ranges.push_back(range);
+        vertexCount += mesh.vertices.size();
+        indexCount += mesh.indices.size();
+    }
+    header.vertexCount = vertexCount;
+    header.indexCount = indexCount;
+
+    // Données alignées sur 16 octets pour pouvoir les lire directement depuis la projection
+    size_t rangesOffset = sizeof(CacheHeader);
+    header.vertexDataOffset = alignUp(rangesOffset + ranges.size() * sizeof(SubMeshRange), 16);
+    header.indexDataOffset = alignUp(header.vertexDataOffset + vertexCount * sizeof(Vertex), 16);
+
+    // Écriture dans un fichier temporaire puis renommage, pour ne jamais laisser un cache partiel ;
+    // temporaire propre au thread, deux scènes pouvant charger le même modèle en parallèle
+    std::string cachePath = GetCachePath(sourcePath);
+    std::string tempPath = cachePath + ".tmp" + std::to_string(std::hash<std::thread::id>()(std::this_thread::get_id()));
+    {
+        std::ofstream out(tempPath, std::ios::binary | std::ios::trunc);
+        if (!out)
+            return false;
+
+        const char padding[16] = {};
+        auto padTo = [&](uint64_t offset) {
+            uint64_t position = static_cast<uint64_t>(out.tellp());
+            if (offset > position)
+                out.write(padding, static_cast<std::streamsize>(offset - position));
+        };
+
+        out.write(reinterpret_cast<const char *>(&header), sizeof(header));
+        out.write(reinterpret_cast<const char *>(ranges.data()), static_cast<std::streamsize>(ranges.size() * sizeof(SubMeshRange)));
+        padTo(header.vertexDataOffset);
+        for (const MeshData &mesh : meshes)
+            out.write(reinterpret_cast<const char *>(mesh.vertices.data()), static_cast<std::streamsize>(mesh.vertices.size() * sizeof(Vertex)));
+        padTo(header.indexDataOffset);
+        for (const MeshData &mesh : meshes)
+            out.write(reinterpret_cast<const char *>(mesh.indices.data()), static_cast<std::streamsize>(mesh.indices.size() * sizeof(unsigned int)));
+
+        if (!out)
+            return false;
+    }
+
+    std::error_code ec;
+    std::filesystem::remove(cachePath, ec);
+    std::filesystem::rename(tempPath, cachePath, ec);
+    if (ec)
+    {
+        std::filesystem::remove(tempPath, ec);
+        return false;
+    }
+    return true;
+}
+
+bool MeshCache::Open(const std::string &sourcePath)
+{
+    Close();
+
+    if (!file.Open(GetCachePath(sourcePath)))
+        return false;
+
+    if (file.Size() < sizeof(CacheHeader))
+    {
+        Close();
+        return false;
+    }
+
+    CacheHeader header;
+    std::memcpy(&header, file.Data(), sizeof(header));
+    if (std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0 ||
+        header.version != VERSION ||
+        header.vertexStride != sizeof(Vertex))
+    {
+        Close();
+        return false;
+    }
+
+    uint64_t rangesEnd = sizeof(CacheHeader) + uint64_t(header.subMeshCount) * sizeof(SubMeshRange);
+    if (rangesEnd > header.vertexDataOffset ||
+        header.vertexDataOffset + header.vertexCount * sizeof(Vertex) > header.indexDataOffset ||
+        header.indexDataOffset + header.indexCount * sizeof(unsigned int) > file.Size())
+    {
+        std::cerr << "MeshCache: cache corrompu pour " << sourcePath << std::endl;
+        Close();
+        return false;
+    }
+
+    // Validation de la source
+    if (!header.source.Matches(sourcePath))
+    {
+        Close();
+        return false;
+    }
+
+    subMeshCount = header.subMeshCount;
+    subMeshes = reinterpret_cast<const SubMeshRange *>(file.Data() + sizeof(CacheHeader));
+    vertices = reinterpret_cast<const Vertex *>(file.Data() + header.vertexDataOffset);
+    indices = reinterpret_cast<const unsigned int *>(file.Data() + header.indexDataOffset);
+
+    for (size_t i = 0; i < subMeshCount; ++i)
+    {
+        const SubMeshRange &range = subMeshes[i];
+        if (uint64_t(range.vertexOffset) + range.vertexCount > header.vertexCount ||
+            uint64_t(range.indexOffset) + range.indexCount > header.indexCount)
+        {
+            std::cerr << "MeshCache: plages invalides pour " << sourcePath << std::endl;
+            Close();
+            return false;
+        }
+    }
+    return true;
+}
+
+void MeshCache::Close()
+{
+    file.Close();
+    subMeshCount = 0;
+    subMeshes = nullptr;
+    vertices = nullptr;
+    indices = nullptr;
+}
@@ -0,0 +1,334 @@
+#include "MeshOptimizer.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace
+{
+    // Paramètres de notation de Forsyth ("Linear-Speed Vertex Cache Optimisation")
+    const unsigned int SCORE_CACHE_SIZE = 32;
+    const float CACHE_DECAY_POWER = 1.5f;
+    const float LAST_TRIANGLE_SCORE = 0.75f;
+    const float VALENCE_BOOST_SCALE = 2.0f;
+    const float VALENCE_BOOST_POWER = 0.5f;
+    const unsigned int MAX_TABULATED_VALENCE = 32;
+
+    struct ScoreTables
+    {
+        float cache[SCORE_CACHE_SIZE];
+        float valence[MAX_TABULATED_VALENCE + 1];
+
+        ScoreTables()
+        {
+            for (unsigned int i = 0; i < SCORE_CACHE_SIZE; i++)
+            {
+                if (i < 3)
+                {
+                    // Sommets du dernier triangle émis : bonus fixe, pour ne pas favoriser les bandes
+                    cache[i] = LAST_TRIANGLE_SCORE;
+                }
+                else
+                {
+                    float scaler = 1.0f / float(SCORE_CACHE_SIZE - 3);
+                    cache[i] = std::pow(1.0f - float(i - 3) * scaler, CACHE_DECAY_POWER);
+                }
+            }
+            valence[0] = 0.0f;
+            for (unsigned int i = 1; i <= MAX_TABULATED_VALENCE; i++)
+                valence[i] = VALENCE_BOOST_SCALE * std::pow(float(i), -VALENCE_BOOST_POWER);
+        }
+    };
+
+    float vertexScore(const ScoreTables &tables, int cachePosition, unsigned int remaining)
+    {
+        // Plus aucun triangle à émettre pour ce sommet
+        if (remaining == 0)
+            return -1.0f;
+
+        float score = cachePosition >= 0 ? tables.cache[cachePosition] : 0.0f;
+
+        // Bonus aux sommets peu utilisés, pour ne pas laisser de triangles isolés derrière soi
+        if (remaining <= MAX_TABULATED_VALENCE)
+            score += tables.valence[remaining];
+        else
+            score += VALENCE_BOOST_SCALE * std::pow(float(remaining), -VALENCE_BOOST_POWER);
+        return score;
+    }
+}
+
+void MeshOptimizer::Optimize(MeshData &mesh)
+{
+    if (mesh.indices.size() % 3 != 0)
+        return;
+
+    mesh.acmrBefore = ComputeACMR(mesh.indices, mesh.vertices.size());
+
+    OptimizeVertexCache(mesh.indices, mesh.vertices.size());
+    OptimizeOverdraw(mesh.indices, mesh.vertices);
+    OptimizeVertexFetch(mesh.vertices, mesh.indices);
+
+    mesh.acmrAfter = ComputeACMR(mesh.indices, mesh.vertices.size());
+    mesh.ComputeBounds();
+}
+
+float MeshOptimizer::ComputeACMR(const std::vector<unsigned int> &indices, size_t vertexCount, unsigned int cacheSize)
+{
+    size_t triangleCount = indices.size() / 3;
+    if (triangleCount == 0)
+        return 0.0f;
+
+    // Cache FIFO : un sommet est présent s'il a été chargé moins de cacheSize chargements plus tôt
+    std::vector<unsigned int> timestamps(vertexCount, 0);
+    unsigned int time = cacheSize + 1;
+    size_t misses = 0;
+    for (size_t i = 0; i < triangleCount * 3; i++)
+    {
+        unsigned int v = indices[i];
+        if (time - timestamps[v] > cacheSize)
+        {
+            timestamps[v] = time++;
+            misses++;
+        }
+    }
+    return float(misses) / float(triangleCount);
+}
+
+void MeshOptimizer::OptimizeVertexCache(std::vector<unsigned int> &indices, size_t vertexCount)
+{
+    size_t triangleCount = indices.size() / 3;
+    if (triangleCount == 0)
+        return;
+
+    static const ScoreTables tables;
+
+    // Adjacence sommet -> triangles (listes compactées, raccourcies à chaque émission)
+    std::vector<unsigned int> remaining(vertexCount, 0);
+    for (size_t i = 0; i < triangleCount * 3; i++)
+        remaining[indices[i]]++;
+
+    std::vector<unsigned int> offsets(vertexCount + 1, 0);
+    for (size_t v = 0; v < vertexCount; v++)
+        offsets[v + 1] = offsets[v] + remaining[v];
+
+    std::vector<unsigned int> adjacency(triangleCount * 3);
+    {
+        std::vector<unsigned int> fill(offsets.begin(), offsets.end() - 1);
+        for (size_t t = 0; t < triangleCount; t++)
+            for (size_t k = 0; k < 3; k++)
+                adjacency[fill[indices[t * 3 + k]]++] = static_cast<unsigned int>(t);
+    }
+
+    std::vector<float> scores(vertexCount);
+    for (size_t v = 0; v < vertexCount; v++)
+        scores[v] = vertexScore(tables, -1, remaining[v]);
+
+    // Premier triangle : le meilleur score global
+    size_t best = 0;
+    float bestScore = -std::numeric_limits<float>::max();
+    for (size_t t = 0; t < triangleCount; t++)
+    {
+        float score = scores[indices[t * 3]] + scores[indices[t * 3 + 1]] + scores[indices[t * 3 + 2]];
+        if (score > bestScore)
+        {
+            bestScore = score;
+            best = t;
+        }
+    }
+
+    std::vector<char> emitted(triangleCount, 0);
+    std::vector<unsigned int> result;
+    result.reserve(triangleCount * 3);
+
+    std::vector<unsigned int> cache;
+    std::vector<unsigned int> newCache;
+    cache.reserve(SCORE_CACHE_SIZE + 3);
+    newCache.reserve(SCORE_CACHE_SIZE + 3);
+
+    const size_t none = std::numeric_limits<size_t>::max();
+    size_t cursor = 0;
+
+    while (result.size() < triangleCount * 3)
+    {
+        // Aucun candidat dans le cache : premier triangle restant
+        if (best == none)
+        {
+            while (emitted[cursor])
+                cursor++;
+            best = cursor;
+        }
+
+        const unsigned int *triangle = &indices[best * 3];
+        result.insert(result.end(), triangle, triangle + 3);
+        emitted[best] = 1;
+
+        // Retirer le triangle des listes d'adjacence de ses sommets
+        for (size_t k = 0; k < 3; k++)
+        {
+            unsigned int v = triangle[k];
+            unsigned int *list = &adjacency[offsets[v]];
+            for (unsigned int i = 0; i < remaining[v]; i++)
+            {
+                if (list[i] == best)
+                {
+                    list[i] = list[remaining[v] - 1];
+                    break;
+                }
+            }
+            remaining[v]--;
+        }
+
+        // Nouveau cache : sommets du triangle en tête, puis l'ancien contenu
+        newCache.clear();
+        for (size_t k = 0; k < 3; k++)
+            if (std::find(newCache.begin(), newCache.end(), triangle[k]) == newCache.end())
+                newCache.push_back(triangle[k]);
+        for (unsigned int v : cache)
+            if (v != triangle[0] && v != triangle[1] && v != triangle[2])
+                newCache.push_back(v);
+
+        // Sommets sortis du cache
+        for (size_t i = SCORE_CACHE_SIZE; i < newCache.size(); i++)
+        {
+            unsigned int v = newCache[i];
+            scores[v] = vertexScore(tables, -1, remaining[v]);
+        }
+        if (newCache.size() > SCORE_CACHE_SIZE)
+            newCache.resize(SCORE_CACHE_SIZE);
+
+        for (size_t i = 0; i < newCache.size(); i++)
+        {
+            unsigned int v = newCache[i];
+            scores[v] = vertexScore(tables, static_cast<int>(i), remaining[v]);
+        }
+
+        // Candidats suivants : les triangles restants qui touchent un sommet du cache
+        best = none;
+        bestScore = -std::numeric_limits<float>::max();
+        for (unsigned int v : newCache)
+        {
+            for (unsigned int j = 0; j < remaining[v]; j++)
+            {
+                unsigned int t = adjacency[offsets[v] + j];
+                float score = scores[indices[t * 3]] + scores[indices[t * 3 + 1]] + scores[indices[t * 3 + 2]];
+                if (score > bestScore)
+                {
+                    bestScore = score;
+                    best = t;
+                }
+            }
+        }
+
+        cache.swap(newCache);
+    }
+
+    indices.swap(result);
+}
+
+void MeshOptimizer::OptimizeOverdraw(std::vector<unsigned int> &indices, const std::vector<Vertex> &vertices, float threshold)
+{
+    size_t triangleCount = indices.size() / 3;
+    if (triangleCount == 0)
+        return;
+
+    float acmrBefore = ComputeACMR(indices, vertices.size());
+
+    // Frontières de clusters : triangles qui manquent le cache sur leurs trois sommets,
+    // l'ordre à l'intérieur d'un cluster est ainsi conservé tel quel
+    std::vector<size_t> clusterStarts;
+    {
+        std::vector<unsigned int> timestamps(vertices.size(), 0);
+        unsigned int time = CACHE_SIZE + 1;
+        for (size_t t = 0; t < triangleCount; t++)
+        {
+            unsigned int misses = 0;
+            for (size_t k = 0; k < 3; k++)
+            {
+                unsigned int v = indices[t * 3 + k];
+                if (time - timestamps[v] > CACHE_SIZE)
+                {
+                    timestamps[v] = time++;
+                    misses++;
+                }
+            }
+            if (t == 0 || misses == 3)
+                clusterStarts.push_back(t);
+        }
+    }
+    if (clusterStarts.size() < 2)
+        return;
+    clusterStarts.push_back(triangleCount);
+
+    // Centre et normale moyenne de chaque cluster, pondérés par l'aire des triangles
+    size_t clusterCount = clusterStarts.size() - 1;
+    std::vector<glm::vec3> centroids(clusterCount, glm::vec3(0.0f));
+    std::vector<glm::vec3> normals(clusterCount, glm::vec3(0.0f));
+    glm::vec3 meshCentroid(0.0f);
+    float meshArea = 0.0f;
+
+    for (size_t c = 0; c < clusterCount; c++)
+    {
+        float clusterArea = 0.0f;
+        for (size_t t = clusterStarts[c]; t < clusterStarts[c + 1]; t++)
+        {
+            const glm::vec3 &a = vertices[indices[t * 3]].Position;
+            const glm::vec3 &b = vertices[indices[t * 3 + 1]].Position;
+            const glm::vec3 &p = vertices[indices[t * 3 + 2]].Position;
+            glm::vec3 n = glm::cross(b - a, p - a);
+            float area = glm::length(n);
+            centroids[c] += (a + b + p) * (area / 3.0f);
+            normals[c] += n;
+            clusterArea += area;
+        }
+        meshCentroid += centroids[c];
+        meshArea += clusterArea;
+        if (clusterArea > 0.0f)
+            centroids[c] /= clusterArea;
+    }
+    if (meshArea > 0.0f)
+        meshCentroid /= meshArea;
+
+    // Les clusters tournés vers l'extérieur d'abord : ils occultent ceux du centre
+    std::vector<float> sortKeys(clusterCount);
+    for (size_t c = 0; c < clusterCount; c++)
+    {
+        float length = glm::length(normals[c]);
+        sortKeys[c] = length > 0.0f ? glm::dot(centroids[c] - meshCentroid, normals[c] / length) : 0.0f;
+    }
+
+    std::vector<size_t> order(clusterCount);
+    for (size_t c = 0; c < clusterCount; c++)
+        order[c] = c;
+    std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+        return sortKeys[a] > sortKeys[b];
+    });
+
+    std::vector<unsigned int> result;
+    result.reserve(indices.size());
+    for (size_t c : order)
+        result.insert(result.end(), indices.begin() + clusterStarts[c] * 3, indices.begin() + clusterStarts[c + 1] * 3);
+
+    // Conserver l'ordre optimisé pour le cache si le tri le dégrade trop
+    if (ComputeACMR(result, vertices.size()) <= acmrBefore * threshold)
+        indices.swap(result);
+}
+
+void MeshOptimizer::OptimizeVertexFetch(std::vector<Vertex> &vertices, std::vector<unsigned int> &indices)
+{
+    const unsigned int unused = std::numeric_limits<unsigned int>::max();
+    std::vector<unsigned int> remap(vertices.size(), unused);
+    std::vector<Vertex> result;
+    result.reserve(vertices.size());
+
+    for (unsigned int &index : indices)
+    {
+        if (remap[index] == unused)
+        {
+            remap[index] = static_cast<unsigned int>(result.size());
+            result.push_back(vertices[index]);
+        }
+        index = remap[index];
+    }
+
+    vertices.swap(result);
+}
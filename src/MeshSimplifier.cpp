@@ -0,0 +1,334 @@
+#include "MeshSimplifier.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <queue>
+#include <unordered_map>
+
+namespace
+{
+    // Quadrique symétrique 4x4 (10 coefficients), en double pour la stabilité des sommes
+    struct Quadric
+    {
+        double a2 = 0, ab = 0, ac = 0, ad = 0;
+        double b2 = 0, bc = 0, bd = 0;
+        double c2 = 0, cd = 0;
+        double d2 = 0;
+
+        static Quadric FromPlane(double a, double b, double c, double d, double weight)
+        {
+            Quadric q;
+            q.a2 = a * a * weight; q.ab = a * b * weight; q.ac = a * c * weight; q.ad = a * d * weight;
+            q.b2 = b * b * weight; q.bc = b * c * weight; q.bd = b * d * weight;
+            q.c2 = c * c * weight; q.cd = c * d * weight;
+            q.d2 = d * d * weight;
+            return q;
+        }
+
+        void Add(const Quadric &q)
+        {
+            a2 += q.a2; ab += q.ab; ac += q.ac; ad += q.ad;
+            b2 += q.b2; bc += q.bc; bd += q.bd;
+            c2 += q.c2; cd += q.cd;
+            d2 += q.d2;
+        }
+
+        // Somme des distances au carré de p aux plans accumulés
+        double Error(const glm::vec3 &p) const
+        {
+            double x = p.x, y = p.y, z = p.z;
+            double e = a2 * x * x + 2 * ab * x * y + 2 * ac * x * z + 2 * ad * x
+                     + b2 * y * y + 2 * bc * y * z + 2 * bd * y
+                     + c2 * z * z + 2 * cd * z
+                     + d2;
+            return e > 0.0 ? e : 0.0;
+        }
+    };
+
+    struct Collapse
+    {
+        float cost;
+        unsigned int from;
+        unsigned int to;
+        unsigned int fromVersion;
+        unsigned int toVersion;
+
+        bool operator>(const Collapse &other) const { return cost > other.cost; }
+    };
+
+    struct PositionHash
+    {
+        size_t operator()(const glm::vec3 &p) const
+        {
+            uint32_t bits[3];
+            std::memcpy(bits, &p.x, sizeof(float));
+            std::memcpy(bits + 1, &p.y, sizeof(float));
+            std::memcpy(bits + 2, &p.z, sizeof(float));
+            return size_t(bits[0]) * 73856093u ^ size_t(bits[1]) * 19349663u ^ size_t(bits[2]) * 83492791u;
+        }
+    };
+
+    struct PositionEqual
+    {
+        bool operator()(const glm::vec3 &a, const glm::vec3 &b) const
+        {
+            return a.x == b.x && a.y == b.y && a.z == b.z;
+        }
+    };
+
+    // Poids des plans de contrainte le long des bords ouverts
+    const double BORDER_WEIGHT = 10.0;
+
+    // Refus des effondrements qui font trop pivoter un triangle voisin
+    const float MIN_NORMAL_DOT = 0.2f;
+}
+
+MeshData MeshSimplifier::Simplify(const MeshData &mesh, float targetRatio, float maxError, float *resultError)
+{
+    if (resultError)
+        *resultError = 0.0f;
+
+    // 1. Soudure par position : la simplification travaille sur des "positions" uniques
+    std::vector<unsigned int> positionOf(mesh.vertices.size());
+    std::vector<glm::vec3> positions;
+    std::vector<unsigned int> representative;
+    {
+        std::unordered_map<glm::vec3, unsigned int, PositionHash, PositionEqual> unique;
+        unique.reserve(mesh.vertices.size());
+        for (size_t i = 0; i < mesh.vertices.size(); i++)
+        {
+            auto inserted = unique.emplace(mesh.vertices[i].Position, static_cast<unsigned int>(positions.size()));
+            if (inserted.second)
+            {
+                positions.push_back(mesh.vertices[i].Position);
+                representative.push_back(static_cast<unsigned int>(i));
+            }
+            positionOf[i] = inserted.first->second;
+        }
+    }
+
+    std::vector<unsigned int> triangles;
+    triangles.reserve(mesh.indices.size());
+    for (size_t i = 0; i + 2 < mesh.indices.size(); i += 3)
+    {
+        unsigned int a = positionOf[mesh.indices[i]];
+        unsigned int b = positionOf[mesh.indices[i + 1]];
+        unsigned int c = positionOf[mesh.indices[i + 2]];
+        if (a != b && b != c && a != c)
+        {
+            triangles.push_back(a);
+            triangles.push_back(b);
+            triangles.push_back(c);
+        }
+    }
+
+    size_t positionCount = positions.size();
+    size_t triangleCount = triangles.size() / 3;
+    size_t targetCount = static_cast<size_t>(triangleCount * std::max(0.0f, std::min(1.0f, targetRatio)));
+
+    // 2. Quadriques des faces et adjacence position -> triangles
+    std::vector<Quadric> quadrics(positionCount);
+    std::vector<std::vector<unsigned int>> adjacency(positionCount);
+    std::unordered_map<uint64_t, int> edgeUse;
+    edgeUse.reserve(triangles.size());
+
+    auto edgeKey = [](unsigned int a, unsigned int b) {
+        return a < b ? (uint64_t(a) << 32) | b : (uint64_t(b) << 32) | a;
+    };
+
+    for (size_t t = 0; t < triangleCount; t++)
+    {
+        const glm::vec3 &p0 = positions[triangles[t * 3]];
+        const glm::vec3 &p1 = positions[triangles[t * 3 + 1]];
+        const glm::vec3 &p2 = positions[triangles[t * 3 + 2]];
+        glm::vec3 n = glm::cross(p1 - p0, p2 - p0);
+        float length = glm::length(n);
+        if (length > 0.0f)
+        {
+            n /= length;
+            Quadric q = Quadric::FromPlane(n.x, n.y, n.z, -glm::dot(n, p0), 1.0);
+            for (size_t k = 0; k < 3; k++)
+                quadrics[triangles[t * 3 + k]].Add(q);
+        }
+        for (size_t k = 0; k < 3; k++)
+        {
+            adjacency[triangles[t * 3 + k]].push_back(static_cast<unsigned int>(t));
+            edgeUse[edgeKey(triangles[t * 3 + k], triangles[t * 3 + (k + 1) % 3])]++;
+        }
+    }
+
+    // Bords ouverts : plan perpendiculaire au triangle passant par l'arête
+    for (size_t t = 0; t < triangleCount; t++)
+    {
+        const glm::vec3 &p0 = positions[triangles[t * 3]];
+        const glm::vec3 &p1 = positions[triangles[t * 3 + 1]];
+        const glm::vec3 &p2 = positions[triangles[t * 3 + 2]];
+        glm::vec3 faceNormal = glm::cross(p1 - p0, p2 - p0);
+        for (size_t k = 0; k < 3; k++)
+        {
+            unsigned int a = triangles[t * 3 + k];
+            unsigned int b = triangles[t * 3 + (k + 1) % 3];
+            if (edgeUse[edgeKey(a, b)] != 1)
+                continue;
+            glm::vec3 edge = positions[b] - positions[a];
+            glm::vec3 n = glm::cross(edge, faceNormal);
+            float length = glm::length(n);
+            if (length <= 0.0f)
+                continue;
+            n /= length;
+            Quadric q = Quadric::FromPlane(n.x, n.y, n.z, -glm::dot(n, positions[a]), BORDER_WEIGHT);
+            quadrics[a].Add(q);
+            quadrics[b].Add(q);
+        }
+    }
+
+    // 3. Effondrements par coût croissant (entrées périmées repérées par les versions)
+    std::vector<unsigned int> version(positionCount, 0);
+    std::vector<char> removedPosition(positionCount, 0);
+    std::vector<char> removedTriangle(triangleCount, 0);
+    std::priority_queue<Collapse, std::vector<Collapse>, std::greater<Collapse>> queue;
+
+    auto pushEdge = [&](unsigned int a, unsigned int b) {
+        Quadric q = quadrics[a];
+        q.Add(quadrics[b]);
+        double toB = q.Error(positions[b]);
+        double toA = q.Error(positions[a]);
+        Collapse collapse;
+        if (toB <= toA)
+            collapse = {static_cast<float>(toB), a, b, version[a], version[b]};
+        else
+            collapse = {static_cast<float>(toA), b, a, version[b], version[a]};
+        queue.push(collapse);
+    };
+
+    for (const auto &edge : edgeUse)
+        pushEdge(static_cast<unsigned int>(edge.first >> 32), static_cast<unsigned int>(edge.first & 0xffffffffu));
+
+    const float maxCost = maxError * maxError;
+    size_t liveTriangles = triangleCount;
+    float reachedCost = 0.0f;
+
+    std::vector<unsigned int> neighbours;
+    while (liveTriangles > targetCount && !queue.empty())
+    {
+        Collapse collapse = queue.top();
+        queue.pop();
+
+        unsigned int u = collapse.from;
+        unsigned int v = collapse.to;
+        if (removedPosition[u] || removedPosition[v] ||
+            version[u] != collapse.fromVersion || version[v] != collapse.toVersion)
+            continue;
+        if (collapse.cost > maxCost)
+            break;
+
+        // Refuser l'effondrement s'il retourne ou écrase un triangle voisin
+        bool valid = true;
+        for (unsigned int t : adjacency[u])
+        {
+            if (removedTriangle[t])
+                continue;
+            unsigned int *tri = &triangles[t * 3];
+            if (tri[0] == v || tri[1] == v || tri[2] == v)
+                continue;
+
+            glm::vec3 before[3], after[3];
+            for (size_t k = 0; k < 3; k++)
+            {
+                before[k] = positions[tri[k]];
+                after[k] = tri[k] == u ? positions[v] : before[k];
+            }
+            glm::vec3 n0 = glm::cross(before[1] - before[0], before[2] - before[0]);
+            glm::vec3 n1 = glm::cross(after[1] - after[0], after[2] - after[0]);
+            float l0 = glm::length(n0);
+            float l1 = glm::length(n1);
+            if (l1 <= 0.0f || (l0 > 0.0f && glm::dot(n0, n1) < MIN_NORMAL_DOT * l0 * l1))
+            {
+                valid = false;
+                break;
+            }
+        }
+        if (!valid)
+            continue;
+
+        // Effondrer u sur v
+        for (unsigned int t : adjacency[u])
+        {
+            if (removedTriangle[t])
+                continue;
+            unsigned int *tri = &triangles[t * 3];
+            if (tri[0] == v || tri[1] == v || tri[2] == v)
+            {
+                removedTriangle[t] = 1;
+                liveTriangles--;
+                continue;
+            }
+            for (size_t k = 0; k < 3; k++)
+                if (tri[k] == u)
+                    tri[k] = v;
+            adjacency[v].push_back(t);
+        }
+        adjacency[u].clear();
+        removedPosition[u] = 1;
+        quadrics[v].Add(quadrics[u]);
+        version[v]++;
+        reachedCost = std::max(reachedCost, collapse.cost);
+
+        // Compacter la liste de v et recalculer le coût des arêtes voisines
+        std::vector<unsigned int> &list = adjacency[v];
+        list.erase(std::remove_if(list.begin(), list.end(), [&](unsigned int t) { return removedTriangle[t] != 0; }), list.end());
+
+        neighbours.clear();
+        for (unsigned int t : list)
+            for (size_t k = 0; k < 3; k++)
+                if (triangles[t * 3 + k] != v)
+                    neighbours.push_back(triangles[t * 3 + k]);
+        std::sort(neighbours.begin(), neighbours.end());
+        neighbours.erase(std::unique(neighbours.begin(), neighbours.end()), neighbours.end());
+        for (unsigned int n : neighbours)
+            pushEdge(v, n);
+    }
+
+    if (resultError)
+        *resultError = std::sqrt(reachedCost);
+
+    // 4. Reconstruction : un sommet par position conservée, normales recalculées sur les faces
+    MeshData result;
+    result.textures = mesh.textures;
+    result.format = mesh.format;
+
+    std::vector<unsigned int> remap(positionCount, ~0u);
+    std::vector<glm::vec3> normals;
+    for (size_t t = 0; t < triangleCount; t++)
+    {
+        if (removedTriangle[t])
+            continue;
+        const unsigned int *tri = &triangles[t * 3];
+        glm::vec3 faceNormal = glm::cross(positions[tri[1]] - positions[tri[0]], positions[tri[2]] - positions[tri[0]]);
+        for (size_t k = 0; k < 3; k++)
+        {
+            unsigned int p = tri[k];
+            if (remap[p] == ~0u)
+            {
+                remap[p] = static_cast<unsigned int>(result.vertices.size());
+                Vertex vertex = mesh.vertices[representative[p]];
+                vertex.Position = positions[p];
+                result.vertices.push_back(vertex);
+                normals.push_back(glm::vec3(0.0f));
+            }
+            normals[remap[p]] += faceNormal;
+            result.indices.push_back(remap[p]);
+        }
+    }
+
+    for (size_t i = 0; i < result.vertices.size(); i++)
+    {
+        float length = glm::length(normals[i]);
+        if (length > 0.0f)
+            result.vertices[i].Normal = normals[i] / length;
+    }
+
+    result.ComputeBounds();
+    return result;
+}
@@ -1,29 +1,350 @@
 #include "Model.h"
+#include "AssetLoader.h"
+#include "MeshCache.h"
+#include "MeshOptimizer.h"
+#include "MeshSimplifier.h"
+#include "ObjParser.h"
 #include "tiny_obj_loader.h"
 
+#include <algorithm>
+#include <chrono>
+#include <cmath>
 #include <iostream>
+#include <unordered_map>
+#include <utility>
 
-Model::Model(const std::string &path)
+namespace
 {
-    loadModel(path);
+    // Clé de déduplication : triplet d'indices (position, normale, coordonnée de texture)
+    struct VertexKey
+    {
+        int vertex_index;
+        int normal_index;
+        int texcoord_index;
+
+        bool operator==(const VertexKey &other) const
+        {
+            return vertex_index == other.vertex_index &&
+                   normal_index == other.normal_index &&
+                   texcoord_index == other.texcoord_index;
+        }
+    };
+
+    struct VertexKeyHash
+    {
+        size_t operator()(const VertexKey &key) const
+        {
+            // Mélange simple des trois indices (constantes de hachage spatial classiques)
+            size_t h = static_cast<size_t>(key.vertex_index) * 73856093u;
+            h ^= static_cast<size_t>(key.normal_index) * 19349663u;
+            h ^= static_cast<size_t>(key.texcoord_index) * 83492791u;
+            return h;
+        }
+    };
+
+    // Cibles des LOD 1 à 3 : fraction des triangles conservés et erreur maximale
+    // (relative au rayon du modèle) ; la simplification s'arrête au premier seuil atteint
+    struct LodTarget
+    {
+        float ratio;
+        float maxError;
+    };
+    const LodTarget LOD_TARGETS[] = {{0.5f, 0.01f}, {0.2f, 0.03f}, {0.06f, 0.1f}};
+
+    // Pas de LOD pour les petits meshes, ni de LOD qui retire moins de 20 % des triangles
+    const size_t LOD_MIN_TRIANGLES = 64;
+    const float LOD_MIN_REDUCTION = 0.8f;
+
+    // Versions simplifiées d'un sous-mesh, de la plus fine à la plus grossière
+    std::vector<MeshData> buildLods(const MeshData &mesh)
+    {
+        std::vector<MeshData> lods;
+        size_t previousTriangles = mesh.indices.size() / 3;
+        if (previousTriangles < LOD_MIN_TRIANGLES)
+            return lods;
+
+        float radius = 0.5f * glm::length(mesh.boundsMax - mesh.boundsMin);
+        for (const LodTarget &target : LOD_TARGETS)
+        {
+            float error = 0.0f;
+            MeshData lod = MeshSimplifier::Simplify(mesh, target.ratio, target.maxError * radius, &error);
+            size_t triangles = lod.indices.size() / 3;
+            if (triangles == 0 || triangles > previousTriangles * LOD_MIN_REDUCTION)
+                break;
+
+            MeshOptimizer::Optimize(lod);
+            lod.lodLevel = static_cast<unsigned int>(lods.size() + 1);
+            // L'erreur d'un LOD ne peut pas être inférieure à celle du précédent
+            lod.lodError = std::max(error, lods.empty() ? 0.0f : lods.back().lodError);
+            previousTriangles = triangles;
+            lods.push_back(std::move(lod));
+        }
+        return lods;
+    }
+
+    // Octaèdre unitaire affiché à la place d'un modèle en cours de chargement
+    const Mesh &placeholderMesh()
+    {
+        static const Mesh *mesh = nullptr;
+        if (!mesh)
+        {
+            const glm::vec3 axes[6] = {
+                glm::vec3(1.0f, 0.0f, 0.0f), glm::vec3(-1.0f, 0.0f, 0.0f),
+                glm::vec3(0.0f, 1.0f, 0.0f), glm::vec3(0.0f, -1.0f, 0.0f),
+                glm::vec3(0.0f, 0.0f, 1.0f), glm::vec3(0.0f, 0.0f, -1.0f)};
+            std::vector<Vertex> vertices;
+            for (const glm::vec3 &axis : axes)
+                vertices.push_back({axis, axis, glm::vec2(0.0f)});
+            std::vector<unsigned int> indices = {0, 2, 4, 2, 1, 4, 1, 3, 4, 3, 0, 4,
+                                                 2, 0, 5, 1, 2, 5, 3, 1, 5, 0, 3, 5};
+            mesh = new Mesh(std::move(vertices), std::move(indices), std::vector<Texture>());
+        }
+        return *mesh;
+    }
+}
+
+// Résultat de la phase CPU du chargement, transmis au thread OpenGL
+struct Model::LoadedData
+{
+    MeshCache cache;              // projection du cache binaire, si valide
+    std::vector<MeshData> meshes; // sinon, meshes importés depuis l'OBJ
+    bool fromCache = false;
+
+    size_t Bytes() const
+    {
+        size_t bytes = 0;
+        if (fromCache)
+        {
+            for (size_t i = 0; i < cache.GetSubMeshCount(); i++)
+                bytes += cache.GetSubMesh(i).vertexCount * sizeof(Vertex) + cache.GetSubMesh(i).indexCount * sizeof(unsigned int);
+        }
+        for (const MeshData &mesh : meshes)
+            bytes += mesh.vertices.size() * sizeof(Vertex) + mesh.indices.size() * sizeof(unsigned int);
+        return bytes;
+    }
+};
+
+Model::Model(const std::string &path, bool streamed, VertexFormat format)
+    : format(format)
+{
+    directory = path.substr(0, path.find_last_of('/'));
+
+    std::shared_ptr<LoadedData> data = std::make_shared<LoadedData>();
+    if (!streamed)
+    {
+        decode(path, *data);
+        upload(*data);
+        return;
+    }
+
+    // Le jeton permet d'ignorer l'envoi si le modèle a été détruit entre-temps
+    streamToken = std::make_shared<int>(0);
+    std::weak_ptr<int> token = streamToken;
+    AssetLoader::getInstance().Submit([this, token, path, data]() {
+        decode(path, *data);
+
+        AssetLoader::Upload result;
+        result.bytes = data->Bytes();
+        result.apply = [this, token, data]() {
+            if (!token.expired())
+                upload(*data);
+        };
+        return result;
+    });
 }
 
 void Model::Draw(const Shader &shader) const
 {
-    for (unsigned int i = 0; i < meshes.size(); i++)
-        meshes[i].Draw(shader);
+    Draw(shader, 0);
+}
+
+void Model::Draw(const Shader &shader, size_t lod) const
+{
+    if (!loaded)
+    {
+        placeholderMesh().Draw(shader);
+        return;
+    }
+
+    drawCommands.clear();
+    AppendDrawCommands(drawCommands, lod, 1, 0);
+    drawCommandList(shader, nullptr);
 }
 
-void Model::loadModel(const std::string &path)
+void Model::Submit(RenderQueue &queue, DrawPacket packet, size_t lod) const
 {
+    if (!loaded)
+    {
+        packet.mesh = &placeholderMesh();
+        queue.Submit(packet);
+        return;
+    }
+
+    for (size_t i = 0; i < meshes.size();)
+    {
+        size_t next;
+        packet.mesh = &meshes[selectLodMesh(i, lod, next)];
+        queue.Submit(packet);
+        i = next;
+    }
+}
+
+void Model::DrawInstanced(const Shader &shader, const InstanceBuffer &instances, size_t count, size_t lod, size_t first) const
+{
+    if (!loaded)
+    {
+        placeholderMesh().DrawInstanced(shader, instances, count, first);
+        return;
+    }
+
+    if (count == 0)
+        return;
+
+    drawCommands.clear();
+    AppendDrawCommands(drawCommands, lod, count, first);
+    drawCommandList(shader, &instances);
+}
+
+void Model::DrawInstancedByLod(const Shader &shader, const InstanceBuffer &instances, const std::vector<size_t> &lodOffsets) const
+{
+    if (!loaded)
+    {
+        placeholderMesh().DrawInstanced(shader, instances, lodOffsets.back(), 0);
+        return;
+    }
+
+    drawCommands.clear();
+    for (size_t lod = 0; lod + 1 < lodOffsets.size(); lod++)
+    {
+        if (lodOffsets[lod + 1] > lodOffsets[lod])
+            AppendDrawCommands(drawCommands, lod, lodOffsets[lod + 1] - lodOffsets[lod], lodOffsets[lod]);
+    }
+    drawCommandList(shader, &instances);
+}
+
+void Model::AppendDrawCommands(std::vector<DrawElementsIndirectCommand> &commands, size_t lod,
+                               size_t instanceCount, size_t baseInstance) const
+{
+    if (!loaded)
+    {
+        commands.push_back(placeholderMesh().GetDrawCommand(static_cast<unsigned int>(instanceCount),
+                                                            static_cast<unsigned int>(baseInstance)));
+        return;
+    }
+
+    for (size_t i = 0; i < meshes.size();)
+    {
+        size_t next;
+        commands.push_back(meshes[selectLodMesh(i, lod, next)].GetDrawCommand(static_cast<unsigned int>(instanceCount),
+                                                                              static_cast<unsigned int>(baseInstance)));
+        i = next;
+    }
+}
+
+void Model::DrawIndirect(const Shader &shader, GLuint commandBuffer, size_t commandCount, const InstanceBuffer &instances) const
+{
+    if (commandCount == 0)
+        return;
+
+    bindDrawState(shader);
+    GeometryBuffer::getInstance().DrawIndirect(commandBuffer, commandCount, &instances);
+    glBindVertexArray(0);
+    glActiveTexture(GL_TEXTURE0);
+}
+
+void Model::bindDrawState(const Shader &shader) const
+{
+    // Sous-meshes sans texture propre, de même format et quantifiés dans la même boîte
+    // (voir upload) : l'état du premier vaut pour toutes les commandes
+    const Mesh &first = loaded && !meshes.empty() ? meshes.front() : placeholderMesh();
+    first.BindTextures(shader);
+    first.SetPositionDecoding(shader);
+    glBindVertexArray(first.VAO);
+}
+
+void Model::drawCommandList(const Shader &shader, const InstanceBuffer *instances) const
+{
+    if (drawCommands.empty())
+        return;
+
+    bindDrawState(shader);
+    GeometryBuffer::getInstance().Draw(drawCommands.data(), drawCommands.size(), instances);
+    glBindVertexArray(0);
+    glActiveTexture(GL_TEXTURE0);
+}
+
+size_t Model::selectLodMesh(size_t group, size_t lod, size_t &next) const
+{
+    // Chaque groupe commence par un mesh de LOD 0 ; on prend le niveau le plus proche
+    // de celui demandé parmi ceux disponibles pour ce sous-mesh
+    size_t chosen = group;
+    for (next = group + 1; next < meshes.size() && meshes[next].lodLevel != 0; next++)
+    {
+        if (meshes[next].lodLevel <= lod)
+            chosen = next;
+    }
+    return chosen;
+}
+
+float Model::GetLodPixelScale(float fovYDegrees, int screenHeight)
+{
+    return screenHeight / (2.0f * std::tan(glm::radians(fovYDegrees) * 0.5f));
+}
+
+size_t Model::SelectLod(float distance, float scale, float pixelScale, size_t currentLod) const
+{
+    if (lodErrors.size() <= 1)
+        return 0;
+
+    // Taille à l'écran d'une unité du modèle, en pixels
+    float pixelsPerUnit = scale * pixelScale / std::max(distance, 0.001f);
+    size_t lod = std::min(currentLod, lodErrors.size() - 1);
+
+    // Plus grossier tant que l'erreur projetée reste nettement sous le seuil...
+    while (lod + 1 < lodErrors.size() && lodErrors[lod + 1] * pixelsPerUnit <= LOD_PIXEL_ERROR * (1.0f - LOD_HYSTERESIS))
+        lod++;
+    // ... plus fin dès qu'elle le dépasse nettement
+    while (lod > 0 && lodErrors[lod] * pixelsPerUnit > LOD_PIXEL_ERROR * (1.0f + LOD_HYSTERESIS))
+        lod--;
+    return lod;
+}
+
+bool Model::decode(const std::string &path, LoadedData &data)
+{
+    auto start = std::chrono::steady_clock::now();
+
+    // Chemin rapide : cache binaire projeté en mémoire
+    if (data.cache.Open(path))
+    {
+        data.fromCache = true;
+        double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        float acmrBefore = 0.0f, acmrAfter = 0.0f;
+        size_t indexCount = 0;
+        for (size_t i = 0; i < data.cache.GetSubMeshCount(); i++)
+        {
+            const SubMeshRange &range = data.cache.GetSubMesh(i);
+            if (range.lodLevel != 0)
+                continue;
+            acmrBefore += range.acmrBefore * range.indexCount;
+            acmrAfter += range.acmrAfter * range.indexCount;
+            indexCount += range.indexCount;
+        }
+        if (indexCount > 0)
+        {
+            acmrBefore /= indexCount;
+            acmrAfter /= indexCount;
+        }
+        std::cout << "Modèle " << path << " chargé depuis le cache en " << ms << " ms (ACMR "
+                  << acmrBefore << " -> " << acmrAfter << ")" << std::endl;
+        return true;
+    }
+
     tinyobj::attrib_t attrib;
     std::vector<tinyobj::shape_t> shapes;
     std::vector<tinyobj::material_t> materials;
     std::string warn, err;
 
-    directory = path.substr(0, path.find_last_of('/'));
-
-    bool ret = tinyobj::LoadObj(&attrib, &shapes, &materials, &warn, &err, path.c_str(), directory.c_str(), true);
+    bool ret = ObjParser::Load(path, path.substr(0, path.find_last_of('/')), &attrib, &shapes, &materials, &warn, &err);
 
     if (!warn.empty())
         std::cout << "TinyObjLoader warning: " << warn << std::endl;
@@ -32,26 +353,174 @@ void Model::loadModel(const std::string &path)
     if (!ret)
     {
         std::cerr << "Erreur : échec de chargement du modèle " << path << std::endl;
-        return;
+        return false;
     }
 
+    size_t cornerCount = 0;
+    size_t uniqueCount = 0;
+    float acmrBefore = 0.0f, acmrAfter = 0.0f;
     for (size_t s = 0; s < shapes.size(); s++)
     {
-        meshes.push_back(processMesh(attrib, shapes[s], materials));
+        data.meshes.push_back(processMesh(attrib, shapes[s], materials));
+
+        // Ordre des triangles et des sommets optimisé une fois pour toutes, puis mis en cache
+        MeshData &mesh = data.meshes.back();
+        MeshOptimizer::Optimize(mesh);
+        acmrBefore += mesh.acmrBefore * mesh.indices.size();
+        acmrAfter += mesh.acmrAfter * mesh.indices.size();
+
+        cornerCount += shapes[s].mesh.indices.size();
+        uniqueCount += mesh.vertices.size();
     }
+    if (cornerCount > 0)
+    {
+        acmrBefore /= cornerCount;
+        acmrAfter /= cornerCount;
+    }
+
+    double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    std::cout << "Modèle " << path << " : " << cornerCount << " sommets avant soudure, "
+              << uniqueCount << " après (" << data.meshes.size() << " mesh(es)), importé en " << ms << " ms" << std::endl;
+    std::cout << "Modèle " << path << " : ACMR " << acmrBefore << " -> " << acmrAfter
+              << " (cache de " << MeshOptimizer::CACHE_SIZE << " sommets)" << std::endl;
+
+    // Chaîne de LOD : chaque sous-mesh est suivi de ses versions simplifiées
+    start = std::chrono::steady_clock::now();
+    std::vector<MeshData> withLods;
+    for (MeshData &mesh : data.meshes)
+    {
+        std::vector<MeshData> lods = buildLods(mesh);
+        withLods.push_back(std::move(mesh));
+        for (MeshData &lod : lods)
+        {
+            std::cout << "Modèle " << path << " : LOD" << lod.lodLevel << " " << lod.indices.size() / 3
+                      << " triangles (erreur " << lod.lodError << ")" << std::endl;
+            withLods.push_back(std::move(lod));
+        }
+    }
+    data.meshes = std::move(withLods);
+    ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    std::cout << "Modèle " << path << " : LOD générés en " << ms << " ms" << std::endl;
+
+    if (!MeshCache::Write(path, data.meshes))
+        std::cerr << "Avertissement : impossible d'écrire le cache " << MeshCache::GetCachePath(path) << std::endl;
+    return true;
+}
+
+void Model::upload(LoadedData &data)
+{
+    // Boîte de quantification commune à tous les sous-meshes et LOD : même déquantification,
+    // si bien qu'un tirage groupé couvre tout le modèle
+    AABB quantization;
+    bool firstBounds = true;
+    auto includeBounds = [&](const glm::vec3 &boundsMin, const glm::vec3 &boundsMax)
+    {
+        quantization.min = firstBounds ? boundsMin : glm::min(quantization.min, boundsMin);
+        quantization.max = firstBounds ? boundsMax : glm::max(quantization.max, boundsMax);
+        firstBounds = false;
+    };
+
+    if (data.fromCache)
+    {
+        // Les pointeurs de la projection sont copiés directement dans le GeometryBuffer
+        const MeshCache &cache = data.cache;
+        for (size_t i = 0; i < cache.GetSubMeshCount(); i++)
+            includeBounds(cache.GetSubMesh(i).boundsMin, cache.GetSubMesh(i).boundsMax);
+
+        meshes.reserve(cache.GetSubMeshCount());
+        for (size_t i = 0; i < cache.GetSubMeshCount(); i++)
+        {
+            const SubMeshRange &range = cache.GetSubMesh(i);
+            meshes.emplace_back(cache.GetVertices() + range.vertexOffset, range.vertexCount,
+                                cache.GetIndices() + range.indexOffset, range.indexCount,
+                                range.boundsMin, range.boundsMax, std::vector<Texture>(), format, &quantization);
+            meshes.back().lodLevel = range.lodLevel;
+            meshes.back().lodError = range.lodError;
+        }
+        data.cache.Close();
+    }
+    else
+    {
+        for (const MeshData &mesh : data.meshes)
+            includeBounds(mesh.boundsMin, mesh.boundsMax);
+
+        meshes.reserve(data.meshes.size());
+        for (MeshData &mesh : data.meshes)
+        {
+            mesh.format = format;
+            meshes.emplace_back(std::move(mesh), &quantization);
+        }
+        data.meshes.clear();
+    }
+
+    // Erreur de chaque niveau : la pire parmi les sous-meshes qui le possèdent
+    lodErrors.assign(1, 0.0f);
+    for (const Mesh &mesh : meshes)
+    {
+        if (mesh.lodLevel >= lodErrors.size())
+            lodErrors.resize(mesh.lodLevel + 1, 0.0f);
+        lodErrors[mesh.lodLevel] = std::max(lodErrors[mesh.lodLevel], mesh.lodError);
+    }
+
+    // Sphère englobante autour de l'origine (celle des rotations appliquées aux instances)
+    boundingRadius = 0.0f;
+    for (const Mesh &mesh : meshes)
+    {
+        if (mesh.lodLevel == 0)
+            boundingRadius = std::max(boundingRadius, glm::length(glm::max(glm::abs(mesh.boundsMin), glm::abs(mesh.boundsMax))));
+    }
+    if (boundingRadius <= 0.0f)
+        boundingRadius = 1.0f;
+
+    // Boîte et sphère serrées pour le culling, centrées sur la boîte plutôt que sur l'origine
+    bool firstMesh = true;
+    for (const Mesh &mesh : meshes)
+    {
+        if (mesh.lodLevel != 0)
+            continue;
+        bounds.min = firstMesh ? mesh.boundsMin : glm::min(bounds.min, mesh.boundsMin);
+        bounds.max = firstMesh ? mesh.boundsMax : glm::max(bounds.max, mesh.boundsMax);
+        firstMesh = false;
+    }
+    if (!firstMesh)
+    {
+        boundingSphere.center = bounds.GetCenter();
+        boundingSphere.radius = 0.0f;
+        for (const Mesh &mesh : meshes)
+        {
+            if (mesh.lodLevel == 0)
+                boundingSphere.radius = std::max(boundingSphere.radius,
+                                                 glm::length(glm::max(glm::abs(mesh.boundsMin - boundingSphere.center),
+                                                                      glm::abs(mesh.boundsMax - boundingSphere.center))));
+        }
+    }
+    loaded = true;
 }
 
-Mesh Model::processMesh(const tinyobj::attrib_t &attrib, const tinyobj::shape_t &shape, const std::vector<tinyobj::material_t> &materials)
+MeshData Model::processMesh(const tinyobj::attrib_t &attrib, const tinyobj::shape_t &shape, const std::vector<tinyobj::material_t> &materials)
 {
     std::vector<Vertex> vertices;
     std::vector<unsigned int> indices;
     std::vector<Texture> textures;
 
+    // Soudure des sommets : un même triplet d'indices OBJ ne produit qu'un seul Vertex
+    std::unordered_map<VertexKey, unsigned int, VertexKeyHash> uniqueVertices;
+    uniqueVertices.reserve(shape.mesh.indices.size());
+    indices.reserve(shape.mesh.indices.size());
+
     // Pour chaque face
     for (size_t f = 0; f < shape.mesh.indices.size(); f++)
     {
         tinyobj::index_t idx = shape.mesh.indices[f];
 
+        VertexKey key = {idx.vertex_index, idx.normal_index, idx.texcoord_index};
+        auto found = uniqueVertices.find(key);
+        if (found != uniqueVertices.end())
+        {
+            indices.push_back(found->second);
+            continue;
+        }
+
         Vertex vertex;
 
         vertex.Position = glm::vec3(
@@ -82,11 +551,18 @@ Mesh Model::processMesh(const tinyobj::attrib_t &attrib, const tinyobj::shape_t
             vertex.TexCoords = glm::vec2(0.0f, 0.0f);
         }
 
+        unsigned int newIndex = static_cast<unsigned int>(vertices.size());
+        uniqueVertices.emplace(key, newIndex);
         vertices.push_back(vertex);
-        indices.push_back((unsigned int)f);
+        indices.push_back(newIndex);
     }
 
     // (Optionnel) Chargement des textures associées au matériel (si nécessaire)
 
-    return Mesh(vertices, indices, textures);
+    MeshData data;
+    data.vertices = std::move(vertices);
+    data.indices = std::move(indices);
+    data.textures = std::move(textures);
+    data.ComputeBounds();
+    return data;
 }
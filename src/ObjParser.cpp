@@ -0,0 +1,901 @@
+#include "ObjParser.h"
+#include "MappedFile.h"
+
+#include <algorithm>
+#include <climits>
+#include <cmath>
+#include <cstring>
+#include <functional>
+#include <map>
+#include <set>
+#include <sstream>
+#include <thread>
+
+namespace
+{
+    // En dessous de cette taille par bloc, le coût des threads domine
+    const size_t MIN_CHUNK_SIZE = 256 * 1024;
+
+    // Indice de texture/normale absent de la face ("f 1//2", "f 1")
+    const int ABSENT_INDEX = INT_MIN;
+
+    enum class StatementType
+    {
+        UseMtl,
+        MtlLib,
+        Group,
+        Object,
+        Smoothing
+    };
+
+    // Instruction qui modifie l'état séquentiel du chargeur (groupes, matériaux...)
+    struct Statement
+    {
+        StatementType type;
+        size_t faceIndex;   // faces du bloc qui la précèdent
+        size_t vertexCount; // sommets 'v' du bloc qui la précèdent
+        size_t line;        // numéro de ligne local au bloc
+        unsigned int smoothingId;
+        std::string text;
+    };
+
+    // Face telle qu'écrite dans le fichier, indices non résolus
+    struct RawFace
+    {
+        size_t cornerOffset; // 3 entiers par coin dans Chunk::corners : v, vt, vn
+        unsigned int cornerCount;
+        int vertexCount;   // attributs du bloc déclarés avant la face,
+        int normalCount;   // pour résoudre les indices relatifs
+        int texcoordCount;
+    };
+
+    struct Chunk
+    {
+        const char *begin = nullptr;
+        const char *end = nullptr;
+
+        std::vector<tinyobj::real_t> vertices;
+        std::vector<tinyobj::real_t> weights;
+        std::vector<tinyobj::real_t> colors;
+        std::vector<tinyobj::real_t> normals;
+        std::vector<tinyobj::real_t> texcoords;
+        std::vector<int> corners;
+        std::vector<RawFace> faces;
+        std::vector<Statement> statements;
+        size_t lineCount = 0;
+        bool unsupported = false;
+
+        // Valeurs globales calculées à la fusion
+        size_t vertexBase = 0;
+        size_t normalBase = 0;
+        size_t texcoordBase = 0;
+        size_t lineBase = 0;
+    };
+
+    inline bool isSpace(char c)
+    {
+        return c == ' ' || c == '\t';
+    }
+
+    inline bool isDigit(char c)
+    {
+        return c >= '0' && c <= '9';
+    }
+
+    // Caractère à la position i, '\0' au-delà de la fin de ligne
+    inline char charAt(const char *p, const char *end, size_t i)
+    {
+        return p + i < end ? p[i] : '\0';
+    }
+
+    inline const char *skipSpaces(const char *p, const char *end)
+    {
+        while (p < end && isSpace(*p))
+            p++;
+        return p;
+    }
+
+    inline const char *tokenEnd(const char *p, const char *end)
+    {
+        while (p < end && !isSpace(*p))
+            p++;
+        return p;
+    }
+
+    inline const char *indexEnd(const char *p, const char *end)
+    {
+        while (p < end && *p != '/' && !isSpace(*p))
+            p++;
+        return p;
+    }
+
+    // atoi borné à la ligne
+    int parseInt(const char *p, const char *end)
+    {
+        while (p < end && (isSpace(*p) || *p == '\v' || *p == '\f'))
+            p++;
+        bool negative = false;
+        if (p < end && (*p == '+' || *p == '-'))
+        {
+            negative = *p == '-';
+            p++;
+        }
+        long long value = 0;
+        while (p < end && isDigit(*p))
+        {
+            value = value * 10 + (*p - '0');
+            if (value > INT_MAX)
+                value = INT_MAX;
+            p++;
+        }
+        return static_cast<int>(negative ? -value : value);
+    }
+
+    // Même grammaire et même arithmétique que tinyobj (tryParseDouble) pour
+    // obtenir des flottants identiques au bit près, sans recopier la ligne ni
+    // la parcourir plusieurs fois.
+    bool parseDouble(const char *s, const char *end, double *result)
+    {
+        if (s >= end)
+            return false;
+
+        double mantissa = 0.0;
+        int exponent = 0;
+        char sign = '+';
+        char expSign = '+';
+        const char *curr = s;
+        int read = 0;
+        bool leadingDot = false;
+
+        if (*curr == '+' || *curr == '-')
+        {
+            sign = *curr;
+            curr++;
+            if (curr != end && *curr == '.')
+                leadingDot = true;
+        }
+        else if (*curr == '.')
+        {
+            leadingDot = true;
+        }
+        else if (!isDigit(*curr))
+        {
+            return false;
+        }
+
+        if (!leadingDot)
+        {
+            while (curr != end && isDigit(*curr))
+            {
+                mantissa *= 10;
+                mantissa += static_cast<int>(*curr - '0');
+                curr++;
+                read++;
+            }
+            if (read == 0)
+                return false;
+        }
+
+        if (curr != end && *curr == '.')
+        {
+            static const double powLut[] = {1.0, 0.1, 0.01, 0.001, 0.0001, 0.00001, 0.000001, 0.0000001};
+            const int lutEntries = sizeof powLut / sizeof powLut[0];
+
+            curr++;
+            read = 1;
+            while (curr != end && isDigit(*curr))
+            {
+                mantissa += static_cast<int>(*curr - '0') * (read < lutEntries ? powLut[read] : std::pow(10.0, -read));
+                read++;
+                curr++;
+            }
+        }
+
+        if (curr != end && (*curr == 'e' || *curr == 'E'))
+        {
+            curr++;
+            if (curr != end && (*curr == '+' || *curr == '-'))
+            {
+                expSign = *curr;
+                curr++;
+            }
+            else if (curr == end || !isDigit(*curr))
+            {
+                return false;
+            }
+
+            read = 0;
+            while (curr != end && isDigit(*curr))
+            {
+                if (exponent > INT_MAX / 10)
+                    return false;
+                exponent *= 10;
+                exponent += static_cast<int>(*curr - '0');
+                curr++;
+                read++;
+            }
+            exponent *= (expSign == '+' ? 1 : -1);
+            if (read == 0)
+                return false;
+        }
+
+        *result = (sign == '+' ? 1 : -1) *
+                  (exponent ? std::ldexp(mantissa * std::pow(5.0, exponent), exponent) : mantissa);
+        return true;
+    }
+
+    // Lit un réel et avance au jeton suivant ; false si le jeton n'est pas un nombre
+    inline bool parseReal(const char *&p, const char *end, tinyobj::real_t *out)
+    {
+        p = skipSpaces(p, end);
+        const char *e = tokenEnd(p, end);
+        double value;
+        bool ok = parseDouble(p, e, &value);
+        if (ok)
+            *out = static_cast<tinyobj::real_t>(value);
+        p = e;
+        return ok;
+    }
+
+    inline tinyobj::real_t parseRealOr(const char *&p, const char *end, double defaultValue)
+    {
+        tinyobj::real_t value = static_cast<tinyobj::real_t>(defaultValue);
+        parseReal(p, end, &value);
+        return value;
+    }
+
+    void parseVertex(Chunk &chunk, const char *p, const char *end)
+    {
+        tinyobj::real_t x = parseRealOr(p, end, 0.0);
+        tinyobj::real_t y = parseRealOr(p, end, 0.0);
+        tinyobj::real_t z = parseRealOr(p, end, 0.0);
+
+        // Composante w ou couleur (extension tinyobj), blanc par défaut
+        // (x y z w : r porte w ; x y z r g b : couleur complète)
+        tinyobj::real_t r = 1, g = 1, b = 1;
+        if (parseReal(p, end, &r) && parseReal(p, end, &g) && !parseReal(p, end, &b))
+            r = g = b = 1;
+
+        chunk.vertices.push_back(x);
+        chunk.vertices.push_back(y);
+        chunk.vertices.push_back(z);
+        chunk.weights.push_back(r);
+        chunk.colors.push_back(r);
+        chunk.colors.push_back(g);
+        chunk.colors.push_back(b);
+    }
+
+    void parseFace(Chunk &chunk, const char *p, const char *end)
+    {
+        RawFace face;
+        face.cornerOffset = chunk.corners.size();
+        face.cornerCount = 0;
+        face.vertexCount = static_cast<int>(chunk.vertices.size() / 3);
+        face.normalCount = static_cast<int>(chunk.normals.size() / 3);
+        face.texcoordCount = static_cast<int>(chunk.texcoords.size() / 2);
+
+        p = skipSpaces(p, end);
+        while (p < end && *p != '#')
+        {
+            int v = parseInt(p, end);
+            int vt = ABSENT_INDEX;
+            int vn = ABSENT_INDEX;
+            p = indexEnd(p, end);
+            if (p < end && *p == '/')
+            {
+                p++;
+                if (p < end && *p == '/')
+                {
+                    p++;
+                    vn = parseInt(p, end);
+                    p = indexEnd(p, end);
+                }
+                else
+                {
+                    vt = parseInt(p, end);
+                    p = indexEnd(p, end);
+                    if (p < end && *p == '/')
+                    {
+                        p++;
+                        vn = parseInt(p, end);
+                        p = indexEnd(p, end);
+                    }
+                }
+            }
+
+            // Indice nul : erreur ou avertissement côté tinyobj
+            if (v == 0 || vt == 0 || vn == 0)
+            {
+                chunk.unsupported = true;
+                return;
+            }
+
+            chunk.corners.push_back(v);
+            chunk.corners.push_back(vt);
+            chunk.corners.push_back(vn);
+            face.cornerCount++;
+            p = skipSpaces(p, end);
+        }
+
+        // La triangulation des polygones concaves reste déléguée à tinyobj
+        if (face.cornerCount > 4)
+        {
+            chunk.unsupported = true;
+            return;
+        }
+        chunk.faces.push_back(face);
+    }
+
+    void addStatement(Chunk &chunk, StatementType type, const char *begin, const char *end, unsigned int smoothingId = 0)
+    {
+        Statement statement;
+        statement.type = type;
+        statement.faceIndex = chunk.faces.size();
+        statement.vertexCount = chunk.vertices.size() / 3;
+        statement.line = chunk.lineCount;
+        statement.smoothingId = smoothingId;
+        statement.text.assign(begin, end);
+        chunk.statements.push_back(std::move(statement));
+    }
+
+    void parseLine(Chunk &chunk, const char *line, const char *end)
+    {
+        const char *token = skipSpaces(line, end);
+        if (token == end || *token == '#')
+            return;
+
+        char c0 = token[0];
+        char c1 = charAt(token, end, 1);
+        char c2 = charAt(token, end, 2);
+
+        if (c0 == 'v' && isSpace(c1))
+        {
+            parseVertex(chunk, token + 2, end);
+        }
+        else if (c0 == 'v' && c1 == 'n' && isSpace(c2))
+        {
+            const char *p = token + 3;
+            chunk.normals.push_back(parseRealOr(p, end, 0.0));
+            chunk.normals.push_back(parseRealOr(p, end, 0.0));
+            chunk.normals.push_back(parseRealOr(p, end, 0.0));
+        }
+        else if (c0 == 'v' && c1 == 't' && isSpace(c2))
+        {
+            const char *p = token + 3;
+            chunk.texcoords.push_back(parseRealOr(p, end, 0.0));
+            chunk.texcoords.push_back(parseRealOr(p, end, 0.0));
+        }
+        else if (c0 == 'f' && isSpace(c1))
+        {
+            parseFace(chunk, token + 2, end);
+        }
+        else if ((c0 == 'v' && c1 == 'w' && isSpace(c2)) ||
+                 ((c0 == 'l' || c0 == 'p' || c0 == 't') && isSpace(c1)))
+        {
+            // Poids, lignes, points et tags : rares, laissés à tinyobj
+            chunk.unsupported = true;
+        }
+        else if (end - token >= 6 && std::strncmp(token, "usemtl", 6) == 0)
+        {
+            const char *p = skipSpaces(token + 6, end);
+            addStatement(chunk, StatementType::UseMtl, p, tokenEnd(p, end));
+        }
+        else if (end - token >= 6 && std::strncmp(token, "mtllib", 6) == 0 && isSpace(charAt(token, end, 6)))
+        {
+            addStatement(chunk, StatementType::MtlLib, token + 7, end);
+        }
+        else if (c0 == 'g' && isSpace(c1))
+        {
+            addStatement(chunk, StatementType::Group, token, end);
+        }
+        else if (c0 == 'o' && isSpace(c1))
+        {
+            addStatement(chunk, StatementType::Object, token + 2, end);
+        }
+        else if (c0 == 's' && isSpace(c1))
+        {
+            const char *p = skipSpaces(token + 2, end);
+            if (p == end)
+                return;
+            unsigned int smoothingId = 0;
+            if (!(end - p >= 3 && std::strncmp(p, "off", 3) == 0))
+            {
+                int id = parseInt(p, end);
+                smoothingId = id < 0 ? 0 : static_cast<unsigned int>(id);
+            }
+            addStatement(chunk, StatementType::Smoothing, p, p, smoothingId);
+        }
+        // Instruction inconnue : ignorée, comme tinyobj
+    }
+
+    void parseChunk(Chunk &chunk)
+    {
+        // Réserve grossière : une ligne "v ..." fait une trentaine d'octets
+        size_t estimate = static_cast<size_t>(chunk.end - chunk.begin) / 32;
+        chunk.vertices.reserve(estimate);
+        chunk.corners.reserve(estimate);
+
+        const char *p = chunk.begin;
+        while (p < chunk.end && !chunk.unsupported)
+        {
+            size_t remaining = static_cast<size_t>(chunk.end - p);
+            const char *newline = static_cast<const char *>(std::memchr(p, '\n', remaining));
+            size_t length = newline ? static_cast<size_t>(newline - p) : remaining;
+            const char *next = newline ? newline + 1 : chunk.end;
+            if (length > 0 && p[length - 1] == '\r')
+                length--;
+            chunk.lineCount++;
+
+            // Fin de ligne '\r' seule (ancien format Mac) : découpage différent
+            if (std::memchr(p, '\r', length))
+            {
+                chunk.unsupported = true;
+                break;
+            }
+
+            parseLine(chunk, p, p + length);
+            p = next;
+        }
+    }
+
+    // Conversion d'un indice OBJ (base 1, éventuellement relatif) ; même règle que tinyobj
+    inline bool fixIndex(int index, size_t count, int *out)
+    {
+        if (index == ABSENT_INDEX)
+        {
+            *out = -1;
+            return true;
+        }
+        if (index > 0)
+        {
+            *out = index - 1;
+            return true;
+        }
+        *out = static_cast<int>(count) + index;
+        return *out >= 0;
+    }
+
+    // Reprise de tinyobj::SplitString pour les noms de fichiers mtllib
+    std::vector<std::string> splitString(const std::string &s, char delim, char escape)
+    {
+        std::vector<std::string> elems;
+        std::string token;
+        bool escaping = false;
+        for (char ch : s)
+        {
+            if (escaping)
+            {
+                escaping = false;
+            }
+            else if (ch == escape)
+            {
+                escaping = true;
+                continue;
+            }
+            else if (ch == delim)
+            {
+                if (!token.empty())
+                    elems.push_back(token);
+                token.clear();
+                continue;
+            }
+            token += ch;
+        }
+        elems.push_back(token);
+        return elems;
+    }
+
+    struct PendingFace
+    {
+        size_t cornerOffset;
+        unsigned int cornerCount;
+        unsigned int smoothingId;
+    };
+
+    // État séquentiel de la fusion, calqué sur la boucle de tinyobj::LoadObj
+    class Merger
+    {
+    public:
+        Merger(const std::vector<tinyobj::real_t> &vertices, const std::string &baseDir,
+               std::vector<tinyobj::shape_t> &shapes, std::vector<tinyobj::material_t> &materials,
+               std::string &warn, std::string &err)
+            : vertices(vertices), materialReader(baseDir), shapes(shapes),
+              materials(materials), warn(warn), err(err)
+        {
+        }
+
+        bool addFace(const Chunk &chunk, const RawFace &face)
+        {
+            PendingFace pending;
+            pending.cornerOffset = corners.size();
+            pending.cornerCount = face.cornerCount;
+            pending.smoothingId = smoothingId;
+
+            const int *raw = &chunk.corners[face.cornerOffset];
+            for (unsigned int i = 0; i < face.cornerCount; i++, raw += 3)
+            {
+                tinyobj::index_t index;
+                if (!fixIndex(raw[0], chunk.vertexBase + face.vertexCount, &index.vertex_index) ||
+                    !fixIndex(raw[1], chunk.texcoordBase + face.texcoordCount, &index.texcoord_index) ||
+                    !fixIndex(raw[2], chunk.normalBase + face.normalCount, &index.normal_index))
+                    return false;
+
+                greatestVertex = std::max(greatestVertex, index.vertex_index);
+                greatestNormal = std::max(greatestNormal, index.normal_index);
+                greatestTexcoord = std::max(greatestTexcoord, index.texcoord_index);
+                corners.push_back(index);
+            }
+            faces.push_back(pending);
+            return true;
+        }
+
+        void apply(const Statement &statement, size_t vertexLimit, size_t line)
+        {
+            switch (statement.type)
+            {
+            case StatementType::Smoothing:
+                smoothingId = statement.smoothingId;
+                break;
+
+            case StatementType::UseMtl:
+            {
+                int newMaterial = -1;
+                std::map<std::string, int>::const_iterator it = materialMap.find(statement.text);
+                if (it != materialMap.end())
+                    newMaterial = it->second;
+                else
+                    warn += "material [ '" + statement.text + "' ] not found in .mtl\n";
+
+                if (newMaterial != material)
+                {
+                    exportFaces(vertexLimit);
+                    material = newMaterial;
+                }
+                break;
+            }
+
+            case StatementType::MtlLib:
+                loadMaterials(statement.text, line);
+                break;
+
+            case StatementType::Group:
+            {
+                exportFaces(vertexLimit);
+                flushShape();
+
+                std::vector<std::string> names;
+                const char *p = statement.text.c_str();
+                const char *end = p + statement.text.size();
+                while (p < end && *p != '#')
+                {
+                    p = skipSpaces(p, end);
+                    const char *e = tokenEnd(p, end);
+                    names.push_back(std::string(p, e));
+                    p = skipSpaces(e, end);
+                }
+
+                if (names.size() < 2)
+                {
+                    std::stringstream ss;
+                    ss << "Empty group name. line: " << line << "\n";
+                    warn += ss.str();
+                    name = "";
+                }
+                else
+                {
+                    name = names[1];
+                    for (size_t i = 2; i < names.size(); i++)
+                        name += " " + names[i];
+                }
+                break;
+            }
+
+            case StatementType::Object:
+                exportFaces(vertexLimit);
+                flushShape();
+                name = statement.text;
+                break;
+            }
+        }
+
+        void finish(size_t vertexLimit, size_t normalCount, size_t texcoordCount, size_t lineCount)
+        {
+            if (greatestVertex >= static_cast<int>(vertexLimit))
+            {
+                std::stringstream ss;
+                ss << "Vertex indices out of bounds (line " << lineCount << ".)\n\n";
+                warn += ss.str();
+            }
+            if (greatestNormal >= static_cast<int>(normalCount))
+            {
+                std::stringstream ss;
+                ss << "Vertex normal indices out of bounds (line " << lineCount << ".)\n\n";
+                warn += ss.str();
+            }
+            if (greatestTexcoord >= static_cast<int>(texcoordCount))
+            {
+                std::stringstream ss;
+                ss << "Vertex texcoord indices out of bounds (line " << lineCount << ".)\n\n";
+                warn += ss.str();
+            }
+
+            // Comme tinyobj, une forme est conservée dès qu'un groupe de faces était ouvert
+            bool exported = exportFaces(vertexLimit);
+            if (exported || !shape.mesh.indices.empty())
+                shapes.push_back(shape);
+        }
+
+    private:
+        const std::vector<tinyobj::real_t> &vertices;
+        tinyobj::MaterialFileReader materialReader;
+        std::vector<tinyobj::shape_t> &shapes;
+        std::vector<tinyobj::material_t> &materials;
+        std::string &warn;
+        std::string &err;
+
+        tinyobj::shape_t shape;
+        std::vector<tinyobj::index_t> corners;
+        std::vector<PendingFace> faces;
+        std::string name;
+        int material = -1;
+        unsigned int smoothingId = 0;
+        std::map<std::string, int> materialMap;
+        std::set<std::string> materialFiles;
+        int greatestVertex = -1;
+        int greatestNormal = -1;
+        int greatestTexcoord = -1;
+
+        void pushFace(const tinyobj::index_t &a, const tinyobj::index_t &b, const tinyobj::index_t &c, unsigned int smoothing)
+        {
+            shape.mesh.indices.push_back(a);
+            shape.mesh.indices.push_back(b);
+            shape.mesh.indices.push_back(c);
+            shape.mesh.num_face_vertices.push_back(3);
+            shape.mesh.material_ids.push_back(material);
+            shape.mesh.smoothing_group_ids.push_back(smoothing);
+        }
+
+        // Équivalent de exportGroupsToShape : triangule les faces en attente dans la forme courante.
+        // vertexLimit est le nombre de sommets lus au moment de l'export (contrôle des quads).
+        bool exportFaces(size_t vertexLimit)
+        {
+            if (faces.empty())
+                return false;
+
+            shape.name = name;
+            for (const PendingFace &face : faces)
+            {
+                const tinyobj::index_t *c = &corners[face.cornerOffset];
+                if (face.cornerCount < 3)
+                {
+                    warn += "Degenerated face found\n.";
+                    continue;
+                }
+                if (face.cornerCount == 3)
+                {
+                    pushFace(c[0], c[1], c[2], face.smoothingId);
+                    continue;
+                }
+
+                size_t vi0 = size_t(c[0].vertex_index);
+                size_t vi1 = size_t(c[1].vertex_index);
+                size_t vi2 = size_t(c[2].vertex_index);
+                size_t vi3 = size_t(c[3].vertex_index);
+                if (vi0 >= vertexLimit || vi1 >= vertexLimit || vi2 >= vertexLimit || vi3 >= vertexLimit)
+                {
+                    warn += "Face with invalid vertex index found.\n";
+                    continue;
+                }
+
+                // Coupe le quad selon sa diagonale la plus courte
+                tinyobj::real_t e02x = vertices[vi2 * 3 + 0] - vertices[vi0 * 3 + 0];
+                tinyobj::real_t e02y = vertices[vi2 * 3 + 1] - vertices[vi0 * 3 + 1];
+                tinyobj::real_t e02z = vertices[vi2 * 3 + 2] - vertices[vi0 * 3 + 2];
+                tinyobj::real_t e13x = vertices[vi3 * 3 + 0] - vertices[vi1 * 3 + 0];
+                tinyobj::real_t e13y = vertices[vi3 * 3 + 1] - vertices[vi1 * 3 + 1];
+                tinyobj::real_t e13z = vertices[vi3 * 3 + 2] - vertices[vi1 * 3 + 2];
+                tinyobj::real_t sqr02 = e02x * e02x + e02y * e02y + e02z * e02z;
+                tinyobj::real_t sqr13 = e13x * e13x + e13y * e13y + e13z * e13z;
+
+                if (sqr02 < sqr13)
+                {
+                    pushFace(c[0], c[1], c[2], face.smoothingId);
+                    pushFace(c[0], c[2], c[3], face.smoothingId);
+                }
+                else
+                {
+                    pushFace(c[0], c[1], c[3], face.smoothingId);
+                    pushFace(c[1], c[2], c[3], face.smoothingId);
+                }
+            }
+
+            faces.clear();
+            corners.clear();
+            return true;
+        }
+
+        void flushShape()
+        {
+            if (!shape.mesh.indices.empty())
+                shapes.push_back(shape);
+            shape = tinyobj::shape_t();
+            faces.clear();
+            corners.clear();
+        }
+
+        void loadMaterials(const std::string &text, size_t line)
+        {
+            std::vector<std::string> filenames = splitString(text, ' ', '\\');
+            if (filenames.empty())
+            {
+                std::stringstream ss;
+                ss << "Looks like empty filename for mtllib. Use default material (line " << line << ".)\n";
+                warn += ss.str();
+                return;
+            }
+
+            bool found = false;
+            for (const std::string &filename : filenames)
+            {
+                if (materialFiles.count(filename) > 0)
+                {
+                    found = true;
+                    continue;
+                }
+
+                std::string warnMtl, errMtl;
+                bool ok = materialReader(filename, &materials, &materialMap, &warnMtl, &errMtl);
+                warn += warnMtl;
+                err += errMtl;
+                if (ok)
+                {
+                    found = true;
+                    materialFiles.insert(filename);
+                    break;
+                }
+            }
+
+            if (!found)
+                warn += "Failed to load material file(s). Use default material.\n";
+        }
+    };
+
+    std::string materialBaseDir(const std::string &mtlBaseDir)
+    {
+        std::string baseDir = mtlBaseDir;
+#ifndef _WIN32
+        const char separator = '/';
+#else
+        const char separator = '\\';
+#endif
+        if (!baseDir.empty() && baseDir.back() != separator)
+            baseDir += separator;
+        return baseDir;
+    }
+
+    // Chemin rapide ; false si le fichier demande le repli sur tinyobj
+    bool loadParallel(const MappedFile &file, const std::string &mtlBaseDir, unsigned threadCount,
+                      tinyobj::attrib_t &attrib, std::vector<tinyobj::shape_t> &shapes,
+                      std::vector<tinyobj::material_t> &materials, std::string &warn, std::string &err)
+    {
+        const char *data = reinterpret_cast<const char *>(file.Data());
+        const size_t size = file.Size();
+
+        // Découpage en blocs alignés sur les fins de ligne
+        size_t chunkCount = std::max<size_t>(1, std::min<size_t>(threadCount, size / MIN_CHUNK_SIZE));
+        std::vector<Chunk> chunks(chunkCount);
+        const char *cursor = data;
+        for (size_t i = 0; i < chunkCount; i++)
+        {
+            const char *target = data + size * (i + 1) / chunkCount;
+            if (target < cursor)
+                target = cursor;
+            if (i + 1 < chunkCount && target < data + size)
+            {
+                size_t remaining = static_cast<size_t>(data + size - target);
+                const char *newline = static_cast<const char *>(std::memchr(target, '\n', remaining));
+                target = newline ? newline + 1 : data + size;
+            }
+            else
+            {
+                target = data + size;
+            }
+            chunks[i].begin = cursor;
+            chunks[i].end = target;
+            cursor = target;
+        }
+
+        std::vector<std::thread> workers;
+        for (size_t i = 1; i < chunkCount; i++)
+            workers.emplace_back(parseChunk, std::ref(chunks[i]));
+        parseChunk(chunks[0]);
+        for (std::thread &worker : workers)
+            worker.join();
+
+        size_t vertexCount = 0, normalCount = 0, texcoordCount = 0, lineCount = 0;
+        for (Chunk &chunk : chunks)
+        {
+            if (chunk.unsupported)
+                return false;
+            chunk.vertexBase = vertexCount;
+            chunk.normalBase = normalCount;
+            chunk.texcoordBase = texcoordCount;
+            chunk.lineBase = lineCount;
+            vertexCount += chunk.vertices.size() / 3;
+            normalCount += chunk.normals.size() / 3;
+            texcoordCount += chunk.texcoords.size() / 2;
+            lineCount += chunk.lineCount;
+        }
+
+        // Concaténation des attributs dans l'ordre du fichier
+        attrib.vertices.resize(vertexCount * 3);
+        attrib.vertex_weights.resize(vertexCount);
+        attrib.colors.resize(vertexCount * 3);
+        attrib.normals.resize(normalCount * 3);
+        attrib.texcoords.resize(texcoordCount * 2);
+        for (const Chunk &chunk : chunks)
+        {
+            std::copy(chunk.vertices.begin(), chunk.vertices.end(), attrib.vertices.begin() + chunk.vertexBase * 3);
+            std::copy(chunk.weights.begin(), chunk.weights.end(), attrib.vertex_weights.begin() + chunk.vertexBase);
+            std::copy(chunk.colors.begin(), chunk.colors.end(), attrib.colors.begin() + chunk.vertexBase * 3);
+            std::copy(chunk.normals.begin(), chunk.normals.end(), attrib.normals.begin() + chunk.normalBase * 3);
+            std::copy(chunk.texcoords.begin(), chunk.texcoords.end(), attrib.texcoords.begin() + chunk.texcoordBase * 2);
+        }
+
+        // Rejoue les faces et instructions dans l'ordre pour construire les formes
+        Merger merger(attrib.vertices, materialBaseDir(mtlBaseDir), shapes, materials, warn, err);
+        for (const Chunk &chunk : chunks)
+        {
+            size_t f = 0;
+            for (const Statement &statement : chunk.statements)
+            {
+                for (; f < statement.faceIndex; f++)
+                {
+                    if (!merger.addFace(chunk, chunk.faces[f]))
+                        return false;
+                }
+                merger.apply(statement, chunk.vertexBase + statement.vertexCount, chunk.lineBase + statement.line);
+            }
+            for (; f < chunk.faces.size(); f++)
+            {
+                if (!merger.addFace(chunk, chunk.faces[f]))
+                    return false;
+            }
+        }
+        merger.finish(vertexCount, normalCount, texcoordCount, lineCount);
+        return true;
+    }
+}
+
+bool ObjParser::Load(const std::string &path, const std::string &mtlBaseDir,
+                     tinyobj::attrib_t *attrib, std::vector<tinyobj::shape_t> *shapes,
+                     std::vector<tinyobj::material_t> *materials,
+                     std::string *warn, std::string *err, unsigned threadCount)
+{
+    if (threadCount == 0)
+        threadCount = std::max(1u, std::thread::hardware_concurrency());
+
+    MappedFile file;
+    if (file.Open(path))
+    {
+        tinyobj::attrib_t parsedAttrib;
+        std::vector<tinyobj::shape_t> parsedShapes;
+        std::vector<tinyobj::material_t> parsedMaterials;
+        std::string parsedWarn, parsedErr;
+
+        if (loadParallel(file, mtlBaseDir, threadCount, parsedAttrib, parsedShapes, parsedMaterials, parsedWarn, parsedErr))
+        {
+            *attrib = std::move(parsedAttrib);
+            *shapes = std::move(parsedShapes);
+            materials->insert(materials->end(), parsedMaterials.begin(), parsedMaterials.end());
+            if (warn)
+                *warn += parsedWarn;
+            if (err)
+                *err += parsedErr;
+            return true;
+        }
+    }
+
+    // Fichier vide, illisible ou hors du sous-ensemble géré : chargeur de référence
+    return tinyobj::LoadObj(attrib, shapes, materials, warn, err, path.c_str(), mtlBaseDir.c_str(), true);
+}
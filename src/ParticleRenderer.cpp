@@ -0,0 +1,67 @@
+#include "ParticleRenderer.h"
+
+ParticleRenderer::~ParticleRenderer() {
+    if (vao != 0) {
+        glDeleteVertexArrays(1, &vao);
+        glDeleteBuffers(1, &quadVBO);
+        glDeleteBuffers(1, &particleVBO);
+    }
+}
+
+void ParticleRenderer::CreateBuffers() {
+    // Coins du quad en triangle strip, dans [-1, 1]
+    const float corners[] = {
+        -1.0f, -1.0f,
+         1.0f, -1.0f,
+        -1.0f,  1.0f,
+         1.0f,  1.0f
+    };
+
+    glGenVertexArrays(1, &vao);
+    glGenBuffers(1, &quadVBO);
+    glGenBuffers(1, &particleVBO);
+
+    glBindVertexArray(vao);
+
+    glBindBuffer(GL_ARRAY_BUFFER, quadVBO);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(corners), corners, GL_STATIC_DRAW);
+    glEnableVertexAttribArray(0);
+    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 2 * sizeof(float), (void*)0);
+
+    // Une particule par instance
+    glBindBuffer(GL_ARRAY_BUFFER, particleVBO);
+    glEnableVertexAttribArray(1);
+    glVertexAttribPointer(1, 4, GL_FLOAT, GL_FALSE, sizeof(glm::vec4), (void*)0);
+    glVertexAttribDivisor(1, 1);
+
+    glBindVertexArray(0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+}
+
+void ParticleRenderer::Update(const glm::vec4* particles, size_t particleCount) {
+    if (vao == 0) {
+        CreateBuffers();
+    }
+    glBindBuffer(GL_ARRAY_BUFFER, particleVBO);
+
+    // Même stratégie que InstanceBuffer : orphelinage puis écriture
+    if (particleCount > capacity) {
+        capacity = particleCount > capacity * 2 ? particleCount : capacity * 2;
+    }
+    glBufferData(GL_ARRAY_BUFFER, capacity * sizeof(glm::vec4), nullptr, GL_STREAM_DRAW);
+    if (particleCount > 0) {
+        glBufferSubData(GL_ARRAY_BUFFER, 0, particleCount * sizeof(glm::vec4), particles);
+    }
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+    count = particleCount;
+}
+
+void ParticleRenderer::Draw() const {
+    if (vao == 0 || count == 0) {
+        return;
+    }
+    glBindVertexArray(vao);
+    glDrawArraysInstanced(GL_TRIANGLE_STRIP, 0, 4, static_cast<GLsizei>(count));
+    glBindVertexArray(0);
+}
@@ -0,0 +1,169 @@
+#include "ProgramCache.h"
+#include "Hash.h"
+#include "MappedFile.h"
+
+#include <GL/glew.h>
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <vector>
+
+namespace
+{
+    const char MAGIC[4] = {'P', 'R', 'G', 'B'};
+    const char *CACHE_DIRECTORY = "shadercache";
+
+    struct CacheHeader
+    {
+        char magic[4];
+        uint32_t version;
+        uint64_t key;
+        uint32_t format;
+        uint32_t length;
+    };
+
+    // Formats acceptés par glProgramBinary (liste vide sans l'extension)
+    const std::vector<GLint> &binaryFormats()
+    {
+        static const std::vector<GLint> formats = [] {
+            std::vector<GLint> result;
+            if (!GLEW_VERSION_4_1 && !GLEW_ARB_get_program_binary)
+                return result;
+
+            GLint count = 0;
+            glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &count);
+            if (count > 0)
+            {
+                result.resize(count);
+                glGetIntegerv(GL_PROGRAM_BINARY_FORMATS, result.data());
+            }
+            return result;
+        }();
+        return formats;
+    }
+
+    // Empreinte du pilote, calculée une fois par exécution
+    uint64_t driverHash()
+    {
+        static const uint64_t hash = [] {
+            uint64_t result = Hash::FNV64_OFFSET;
+            for (GLenum name : {GL_VENDOR, GL_RENDERER, GL_VERSION})
+            {
+                const char *text = reinterpret_cast<const char *>(glGetString(name));
+                if (text)
+                    result = Hash::Fnv1a64(text, std::strlen(text) + 1, result);
+            }
+            const std::vector<GLint> &formats = binaryFormats();
+            return Hash::Fnv1a64(formats.data(), formats.size() * sizeof(GLint), result);
+        }();
+        return hash;
+    }
+}
+
+bool ProgramCache::IsSupported()
+{
+    return !binaryFormats().empty();
+}
+
+uint64_t ProgramCache::MakeKey(const std::string &vertexCode, const std::string &fragmentCode)
+{
+    // Longueur du vertex shader incluse pour que la frontière entre les deux sources compte
+    uint64_t vertexLength = vertexCode.size();
+    uint64_t key = Hash::Fnv1a64(&vertexLength, sizeof(vertexLength), driverHash());
+    key = Hash::Fnv1a64(vertexCode.data(), vertexCode.size(), key);
+    return Hash::Fnv1a64(fragmentCode.data(), fragmentCode.size(), key);
+}
+
+std::string ProgramCache::GetCachePath(uint64_t key)
+{
+    char name[32];
+    std::snprintf(name, sizeof(name), "%016llx.bin", static_cast<unsigned long long>(key));
+    return (std::filesystem::path(CACHE_DIRECTORY) / name).string();
+}
+
+bool ProgramCache::Load(uint64_t key, unsigned int program)
+{
+    MappedFile file;
+    if (!IsSupported() || !file.Open(GetCachePath(key)))
+        return false;
+
+    if (file.Size() < sizeof(CacheHeader))
+        return false;
+
+    CacheHeader header;
+    std::memcpy(&header, file.Data(), sizeof(header));
+    if (std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0 ||
+        header.version != VERSION ||
+        header.key != key ||
+        sizeof(CacheHeader) + uint64_t(header.length) > file.Size())
+    {
+        std::cerr << "ProgramCache: cache corrompu " << GetCachePath(key) << std::endl;
+        return false;
+    }
+
+    // Un format inconnu provoquerait GL_INVALID_ENUM : le vérifier avant glProgramBinary
+    const std::vector<GLint> &formats = binaryFormats();
+    if (std::find(formats.begin(), formats.end(), static_cast<GLint>(header.format)) == formats.end())
+        return false;
+
+    glProgramBinary(program, header.format, file.Data() + sizeof(CacheHeader), static_cast<GLsizei>(header.length));
+
+    GLint success = 0;
+    glGetProgramiv(program, GL_LINK_STATUS, &success);
+    if (!success)
+    {
+        std::cout << "ProgramCache: binaire refusé par le pilote, recompilation depuis les sources" << std::endl;
+        return false;
+    }
+    return true;
+}
+
+bool ProgramCache::Store(uint64_t key, unsigned int program)
+{
+    if (!IsSupported())
+        return false;
+
+    GLint length = 0;
+    glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &length);
+    if (length <= 0)
+        return false;
+
+    std::vector<char> binary(length);
+    GLenum format = 0;
+    glGetProgramBinary(program, length, &length, &format, binary.data());
+
+    CacheHeader header;
+    std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+    header.version = VERSION;
+    header.key = key;
+    header.format = format;
+    header.length = static_cast<uint32_t>(length);
+
+    std::error_code ec;
+    std::filesystem::create_directories(CACHE_DIRECTORY, ec);
+
+    // Écriture dans un fichier temporaire puis renommage, comme MeshCache
+    std::string cachePath = GetCachePath(key);
+    std::string tempPath = cachePath + ".tmp";
+    {
+        std::ofstream out(tempPath, std::ios::binary | std::ios::trunc);
+        if (!out)
+            return false;
+        out.write(reinterpret_cast<const char *>(&header), sizeof(header));
+        out.write(binary.data(), length);
+        if (!out)
+            return false;
+    }
+
+    std::filesystem::remove(cachePath, ec);
+    std::filesystem::rename(tempPath, cachePath, ec);
+    if (ec)
+    {
+        std::filesystem::remove(tempPath, ec);
+        return false;
+    }
+    return true;
+}
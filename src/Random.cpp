@@ -0,0 +1,113 @@
+#include "Random.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+
+namespace {
+    std::atomic<uint64_t> globalSeed{Random::DEFAULT_SEED};
+
+    // SplitMix64 : étale une graine de 64 bits sur l'état de xoshiro
+    uint64_t splitMix64(uint64_t& x) {
+        uint64_t z = (x += 0x9E3779B97F4A7C15ull);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+        return z ^ (z >> 31);
+    }
+
+    // FNV-1a 64 bits du nom d'un flux
+    uint64_t hashName(const char* name) {
+        uint64_t hash = 0xCBF29CE484222325ull;
+        for (const char* c = name; *c != '\0'; ++c) {
+            hash ^= static_cast<unsigned char>(*c);
+            hash *= 0x100000001B3ull;
+        }
+        return hash;
+    }
+
+    uint64_t rotl(uint64_t x, int k) {
+        return (x << k) | (x >> (64 - k));
+    }
+
+    const float TWO_PI = 6.28318530717958647692f;
+}
+
+Random::Random(uint64_t seed) {
+    for (uint64_t& word : state) {
+        word = splitMix64(seed);
+    }
+}
+
+Random Random::ForStream(const char* name) {
+    return Random(GetGlobalSeed() ^ hashName(name));
+}
+
+void Random::SetGlobalSeed(uint64_t seed) {
+    globalSeed = seed;
+}
+
+uint64_t Random::GetGlobalSeed() {
+    return globalSeed.load();
+}
+
+uint64_t Random::Next() {
+    const uint64_t result = rotl(state[1] * 5, 7) * 9;
+    const uint64_t t = state[1] << 17;
+
+    state[2] ^= state[0];
+    state[3] ^= state[1];
+    state[1] ^= state[2];
+    state[0] ^= state[3];
+    state[2] ^= t;
+    state[3] = rotl(state[3], 45);
+
+    return result;
+}
+
+int Random::UniformInt(int bound) {
+    // Multiplication-décalage de Lemire sur les 32 bits de poids fort : pas de division,
+    // biais inférieur à bound / 2^32
+    uint64_t high = Next() >> 32;
+    return static_cast<int>((high * static_cast<uint32_t>(bound)) >> 32);
+}
+
+float Random::Uniform() {
+    // 24 bits de poids fort : tous les flottants de [0, 1) au pas de 2^-24
+    return static_cast<float>(Next() >> 40) * (1.0f / 16777216.0f);
+}
+
+float Random::Uniform(float min, float max) {
+    return min + (max - min) * Uniform();
+}
+
+glm::vec3 Random::OnSphere() {
+    // Hauteur uniforme et azimut uniforme : densité uniforme sur la sphère (Archimède)
+    float z = Uniform(-1.0f, 1.0f);
+    float azimuth = Uniform(0.0f, TWO_PI);
+    float ring = std::sqrt(std::max(0.0f, 1.0f - z * z));
+    return glm::vec3(ring * std::cos(azimuth), ring * std::sin(azimuth), z);
+}
+
+glm::vec3 Random::InSphere(float radius) {
+    // Rayon en racine cubique : autant de points par unité de volume au centre qu'au bord
+    glm::vec3 direction = OnSphere();
+    return direction * (radius * std::cbrt(Uniform()));
+}
+
+void Random::FillUniform(float* values, size_t count, float min, float max) {
+    for (size_t i = 0; i < count; ++i) {
+        values[i] = Uniform(min, max);
+    }
+}
+
+void Random::FillOnSphere(glm::vec3* points, size_t count, float radius) {
+    for (size_t i = 0; i < count; ++i) {
+        points[i] = OnSphere() * radius;
+    }
+}
+
+void Random::FillInSphere(glm::vec3* points, size_t count, float radius) {
+    for (size_t i = 0; i < count; ++i) {
+        points[i] = InSphere(radius);
+    }
+}
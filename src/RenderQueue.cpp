@@ -0,0 +1,198 @@
+#include "RenderQueue.h"
+#include "UBO.h"
+#include "GeometryBuffer.h"
+
+#include <algorithm>
+
+namespace {
+    // Deux paquets consécutifs peuvent partager un tirage groupé : même état et même transformation
+    bool canMerge(const DrawPacket& previous, const DrawPacket& packet) {
+        return packet.shader == previous.shader &&
+               packet.mesh->VAO == previous.mesh->VAO &&
+               packet.mesh->HasSameTextures(*previous.mesh) &&
+               packet.mesh->HasSameDecoding(*previous.mesh) &&
+               packet.hasColor == previous.hasColor &&
+               (!packet.hasColor || packet.color == previous.color) &&
+               packet.model == previous.model;
+    }
+
+    // Les textures liées (celles de bound, aucune si nullptr) sont déjà celles de mesh
+    bool hasTextures(const Mesh* bound, const Mesh& mesh) {
+        return bound ? mesh.HasSameTextures(*bound) : mesh.textures.empty();
+    }
+}
+
+RenderQueue& RenderQueue::getInstance() {
+    static RenderQueue instance;
+    return instance;
+}
+
+void RenderQueue::Begin(const glm::vec3& cameraPos) {
+    packets.clear();
+    programs.clear();
+    viewPos = cameraPos;
+}
+
+void RenderQueue::Submit(const DrawPacket& packet) {
+    if (!packet.shader || !packet.mesh) return;
+    packets.push_back(packet);
+}
+
+uint32_t RenderQueue::GetProgramIndex(const Shader* shader) {
+    // Quelques programmes par frame : une recherche linéaire suffit
+    for (size_t i = 0; i < programs.size(); ++i) {
+        if (programs[i] == shader) {
+            return static_cast<uint32_t>(i);
+        }
+    }
+    programs.push_back(shader);
+    return static_cast<uint32_t>(programs.size() - 1);
+}
+
+uint64_t RenderQueue::MakeKey(const DrawPacket& packet) {
+    float distance = glm::length(glm::vec3(packet.model[3]) - viewPos);
+    uint64_t depth = static_cast<uint64_t>(std::min(distance / MAX_DEPTH, 1.0f) * 0xFFFFF);
+
+    return (static_cast<uint64_t>(packet.pass & 0xF) << 60) |
+           (static_cast<uint64_t>(GetProgramIndex(packet.shader) & 0xFF) << 52) |
+           (static_cast<uint64_t>(packet.mesh->VAO & 0xFFFF) << 36) |
+           (static_cast<uint64_t>(packet.mesh->GetTextureKey() & 0xFFFF) << 20) |
+           depth;
+}
+
+void RenderQueue::RadixSort(std::vector<SortEntry>& entries, std::vector<SortEntry>& scratch) {
+    // Tri par base stable, un octet de la clé par passe (poids faibles d'abord)
+    scratch.resize(entries.size());
+    for (int shift = 0; shift < 64; shift += 8) {
+        size_t offsets[256] = {};
+        for (const SortEntry& entry : entries) {
+            offsets[(entry.key >> shift) & 0xFF]++;
+        }
+
+        // Octet identique pour toutes les clés (programme, passe...) : rien à trier
+        if (offsets[(entries[0].key >> shift) & 0xFF] == entries.size()) {
+            continue;
+        }
+
+        size_t total = 0;
+        for (size_t& offset : offsets) {
+            size_t count = offset;
+            offset = total;
+            total += count;
+        }
+        for (const SortEntry& entry : entries) {
+            scratch[offsets[(entry.key >> shift) & 0xFF]++] = entry;
+        }
+        entries.swap(scratch);
+    }
+}
+
+void RenderQueue::CountUnsortedStateChanges() {
+    const Shader* shader = nullptr;
+    unsigned int vao = 0;
+    const Mesh* textureMesh = nullptr;
+    for (const DrawPacket& packet : packets) {
+        if (packet.shader != shader) {
+            // Comme à l'exécution, un changement de programme oblige à relier les textures
+            shader = packet.shader;
+            textureMesh = nullptr;
+            stats.unsortedProgramChanges++;
+        }
+        if (packet.mesh->VAO != vao) {
+            vao = packet.mesh->VAO;
+            stats.unsortedVaoChanges++;
+        }
+        if (!hasTextures(textureMesh, *packet.mesh)) {
+            textureMesh = packet.mesh;
+            stats.unsortedTextureChanges++;
+        }
+    }
+}
+
+void RenderQueue::FlushBatch() {
+    if (batch.empty()) return;
+
+    if (g_uboManager) {
+        g_uboManager->UpdateTransformUBO(batchModel);
+    }
+    GeometryBuffer::getInstance().Draw(batch.data(), batch.size());
+    stats.drawCalls++;
+    batch.clear();
+}
+
+void RenderQueue::Execute() {
+    stats = RenderQueueStats();
+    stats.draws = packets.size();
+    if (packets.empty()) return;
+
+    CountUnsortedStateChanges();
+
+    entries.resize(packets.size());
+    for (size_t i = 0; i < packets.size(); ++i) {
+        entries[i].key = MakeKey(packets[i]);
+        entries[i].index = static_cast<uint32_t>(i);
+    }
+    RadixSort(entries, scratch);
+
+    static constexpr UniformName OBJECT_COLOR("objectColor");
+
+    const Shader* currentShader = nullptr;
+    UniformHandle<glm::vec3> colorUniform;
+    const Mesh* currentMesh = nullptr;
+    unsigned int currentVAO = 0;
+    const Mesh* textureMesh = nullptr;   // Dernier mesh dont les textures ont été liées
+    glm::vec3 currentColor(0.0f);
+    bool colorSet = false;
+    const DrawPacket* previous = nullptr;
+
+    for (const SortEntry& entry : entries) {
+        const DrawPacket& packet = packets[entry.index];
+        const Mesh& mesh = *packet.mesh;
+
+        // Sous-meshes d'un même objet : une commande de plus dans le tirage en cours
+        if (previous && canMerge(*previous, packet)) {
+            batch.push_back(mesh.GetDrawCommand());
+            continue;
+        }
+        FlushBatch();
+        previous = &packet;
+
+        if (packet.shader != currentShader) {
+            // Les uniforms sont propres au programme : tout est à renvoyer
+            packet.shader->use();
+            currentShader = packet.shader;
+            colorUniform = currentShader->GetUniform<glm::vec3>(OBJECT_COLOR);
+            currentMesh = nullptr;
+            textureMesh = nullptr;
+            colorSet = false;
+            stats.programChanges++;
+        }
+        if (mesh.VAO != currentVAO) {
+            glBindVertexArray(mesh.VAO);
+            currentVAO = mesh.VAO;
+            stats.vaoChanges++;
+        }
+        if (&mesh != currentMesh) {
+            mesh.SetPositionDecoding(*currentShader);
+            currentMesh = &mesh;
+        }
+        if (!hasTextures(textureMesh, mesh)) {
+            mesh.BindTextures(*currentShader);
+            textureMesh = &mesh;
+            stats.textureChanges++;
+        }
+        if (packet.hasColor && (!colorSet || packet.color != currentColor)) {
+            currentShader->set(colorUniform, packet.color);
+            currentColor = packet.color;
+            colorSet = true;
+        }
+
+        batchModel = packet.model;
+        batch.push_back(mesh.GetDrawCommand());
+    }
+    FlushBatch();
+
+    glBindVertexArray(0);
+    glActiveTexture(GL_TEXTURE0);
+    packets.clear();
+}
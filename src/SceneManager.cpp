@@ -43,6 +43,7 @@ void SceneManager::AddScene(std::unique_ptr<Scene> scene) {
 }
 
 void SceneManager::NextScene() {
+    std::lock_guard<std::mutex> lock(sceneMutex);
     if (scenes.empty()) return;
 
     // Désactiver la scène actuelle
@@ -59,6 +60,7 @@ void SceneManager::NextScene() {
 }
 
 void SceneManager::PreviousScene() {
+    std::lock_guard<std::mutex> lock(sceneMutex);
     if (scenes.empty()) return;
 
     // Désactiver la scène actuelle
@@ -75,6 +77,7 @@ void SceneManager::PreviousScene() {
 }
 
 bool SceneManager::SetCurrentScene(int index) {
+    std::lock_guard<std::mutex> lock(sceneMutex);
     if (index < 0 || index >= static_cast<int>(scenes.size())) {
         std::cerr << "Erreur : index de scène invalide " << index << std::endl;
         return false;
@@ -104,6 +107,18 @@ void SceneManager::Update(float deltaTime, GLFWwindow* window, Camera& camera, S
     scenes[currentSceneIndex]->Update(deltaTime, window, camera, soundManager);
 }
 
+void SceneManager::Simulate(float deltaTime, double time) {
+    std::lock_guard<std::mutex> lock(sceneMutex);
+    if (!initialized || currentSceneIndex < 0 || currentSceneIndex >= static_cast<int>(scenes.size())) {
+        return;
+    }
+
+    Scene* scene = scenes[currentSceneIndex].get();
+    if (scene->HasFixedStepSimulation()) {
+        scene->Simulate(deltaTime, time);
+    }
+}
+
 void SceneManager::Render(Camera& camera, int screenWidth, int screenHeight) {
     if (!initialized || currentSceneIndex < 0 || currentSceneIndex >= static_cast<int>(scenes.size())) {
         return;
@@ -147,6 +162,7 @@ bool SceneManager::IsInitialized() const {
 }
 
 void SceneManager::Cleanup() {
+    std::lock_guard<std::mutex> lock(sceneMutex);
     if (initialized) {
         // Désactiver la scène actuelle
         if (currentSceneIndex >= 0 && currentSceneIndex < static_cast<int>(scenes.size())) {
@@ -1,12 +1,38 @@
 #include "Shader.h"
 #include "UBO.h"
+#include "ProgramCache.h"
 
 #include <gl/glew.h>
 #include <glm/glm.hpp>
+#include <cstring>
 #include <fstream>
 #include <sstream>
 #include <iostream>
 
+namespace
+{
+    // Compile une étape ; les erreurs sont affichées avec son nom
+    unsigned int compileStage(GLenum type, const char *code, const char *stageName)
+    {
+        int success;
+        char infoLog[512];
+
+        unsigned int stage = glCreateShader(type);
+        glShaderSource(stage, 1, &code, NULL);
+        glCompileShader(stage);
+
+        // Vérification des erreurs
+        glGetShaderiv(stage, GL_COMPILE_STATUS, &success);
+        if (!success)
+        {
+            glGetShaderInfoLog(stage, 512, NULL, infoLog);
+            std::cout << "Erreur de compilation du " << stageName << "\n"
+                      << infoLog << std::endl;
+        }
+        return stage;
+    }
+}
+
 Shader::Shader(const char *vertexPath, const char *fragmentPath)
 {
     // 1. Lire les fichiers de shaders
@@ -49,46 +75,83 @@ Shader::Shader(const char *vertexPath, const char *fragmentPath)
         std::cout << "Erreur de lecture des fichiers shaders" << std::endl;
     }
 
-    const char *vShaderCode = vertexCode.c_str();
-    const char *fShaderCode = fragmentCode.c_str();
+    // 2. Relire le programme lié en cache, sinon le compiler puis l'enregistrer
+    uint64_t cacheKey = 0;
+    if (ProgramCache::IsSupported())
+    {
+        cacheKey = ProgramCache::MakeKey(vertexCode, fragmentCode);
+        ID = glCreateProgram();
+        fromProgramCache = ProgramCache::Load(cacheKey, ID);
+        if (!fromProgramCache)
+            glDeleteProgram(ID);
+    }
 
-    // 2. Compiler les shaders
-    unsigned int vertex, fragment;
-    int success;
-    char infoLog[512];
+    if (!fromProgramCache && compileProgram(vertexCode.c_str(), fragmentCode.c_str()) && cacheKey != 0)
+        ProgramCache::Store(cacheKey, ID);
 
-    // Vertex Shader
-    vertex = glCreateShader(GL_VERTEX_SHADER);
-    glShaderSource(vertex, 1, &vShaderCode, NULL);
-    glCompileShader(vertex);
+    reflectUniforms();
+}
 
-    // Vérification des erreurs
-    glGetShaderiv(vertex, GL_COMPILE_STATUS, &success);
-    if (!success)
+Shader::Shader(const char *computePath)
+{
+    // 1. Lire le fichier du compute shader
+    std::string computeCode;
+    std::ifstream cShaderFile;
+    cShaderFile.exceptions(std::ifstream::failbit | std::ifstream::badbit);
+
+    try
     {
-        glGetShaderInfoLog(vertex, 512, NULL, infoLog);
-        std::cout << "Erreur de compilation du vertex shader\n"
-                  << infoLog << std::endl;
+        cShaderFile.open(computePath);
+        std::stringstream cShaderStream;
+        cShaderStream << cShaderFile.rdbuf();
+        cShaderFile.close();
+        computeCode = cShaderStream.str();
+    }
+    catch (std::ifstream::failure &e)
+    {
+        std::cout << "Erreur de lecture du compute shader " << computePath << std::endl;
     }
 
-    // Fragment Shader
-    fragment = glCreateShader(GL_FRAGMENT_SHADER);
-    glShaderSource(fragment, 1, &fShaderCode, NULL);
-    glCompileShader(fragment);
-
-    // Vérification des erreurs
-    glGetShaderiv(fragment, GL_COMPILE_STATUS, &success);
-    if (!success)
+    // 2. Même cache que les programmes graphiques, avec une source de fragment vide
+    uint64_t cacheKey = 0;
+    if (ProgramCache::IsSupported())
     {
-        glGetShaderInfoLog(fragment, 512, NULL, infoLog);
-        std::cout << "Erreur de compilation du fragment shader\n"
-                  << infoLog << std::endl;
+        cacheKey = ProgramCache::MakeKey(computeCode, std::string());
+        ID = glCreateProgram();
+        fromProgramCache = ProgramCache::Load(cacheKey, ID);
+        if (!fromProgramCache)
+            glDeleteProgram(ID);
     }
 
+    if (!fromProgramCache && compileComputeProgram(computeCode.c_str()) && cacheKey != 0)
+        ProgramCache::Store(cacheKey, ID);
+
+    reflectUniforms();
+}
+
+bool Shader::compileProgram(const char *vShaderCode, const char *fShaderCode)
+{
+    unsigned int vertex = compileStage(GL_VERTEX_SHADER, vShaderCode, "vertex shader");
+    unsigned int fragment = compileStage(GL_FRAGMENT_SHADER, fShaderCode, "fragment shader");
+    return linkProgram({vertex, fragment});
+}
+
+bool Shader::compileComputeProgram(const char *cShaderCode)
+{
+    return linkProgram({compileStage(GL_COMPUTE_SHADER, cShaderCode, "compute shader")});
+}
+
+bool Shader::linkProgram(std::initializer_list<unsigned int> stages)
+{
+    int success;
+    char infoLog[512];
+
     // Shader Program
     ID = glCreateProgram();
-    glAttachShader(ID, vertex);
-    glAttachShader(ID, fragment);
+    for (unsigned int stage : stages)
+        glAttachShader(ID, stage);
+    if (ProgramCache::IsSupported())
+        glProgramParameteri(ID, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
     glLinkProgram(ID);
 
     // Vérification des erreurs de linkage
@@ -101,8 +164,153 @@ Shader::Shader(const char *vertexPath, const char *fragmentPath)
     }
 
     // Supprimer les shaders compilés
-    glDeleteShader(vertex);
-    glDeleteShader(fragment);
+    for (unsigned int stage : stages)
+        glDeleteShader(stage);
+
+    return success != 0;
+}
+
+void Shader::reflectUniforms()
+{
+    GLint count = 0;
+    GLint maxLength = 0;
+    glGetProgramiv(ID, GL_ACTIVE_UNIFORMS, &count);
+    glGetProgramiv(ID, GL_ACTIVE_UNIFORM_MAX_LENGTH, &maxLength);
+
+    // Deux entrées possibles par uniform (tableaux : "nom" et "nom[0]")
+    size_t capacity = 8;
+    while (capacity < static_cast<size_t>(count) * 4)
+        capacity *= 2;
+    uniforms.assign(capacity, UniformEntry());
+    uniformCount = 0;
+
+    std::vector<char> name(maxLength > 0 ? maxLength : 1);
+    for (GLint i = 0; i < count; i++)
+    {
+        GLsizei length = 0;
+        GLint size = 0;
+        GLenum type = 0;
+        glGetActiveUniform(ID, static_cast<GLuint>(i), static_cast<GLsizei>(name.size()), &length, &size, &type, name.data());
+
+        // Les membres des blocs uniformes (UBO) n'ont pas d'emplacement
+        GLint location = glGetUniformLocation(ID, name.data());
+        if (location < 0)
+            continue;
+
+        insertUniform(Hash::Fnv1a64(name.data(), length), location, type);
+        if (length > 3 && std::strcmp(name.data() + length - 3, "[0]") == 0)
+            insertUniform(Hash::Fnv1a64(name.data(), length - 3), location, type);
+        uniformCount++;
+    }
+}
+
+void Shader::insertUniform(uint64_t hash, int location, unsigned int type)
+{
+    size_t mask = uniforms.size() - 1;
+    for (size_t i = hash & mask;; i = (i + 1) & mask)
+    {
+        UniformEntry &entry = uniforms[i];
+        if (entry.type == 0)
+        {
+            entry.hash = hash;
+            entry.location = location;
+            entry.type = type;
+            return;
+        }
+        if (entry.hash == hash)
+        {
+            std::cout << "Collision de hachage entre deux uniforms du programme " << ID << std::endl;
+            return;
+        }
+    }
+}
+
+const Shader::UniformEntry *Shader::findUniform(uint64_t hash) const
+{
+    if (uniforms.empty())
+        return nullptr;
+
+    size_t mask = uniforms.size() - 1;
+    for (size_t i = hash & mask;; i = (i + 1) & mask)
+    {
+        const UniformEntry &entry = uniforms[i];
+        if (entry.type == 0)
+            return nullptr;
+        if (entry.hash == hash)
+            return &entry;
+    }
+}
+
+int Shader::locationOf(UniformName name) const
+{
+    // -1 pour un uniform absent : glUniform* l'ignore, comme avec glGetUniformLocation
+    const UniformEntry *entry = findUniform(name.hash);
+    return entry ? entry->location : -1;
+}
+
+namespace
+{
+    // Types GLSL compatibles avec la valeur C++ d'un UniformHandle
+    template <typename T>
+    bool acceptsType(GLenum type);
+
+    template <>
+    bool acceptsType<int>(GLenum type)
+    {
+        return type == GL_INT || type == GL_BOOL || type == GL_SAMPLER_2D || type == GL_SAMPLER_CUBE;
+    }
+
+    template <>
+    bool acceptsType<float>(GLenum type) { return type == GL_FLOAT; }
+
+    template <>
+    bool acceptsType<glm::vec3>(GLenum type) { return type == GL_FLOAT_VEC3; }
+
+    template <>
+    bool acceptsType<glm::mat4>(GLenum type) { return type == GL_FLOAT_MAT4; }
+}
+
+template <typename T>
+UniformHandle<T> Shader::GetUniform(UniformName name) const
+{
+    UniformHandle<T> handle;
+    const UniformEntry *entry = findUniform(name.hash);
+    if (!entry)
+        return handle;
+
+    if (!acceptsType<T>(entry->type))
+    {
+        std::cout << "Type d'uniform inattendu dans le programme " << ID << " (type GL 0x" << std::hex << entry->type
+                  << std::dec << ")" << std::endl;
+        return handle;
+    }
+    handle.location = entry->location;
+    return handle;
+}
+
+template UniformHandle<int> Shader::GetUniform<int>(UniformName name) const;
+template UniformHandle<float> Shader::GetUniform<float>(UniformName name) const;
+template UniformHandle<glm::vec3> Shader::GetUniform<glm::vec3>(UniformName name) const;
+template UniformHandle<glm::mat4> Shader::GetUniform<glm::mat4>(UniformName name) const;
+
+void Shader::set(UniformHandle<int> handle, int value) const
+{
+    glUniform1i(handle.location, value);
+}
+
+void Shader::set(UniformHandle<float> handle, float value) const
+{
+    glUniform1f(handle.location, value);
+}
+
+void Shader::set(UniformHandle<glm::vec3> handle, const glm::vec3 &value) const
+{
+    glUniform3fv(handle.location, 1, &value[0]);
+}
+
+void Shader::set(UniformHandle<glm::mat4> handle, const glm::mat4 &value) const
+{
+    glUniformMatrix4fv(handle.location, 1, GL_FALSE, &value[0][0]);
 }
 
 void Shader::use() const
@@ -110,29 +318,29 @@ void Shader::use() const
     glUseProgram(ID);
 }
 
-void Shader::setBool(const std::string &name, bool value) const
+void Shader::setBool(UniformName name, bool value) const
 {
-    glUniform1i(glGetUniformLocation(ID, name.c_str()), (int)value);
+    glUniform1i(locationOf(name), (int)value);
 }
 
-void Shader::setInt(const std::string &name, int value) const
+void Shader::setInt(UniformName name, int value) const
 {
-    glUniform1i(glGetUniformLocation(ID, name.c_str()), value);
+    glUniform1i(locationOf(name), value);
 }
 
-void Shader::setFloat(const std::string &name, float value) const
+void Shader::setFloat(UniformName name, float value) const
 {
-    glUniform1f(glGetUniformLocation(ID, name.c_str()), value);
+    glUniform1f(locationOf(name), value);
 }
 
-void Shader::setMat4(const std::string &name, const glm::mat4 &mat) const
+void Shader::setMat4(UniformName name, const glm::mat4 &mat) const
 {
-    glUniformMatrix4fv(glGetUniformLocation(ID, name.c_str()), 1, GL_FALSE, &mat[0][0]);
+    glUniformMatrix4fv(locationOf(name), 1, GL_FALSE, &mat[0][0]);
 }
 
-void Shader::setVec3(const std::string &name, const glm::vec3 &vec) const
+void Shader::setVec3(UniformName name, const glm::vec3 &vec) const
 {
-    glUniform3fv(glGetUniformLocation(ID, name.c_str()), 1, &vec[0]);
+    glUniform3fv(locationOf(name), 1, &vec[0]);
 }
 
 void Shader::bindUBOs() const
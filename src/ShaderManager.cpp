@@ -1,4 +1,9 @@
 #include "ShaderManager.h"
+#include "ProgramCache.h"
+#include "GpuCuller.h"
+#include <GL/glew.h>
+#include <chrono>
+#include <iterator>
 #include <iostream>
 
 ShaderManager& ShaderManager::getInstance() {
@@ -12,30 +17,64 @@ bool ShaderManager::Initialize() {
     }
     
     std::cout << "Initialisation du ShaderManager..." << std::endl;
+    auto startTime = std::chrono::steady_clock::now();
     
     try {
         // Charger les shaders d'éclairage
         phongShader = std::make_unique<Shader>("../shaders/phong.vert", "../shaders/phong.frag");
         lambertShader = std::make_unique<Shader>("../shaders/lambert.vert", "../shaders/lambert.frag");
+        phongInstancedShader = std::make_unique<Shader>("../shaders/phong_instanced.vert", "../shaders/phong.frag");
+        lambertInstancedShader = std::make_unique<Shader>("../shaders/lambert_instanced.vert", "../shaders/lambert.frag");
         
         // Charger les autres shaders
         simpleShader = std::make_unique<Shader>("../shaders/simple_color.vert", "../shaders/simple_color.frag");
         texturedShader = std::make_unique<Shader>("../shaders/textured.vert", "../shaders/textured.frag");
         sunShader = std::make_unique<Shader>("../shaders/sun.vert", "../shaders/sun.frag");
+        particleShader = std::make_unique<Shader>("../shaders/particle.vert", "../shaders/particle.frag");
+        trailShader = std::make_unique<Shader>("../shaders/trail.vert", "../shaders/trail.frag");
         metalShader = std::make_unique<Shader>("../shaders/metal.vert", "../shaders/metal.frag");
         skyboxShader = std::make_unique<Shader>("../shaders/skybox.vert", "../shaders/skybox.frag");
+        
+        // Culling GPU facultatif : les scènes gardent le culling CPU sans ce programme
+        if (GpuCuller::IsSupported()) {
+            cullInstancesShader = std::make_unique<Shader>("../shaders/cull_instances.comp");
+            GLint linked = 0;
+            glGetProgramiv(cullInstancesShader->ID, GL_LINK_STATUS, &linked);
+            if (!linked) {
+                cullInstancesShader.reset();
+            }
+        }
           // Lier les UBOs aux shaders qui en ont besoin
         if (phongShader) phongShader->bindUBOs();
         if (lambertShader) lambertShader->bindUBOs();
+        if (phongInstancedShader) phongInstancedShader->bindUBOs();
+        if (lambertInstancedShader) lambertInstancedShader->bindUBOs();
         if (texturedShader) texturedShader->bindUBOs();
         if (metalShader) metalShader->bindUBOs();
         if (sunShader) sunShader->bindUBOs();
+        if (particleShader) particleShader->bindUBOs();
+        if (trailShader) trailShader->bindUBOs();
         if (simpleShader) simpleShader->bindUBOs();
         // Note: skyboxShader n'utilise pas les UBOs de transformation
         
         initialized = true;
-        std::cout << "ShaderManager initialisé avec succès" << std::endl;
-        std::cout << "- Shaders d'éclairage: Phong, Lambert" << std::endl;
+        double elapsedMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - startTime).count();
+        const Shader* shaders[] = {phongShader.get(), lambertShader.get(), phongInstancedShader.get(),
+                                   lambertInstancedShader.get(), simpleShader.get(), texturedShader.get(),
+                                   sunShader.get(), particleShader.get(), trailShader.get(), metalShader.get(),
+                                   skyboxShader.get()};
+        int cachedCount = 0;
+        for (const Shader* shader : shaders) {
+            if (shader && shader->IsFromProgramCache()) cachedCount++;
+        }
+        std::cout << "ShaderManager initialisé avec succès en " << elapsedMs << " ms" << std::endl;
+        if (ProgramCache::IsSupported()) {
+            std::cout << "- Programmes relus depuis le cache binaire: " << cachedCount << "/" << std::size(shaders) << std::endl;
+        } else {
+            std::cout << "- Cache binaire des programmes indisponible (aucun format binaire exposé par le pilote)" << std::endl;
+        }
+        std::cout << "- Shaders d'éclairage: Phong, Lambert (et variantes instanciées)" << std::endl;
+        std::cout << "- Culling GPU (compute shader): " << (cullInstancesShader ? "disponible" : "indisponible, culling CPU") << std::endl;
         std::cout << "- Shader actuel: " << (currentLightingShader == LightingShaderType::PHONG ? "Phong" : "Lambert") << std::endl;
         
         return true;
@@ -48,11 +87,16 @@ bool ShaderManager::Initialize() {
 void ShaderManager::Cleanup() {
     phongShader.reset();
     lambertShader.reset();
+    phongInstancedShader.reset();
+    lambertInstancedShader.reset();
     simpleShader.reset();
     texturedShader.reset();
     sunShader.reset();
+    particleShader.reset();
+    trailShader.reset();
     metalShader.reset();
     skyboxShader.reset();
+    cullInstancesShader.reset();
     initialized = false;
     std::cout << "ShaderManager nettoyé" << std::endl;
 }
@@ -79,6 +123,19 @@ Shader* ShaderManager::GetCurrentLightingShader() {
     }
 }
 
+Shader* ShaderManager::GetCurrentInstancedLightingShader() {
+    if (!initialized) return nullptr;
+    
+    switch (currentLightingShader) {
+        case LightingShaderType::PHONG:
+            return phongInstancedShader.get();
+        case LightingShaderType::LAMBERT:
+            return lambertInstancedShader.get();
+        default:
+            return phongInstancedShader.get();
+    }
+}
+
 Shader* ShaderManager::GetSimpleShader() {
     return initialized ? simpleShader.get() : nullptr;
 }
@@ -91,6 +148,14 @@ Shader* ShaderManager::GetSunShader() {
     return initialized ? sunShader.get() : nullptr;
 }
 
+Shader* ShaderManager::GetParticleShader() {
+    return initialized ? particleShader.get() : nullptr;
+}
+
+Shader* ShaderManager::GetTrailShader() {
+    return initialized ? trailShader.get() : nullptr;
+}
+
 Shader* ShaderManager::GetMetalShader() {
     return initialized ? metalShader.get() : nullptr;
 }
@@ -98,3 +163,7 @@ Shader* ShaderManager::GetMetalShader() {
 Shader* ShaderManager::GetSkyboxShader() {
     return initialized ? skyboxShader.get() : nullptr;
 }
+
+Shader* ShaderManager::GetCullInstancesShader() {
+    return initialized ? cullInstancesShader.get() : nullptr;
+}
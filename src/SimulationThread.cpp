@@ -0,0 +1,91 @@
+#include "SimulationThread.h"
+#include "SceneManager.h"
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+
+namespace {
+    // Retard toléré avant d'abandonner le temps perdu, en pas
+    const double MAX_LAG_STEPS = 5.0;
+
+    // Cadences accessibles, en pas par seconde
+    const double MIN_RATE = 1.0;
+    const double MAX_RATE = 1000.0;
+
+    std::chrono::steady_clock::time_point toTimePoint(double seconds) {
+        return std::chrono::steady_clock::time_point(
+            std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>(seconds)));
+    }
+}
+
+SimulationThread& SimulationThread::getInstance() {
+    static SimulationThread instance;
+    return instance;
+}
+
+SimulationThread::~SimulationThread() {
+    Stop();
+}
+
+double SimulationThread::Now() {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void SimulationThread::Start(SceneManager& sceneManager, double rateHz) {
+    if (IsRunning()) {
+        return;
+    }
+    if (rateHz <= 0.0) {
+        std::cout << "Simulation sur le thread principal (pas variable)" << std::endl;
+        return;
+    }
+
+    scenes = &sceneManager;
+    SetRate(rateHz);
+    stopping = false;
+    thread = std::thread(&SimulationThread::Run, this);
+    std::cout << "Simulation à pas fixe sur un thread dédié : " << rate.load() << " Hz" << std::endl;
+}
+
+void SimulationThread::Stop() {
+    if (!IsRunning()) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(sleepMutex);
+        stopping = true;
+    }
+    wake.notify_all();
+    thread.join();
+}
+
+void SimulationThread::SetRate(double rateHz) {
+    rate = std::clamp(rateHz, MIN_RATE, MAX_RATE);
+}
+
+void SimulationThread::Run() {
+    double next = Now();
+    for (;;) {
+        double step = 1.0 / rate.load();
+        double start = Now();
+
+        // Trop de retard : reprendre à l'instant présent
+        if (start - next > MAX_LAG_STEPS * step) {
+            droppedStepCount += static_cast<size_t>((start - next) / step);
+            next = start;
+        }
+
+        // Le pas amène l'état à next + step
+        scenes->Simulate(static_cast<float>(step), next + step);
+        lastStepMs = (Now() - start) * 1000.0;
+        stepCount++;
+        next += step;
+
+        std::unique_lock<std::mutex> lock(sleepMutex);
+        wake.wait_until(lock, toTimePoint(next), [this]() { return stopping; });
+        if (stopping) {
+            return;
+        }
+    }
+}
@@ -1,5 +1,7 @@
 #include "Skybox.h"
-#include "stb_image.h"
+#include "AssetLoader.h"
+#include "ShaderManager.h"
+#include <chrono>
 #include <iostream>
 #include <glm/gtc/matrix_transform.hpp>
 
@@ -48,10 +50,49 @@ static float skyboxVertices[] = {
      1.0f, -1.0f,  1.0f
 };
 
-Skybox::Skybox(const std::vector<std::string>& faces)
+Skybox::Skybox(const std::vector<std::string>& faces, bool streamed)
 {
-    // load cubemap
-    cubemapTexture = LoadCubemap(faces);
+    if (streamed) {
+        // Cubemap 1x1 unie affichée pendant le décodage des faces
+        glGenTextures(1, &cubemapTexture);
+        glBindTexture(GL_TEXTURE_CUBE_MAP, cubemapTexture);
+        unsigned char placeholderData[3] = {5, 5, 15}; // Noir spatial
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+        for (unsigned int i = 0; i < 6; i++) {
+            glTexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + i,
+                         0, GL_RGB, 1, 1, 0, GL_RGB, GL_UNSIGNED_BYTE, placeholderData);
+        }
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+        glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+
+        loaded = false;
+        streamToken = std::make_shared<int>(0);
+        std::weak_ptr<int> token = streamToken;
+        bool compress = TextureCompressor::IsSupported();
+        AssetLoader::getInstance().Submit([this, token, faces, compress]() {
+            std::vector<CompressedImage> compressed;
+            std::vector<DecodedImage> images;
+            DecodeFaces(faces, compress, compressed, images);
+
+            AssetLoader::Upload upload;
+            for (size_t i = 0; i < faces.size(); i++) {
+                upload.bytes += compressed[i].IsValid() ? compressed[i].Size() : images[i].Size();
+            }
+
+            upload.apply = [this, token, faces, compressed, images]() {
+                if (token.expired()) {
+                    return;
+                }
+                UploadFaces(cubemapTexture, faces, compressed, images);
+                loaded = true;
+            };
+            return upload;
+        });
+    } else {
+        // load cubemap
+        cubemapTexture = LoadCubemap(faces);
+    }
 
     // skybox VAO
     glGenVertexArrays(1, &skyboxVAO);
@@ -63,10 +104,16 @@ Skybox::Skybox(const std::vector<std::string>& faces)
     glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float), (void*)0);
     glBindVertexArray(0);
 
-    // shader
-    shader = std::make_unique<Shader>("../shaders/skybox.vert", "../shaders/skybox.frag");
+    // shader : programme partagé du ShaderManager, plutôt qu'une compilation par skybox
+    shader = ShaderManager::getInstance().GetSkyboxShader();
+    if (!shader) {
+        std::cerr << "Skybox: ShaderManager non initialisé, skybox non rendue" << std::endl;
+        return;
+    }
     shader->use();
     shader->setInt("skybox", 0);
+    viewUniform = shader->GetUniform<glm::mat4>("view");
+    projectionUniform = shader->GetUniform<glm::mat4>("projection");
 }
 
 Skybox::~Skybox()
@@ -80,27 +127,70 @@ unsigned int Skybox::LoadCubemap(const std::vector<std::string>& faces)
 {
     unsigned int textureID;
     glGenTextures(1, &textureID);
+
+    std::vector<CompressedImage> compressed;
+    std::vector<DecodedImage> images;
+    DecodeFaces(faces, TextureCompressor::IsSupported(), compressed, images);
+    UploadFaces(textureID, faces, compressed, images);
+
+    return textureID;
+}
+
+void Skybox::DecodeFaces(const std::vector<std::string>& faces, bool compress,
+                         std::vector<CompressedImage>& compressed, std::vector<DecodedImage>& images)
+{
+    compressed.assign(faces.size(), CompressedImage());
+    images.assign(faces.size(), DecodedImage());
+    std::vector<double> faceMs(faces.size(), 0.0);
+
+    // Les faces sont indépendantes : décodage en parallèle sur les threads de chargement
+    auto start = std::chrono::steady_clock::now();
+    AssetLoader::getInstance().ParallelFor(faces.size(), [&](size_t i) {
+        auto faceStart = std::chrono::steady_clock::now();
+        // Pas de mipmaps : la skybox est échantillonnée en GL_LINEAR
+        if (compress) {
+            TextureCompressor::Load(faces[i], false, compressed[i], images[i]);
+        } else {
+            images[i] = decodeImage(faces[i].c_str());
+        }
+        faceMs[i] = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - faceStart).count();
+    });
+    double totalMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    double sumMs = 0.0;
+    for (size_t i = 0; i < faces.size(); i++) {
+        std::cout << "Skybox: face " << faces[i] << " lue en " << faceMs[i] << " ms" << std::endl;
+        sumMs += faceMs[i];
+    }
+    std::cout << "Skybox: " << faces.size() << " faces lues en " << totalMs << " ms ("
+              << sumMs << " ms cumulés)" << std::endl;
+}
+
+void Skybox::UploadFaces(unsigned int textureID, const std::vector<std::string>& faces,
+                         const std::vector<CompressedImage>& compressed, const std::vector<DecodedImage>& images)
+{
     glBindTexture(GL_TEXTURE_CUBE_MAP, textureID);
 
-    int width, height, nrChannels;
     for (unsigned int i = 0; i < faces.size(); i++) {
         std::cout << "Chargement texture skybox: " << faces[i] << std::endl;
-        unsigned char *data = stbi_load(faces[i].c_str(), &width, &height, &nrChannels, 0);
-        if (data) {
-            std::cout << "Texture chargée: " << width << "x" << height << " canaux: " << nrChannels << std::endl;
+        const DecodedImage& image = images[i];
+        if (compressed[i].IsValid()) {
+            std::cout << "Texture compressée: " << compressed[i].width << "x" << compressed[i].height << std::endl;
+            TextureCompressor::Upload(GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, compressed[i]);
+        } else if (image.IsValid()) {
+            std::cout << "Texture chargée: " << image.width << "x" << image.height << " canaux: " << image.components << std::endl;
             
             // Déterminer le format selon le nombre de canaux
             GLenum format = GL_RGB;
-            if (nrChannels == 1)
+            if (image.components == 1)
                 format = GL_RED;
-            else if (nrChannels == 3)
+            else if (image.components == 3)
                 format = GL_RGB;
-            else if (nrChannels == 4)
+            else if (image.components == 4)
                 format = GL_RGBA;
             
             glTexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + i,
-                         0, format, width, height, 0, format, GL_UNSIGNED_BYTE, data);
-            stbi_image_free(data);
+                         0, format, image.width, image.height, 0, format, GL_UNSIGNED_BYTE, image.pixels.get());
         } else {
             std::cerr << "ERREUR: Impossible de charger la texture skybox: " << faces[i] << std::endl;
             // Créer une texture de couleur unie en cas d'échec
@@ -114,21 +204,21 @@ unsigned int Skybox::LoadCubemap(const std::vector<std::string>& faces)
     glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
     glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
     glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_R, GL_CLAMP_TO_EDGE);
-
-    return textureID;
 }
 
 void Skybox::Render(const glm::mat4& view, const glm::mat4& projection)
 {
     // Changer l'ordre de depth testing pour que la skybox soit rendue en arrière-plan
+    if (!shader) return;
+
     glDepthFunc(GL_LEQUAL);
     
     shader->use();
     
     // Enlever la translation de la matrice de vue pour que la skybox reste centrée
     glm::mat4 viewNoTrans = glm::mat4(glm::mat3(view));
-    shader->setMat4("view", viewNoTrans);
-    shader->setMat4("projection", projection);
+    shader->set(viewUniform, viewNoTrans);
+    shader->set(projectionUniform, projection);
     
     // Dessiner le cube de la skybox
     glBindVertexArray(skyboxVAO);
@@ -0,0 +1,46 @@
+#include "SourceStamp.h"
+#include "Hash.h"
+#include "MappedFile.h"
+
+#include <filesystem>
+
+namespace
+{
+    bool readSizeAndTime(const std::string &path, uint64_t &size, int64_t &time)
+    {
+        std::error_code ec;
+        size = static_cast<uint64_t>(std::filesystem::file_size(path, ec));
+        if (ec)
+            return false;
+        time = static_cast<int64_t>(std::filesystem::last_write_time(path, ec).time_since_epoch().count());
+        return !ec;
+    }
+
+    bool hashFile(const std::string &path, uint64_t &hash)
+    {
+        MappedFile source;
+        if (!source.Open(path))
+            return false;
+        hash = Hash::Fnv1a64(source.Data(), source.Size());
+        return true;
+    }
+}
+
+bool SourceStamp::Read(const std::string &path, SourceStamp &stamp)
+{
+    return readSizeAndTime(path, stamp.size, stamp.time) && hashFile(path, stamp.hash);
+}
+
+bool SourceStamp::Matches(const std::string &path) const
+{
+    // Taille et date d'abord, hachage seulement si la date a changé
+    uint64_t currentSize = 0;
+    int64_t currentTime = 0;
+    if (!readSizeAndTime(path, currentSize, currentTime) || currentSize != size)
+        return false;
+    if (currentTime == time)
+        return true;
+
+    uint64_t currentHash = 0;
+    return hashFile(path, currentHash) && currentHash == hash;
+}
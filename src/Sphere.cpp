@@ -10,26 +10,30 @@ Sphere::Sphere(float radius, unsigned int sectors, unsigned int stacks) {
 
     // Générer la géométrie de la sphère
     generateSphere(vertices, indices, radius, sectors, stacks);
+    boundingSphere.radius = radius;
 
     // Créer le mesh dynamiquement
     pMesh = new Mesh(vertices, indices, textures);
 }
 
 // Constructeur avec texture
-Sphere::Sphere(const std::string &texturePath, float radius, unsigned int sectors, unsigned int stacks) {
+Sphere::Sphere(const std::string &texturePath, float radius, unsigned int sectors, unsigned int stacks, bool streamed) {
     std::vector<Vertex> vertices;
     std::vector<unsigned int> indices;
     std::vector<Texture> textures;
 
     // Générer la géométrie de la sphère
     generateSphere(vertices, indices, radius, sectors, stacks);
+    boundingSphere.radius = radius;
 
-    // Charger la texture
-    Texture texture;
-    texture.id = loadTexture(texturePath.c_str());
-    texture.type = "texture_diffuse";
-    texture.path = texturePath;
-    textures.push_back(texture);
+    // Texture partagée (substitut gris en attendant le décodage en mode streamed)
+    texture = TextureCache::getInstance().Load(texturePath, TextureParams(), streamed);
+
+    Texture meshTexture;
+    meshTexture.id = texture->id;
+    meshTexture.type = "texture_diffuse";
+    meshTexture.path = texturePath;
+    textures.push_back(meshTexture);
 
     // Créer le mesh dynamiquement
     pMesh = new Mesh(vertices, indices, textures);
@@ -45,10 +49,24 @@ Sphere::~Sphere() {
 
 void Sphere::Draw(const Shader &shader) const {
     if (pMesh) {
+        // L'identifiant change une fois la texture partagée envoyée au GPU
+        if (texture) {
+            pMesh->textures[0].id = texture->id;
+        }
         pMesh->Draw(shader);
     }
 }
 
+void Sphere::Submit(RenderQueue &queue, DrawPacket packet) const {
+    if (pMesh) {
+        if (texture) {
+            pMesh->textures[0].id = texture->id;
+        }
+        packet.mesh = pMesh;
+        queue.Submit(packet);
+    }
+}
+
 // Méthode pour générer la géométrie de la sphère
 void Sphere::generateSphere(std::vector<Vertex> &vertices, std::vector<unsigned int> &indices,
                            float radius, unsigned int sectors, unsigned int stacks) {
@@ -0,0 +1,137 @@
+#include "TextureCache.h"
+#include "AssetLoader.h"
+
+#include <filesystem>
+#include <iostream>
+#include <system_error>
+
+namespace {
+    // Taille estimée côté GPU : un octet par composante, plus la chaîne de mipmaps
+    size_t estimateGpuBytes(const DecodedImage& image, bool mipmaps) {
+        size_t width = static_cast<size_t>(image.width);
+        size_t height = static_cast<size_t>(image.height);
+        size_t bytes = 0;
+        while (true) {
+            bytes += width * height * image.components;
+            if (!mipmaps || (width == 1 && height == 1)) {
+                break;
+            }
+            width = width > 1 ? width / 2 : 1;
+            height = height > 1 ? height / 2 : 1;
+        }
+        return bytes;
+    }
+
+    // Image compressée (cache KTX) si le contexte l'accepte, image décodée sinon
+    void decodeTexture(const std::string& path, const TextureParams& params, bool compress,
+                       CompressedImage& compressed, DecodedImage& image) {
+        if (compress) {
+            TextureCompressor::Load(path, params.mipmaps, compressed, image);
+        } else {
+            image = decodeImage(path.c_str());
+        }
+    }
+}
+
+TextureCache& TextureCache::getInstance() {
+    static TextureCache instance;
+    return instance;
+}
+
+std::string TextureCache::MakeKey(const std::string& path, const TextureParams& params) {
+    // Chemin canonique : "../textures/a.jpg" et "textures/a.jpg" désignent la même entrée
+    std::error_code error;
+    std::filesystem::path canonical = std::filesystem::weakly_canonical(path, error);
+    std::string key = error ? path : canonical.string();
+
+    key += "|wrap=" + std::to_string(params.wrap);
+    key += params.mipmaps ? "|mip" : "|nomip";
+    return key;
+}
+
+TextureHandle TextureCache::Load(const std::string& path, const TextureParams& params, bool streamed) {
+    std::string key = MakeKey(path, params);
+
+    auto it = entries.find(key);
+    if (it != entries.end()) {
+        if (TextureHandle existing = it->second.lock()) {
+            return existing;
+        }
+    }
+
+    TextureHandle texture(new CachedTexture(), [](CachedTexture* released) {
+        TextureCache::getInstance().Release(released);
+    });
+    texture->key = key;
+    entries[key] = texture;
+
+    bool compress = TextureCompressor::IsSupported();
+    if (!streamed) {
+        CompressedImage compressed;
+        DecodedImage image;
+        decodeTexture(path, params, compress, compressed, image);
+        Upload(*texture, compressed, image, path, params);
+        return texture;
+    }
+
+    texture->id = getPlaceholderTexture();
+    std::weak_ptr<CachedTexture> weakTexture = texture;
+    AssetLoader::getInstance().Submit([this, weakTexture, path, params, compress]() {
+        CompressedImage compressed;
+        DecodedImage image;
+        decodeTexture(path, params, compress, compressed, image);
+
+        AssetLoader::Upload upload;
+        upload.bytes = compressed.IsValid() ? compressed.Size() : image.Size();
+        upload.apply = [this, weakTexture, path, params, compressed, image]() {
+            // Tous les handles ont été détruits pendant le décodage
+            TextureHandle texture = weakTexture.lock();
+            if (!texture) {
+                return;
+            }
+            Upload(*texture, compressed, image, path, params);
+        };
+        return upload;
+    });
+    return texture;
+}
+
+void TextureCache::Upload(CachedTexture& texture, const CompressedImage& compressed, const DecodedImage& image,
+                          const std::string& path, const TextureParams& params) {
+    if (compressed.IsValid()) {
+        // Blocs compressés et mipmaps précalculées : ni décodage ni glGenerateMipmap
+        glGenTextures(1, &texture.id);
+        glBindTexture(GL_TEXTURE_2D, texture.id);
+        TextureCompressor::Upload(GL_TEXTURE_2D, compressed);
+
+        GLint levelCount = static_cast<GLint>(compressed.levels.size());
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, levelCount - 1);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, params.wrap);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, params.wrap);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, levelCount > 1 ? GL_LINEAR_MIPMAP_LINEAR : GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+
+        std::cout << "Texture compressée chargée: " << path << " (" << levelCount << " niveau(x))" << std::endl;
+        texture.gpuBytes = compressed.Size();
+    } else {
+        texture.id = uploadTexture(image, path.c_str(), 0, params);
+        texture.gpuBytes = image.IsValid() ? estimateGpuBytes(image, params.mipmaps) : 0;
+    }
+    texture.loaded = true;
+    totalBytes += texture.gpuBytes;
+}
+
+void TextureCache::Release(CachedTexture* texture) {
+    // La texture de substitution est partagée et n'appartient pas à l'entrée
+    if (texture->loaded && texture->id != 0) {
+        glDeleteTextures(1, &texture->id);
+    }
+    totalBytes -= texture->gpuBytes;
+
+    // Une nouvelle entrée de même clé a pu être créée entre-temps
+    auto it = entries.find(texture->key);
+    if (it != entries.end() && it->second.expired()) {
+        entries.erase(it);
+    }
+    delete texture;
+}
@@ -0,0 +1,584 @@
+#include "TextureCompressor.h"
+#include "MappedFile.h"
+#include "SourceStamp.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <limits>
+#include <thread>
+#include <glm/glm.hpp>
+
+namespace
+{
+    // En-tête KTX 1.1 (https://registry.khronos.org/KTX/specs/1.0/ktxspec_v1.html)
+    const unsigned char KTX_IDENTIFIER[12] = {0xAB, 'K', 'T', 'X', ' ', '1', '1', 0xBB, '\r', '\n', 0x1A, '\n'};
+    const uint32_t KTX_ENDIANNESS = 0x04030201;
+
+    struct KtxHeader
+    {
+        unsigned char identifier[12];
+        uint32_t endianness;
+        uint32_t glType;
+        uint32_t glTypeSize;
+        uint32_t glFormat;
+        uint32_t glInternalFormat;
+        uint32_t glBaseInternalFormat;
+        uint32_t pixelWidth;
+        uint32_t pixelHeight;
+        uint32_t pixelDepth;
+        uint32_t numberOfArrayElements;
+        uint32_t numberOfFaces;
+        uint32_t numberOfMipmapLevels;
+        uint32_t bytesOfKeyValueData;
+    };
+
+    // Métadonnée propre au projet : version du transcodeur et empreinte de la source
+    const char STAMP_KEY[] = "SourceStamp";
+
+    struct StampValue
+    {
+        uint32_t version;
+        uint32_t padding;
+        SourceStamp source;
+    };
+
+    size_t alignUp(size_t value, size_t alignment)
+    {
+        return (value + alignment - 1) / alignment * alignment;
+    }
+
+    size_t blockBytes(GLenum format)
+    {
+        return format == GL_COMPRESSED_RGBA_S3TC_DXT5_EXT ? 16 : 8;
+    }
+
+    size_t levelSize(GLenum format, int width, int height)
+    {
+        return size_t((width + 3) / 4) * size_t((height + 3) / 4) * blockBytes(format);
+    }
+
+    size_t mipCount(int width, int height)
+    {
+        size_t count = 1;
+        while (width > 1 || height > 1)
+        {
+            width = std::max(1, width / 2);
+            height = std::max(1, height / 2);
+            count++;
+        }
+        return count;
+    }
+
+    uint16_t packRgb565(const glm::vec3 &color)
+    {
+        glm::vec3 c = glm::clamp(color, 0.0f, 255.0f);
+        uint16_t r = static_cast<uint16_t>(c.r * 31.0f / 255.0f + 0.5f);
+        uint16_t g = static_cast<uint16_t>(c.g * 63.0f / 255.0f + 0.5f);
+        uint16_t b = static_cast<uint16_t>(c.b * 31.0f / 255.0f + 0.5f);
+        return static_cast<uint16_t>((r << 11) | (g << 5) | b);
+    }
+
+    glm::vec3 unpackRgb565(uint16_t packed)
+    {
+        unsigned int r = (packed >> 11) & 31;
+        unsigned int g = (packed >> 5) & 63;
+        unsigned int b = packed & 31;
+        return glm::vec3(float((r << 3) | (r >> 2)), float((g << 2) | (g >> 4)), float((b << 3) | (b >> 2)));
+    }
+
+    // Choisit l'entrée de palette la plus proche pour chaque pixel ; renvoie l'erreur quadratique
+    float fitIndices(const glm::vec3 colors[16], uint16_t c0, uint16_t c1, unsigned int indices[16])
+    {
+        glm::vec3 palette[4];
+        palette[0] = unpackRgb565(c0);
+        palette[1] = unpackRgb565(c1);
+        palette[2] = (2.0f * palette[0] + palette[1]) / 3.0f;
+        palette[3] = (palette[0] + 2.0f * palette[1]) / 3.0f;
+
+        float error = 0.0f;
+        for (int i = 0; i < 16; i++)
+        {
+            float best = std::numeric_limits<float>::max();
+            for (unsigned int p = 0; p < 4; p++)
+            {
+                glm::vec3 d = colors[i] - palette[p];
+                float distance = glm::dot(d, d);
+                if (distance < best)
+                {
+                    best = distance;
+                    indices[i] = p;
+                }
+            }
+            error += best;
+        }
+        return error;
+    }
+
+    // Bloc de couleur BC1 (mode 4 couleurs) : extrémités sur l'axe principal, affinées par moindres carrés
+    void encodeColorBlock(const unsigned char block[16][4], unsigned char *out)
+    {
+        glm::vec3 colors[16];
+        glm::vec3 mean(0.0f);
+        for (int i = 0; i < 16; i++)
+        {
+            colors[i] = glm::vec3(block[i][0], block[i][1], block[i][2]);
+            mean += colors[i];
+        }
+        mean /= 16.0f;
+
+        // Matrice de covariance (symétrique : six termes)
+        float xx = 0.0f, xy = 0.0f, xz = 0.0f, yy = 0.0f, yz = 0.0f, zz = 0.0f;
+        for (int i = 0; i < 16; i++)
+        {
+            glm::vec3 d = colors[i] - mean;
+            xx += d.x * d.x;
+            xy += d.x * d.y;
+            xz += d.x * d.z;
+            yy += d.y * d.y;
+            yz += d.y * d.z;
+            zz += d.z * d.z;
+        }
+
+        // Axe principal par itérations de puissance
+        glm::vec3 axis(1.0f, 1.0f, 1.0f);
+        for (int iteration = 0; iteration < 8; iteration++)
+        {
+            glm::vec3 next(xx * axis.x + xy * axis.y + xz * axis.z,
+                           xy * axis.x + yy * axis.y + yz * axis.z,
+                           xz * axis.x + yz * axis.y + zz * axis.z);
+            float length = glm::length(next);
+            if (length < 1e-6f)
+                break;
+            axis = next / length;
+        }
+
+        float minT = std::numeric_limits<float>::max();
+        float maxT = -std::numeric_limits<float>::max();
+        for (int i = 0; i < 16; i++)
+        {
+            float t = glm::dot(colors[i] - mean, axis);
+            minT = std::min(minT, t);
+            maxT = std::max(maxT, t);
+        }
+
+        uint16_t c0 = packRgb565(mean + axis * maxT);
+        uint16_t c1 = packRgb565(mean + axis * minT);
+        unsigned int indices[16];
+        float error = fitIndices(colors, c0, c1, indices);
+
+        // Moindres carrés sur les extrémités, à indices fixés
+        const float weights[4] = {1.0f, 0.0f, 2.0f / 3.0f, 1.0f / 3.0f};
+        float aa = 0.0f, ab = 0.0f, bb = 0.0f;
+        glm::vec3 ax(0.0f), bx(0.0f);
+        for (int i = 0; i < 16; i++)
+        {
+            float w = weights[indices[i]];
+            aa += w * w;
+            ab += w * (1.0f - w);
+            bb += (1.0f - w) * (1.0f - w);
+            ax += w * colors[i];
+            bx += (1.0f - w) * colors[i];
+        }
+        float determinant = aa * bb - ab * ab;
+        if (std::fabs(determinant) > 1e-6f)
+        {
+            uint16_t refined0 = packRgb565((ax * bb - bx * ab) / determinant);
+            uint16_t refined1 = packRgb565((bx * aa - ax * ab) / determinant);
+            unsigned int refinedIndices[16];
+            float refinedError = fitIndices(colors, refined0, refined1, refinedIndices);
+            if (refinedError < error)
+            {
+                c0 = refined0;
+                c1 = refined1;
+                std::copy(refinedIndices, refinedIndices + 16, indices);
+            }
+        }
+
+        // Le mode 4 couleurs exige c0 > c1 : échange des extrémités et des indices
+        if (c0 < c1)
+        {
+            std::swap(c0, c1);
+            const unsigned int swapped[4] = {1, 0, 3, 2};
+            for (int i = 0; i < 16; i++)
+                indices[i] = swapped[indices[i]];
+        }
+        else if (c0 == c1)
+        {
+            std::fill(indices, indices + 16, 0u);
+        }
+
+        uint32_t bits = 0;
+        for (int i = 0; i < 16; i++)
+            bits |= indices[i] << (2 * i);
+
+        out[0] = static_cast<unsigned char>(c0 & 0xFF);
+        out[1] = static_cast<unsigned char>(c0 >> 8);
+        out[2] = static_cast<unsigned char>(c1 & 0xFF);
+        out[3] = static_cast<unsigned char>(c1 >> 8);
+        for (int i = 0; i < 4; i++)
+            out[4 + i] = static_cast<unsigned char>(bits >> (8 * i));
+    }
+
+    // Bloc alpha BC3 (mode 8 valeurs) entre le minimum et le maximum du bloc
+    void encodeAlphaBlock(const unsigned char block[16][4], unsigned char *out)
+    {
+        unsigned char a0 = 0;
+        unsigned char a1 = 255;
+        for (int i = 0; i < 16; i++)
+        {
+            a0 = std::max(a0, block[i][3]);
+            a1 = std::min(a1, block[i][3]);
+        }
+
+        int palette[8] = {a0, a1};
+        for (int i = 2; i < 8; i++)
+            palette[i] = ((8 - i) * a0 + (i - 1) * a1) / 7;
+
+        uint64_t bits = 0;
+        if (a0 != a1)
+        {
+            for (int i = 0; i < 16; i++)
+            {
+                uint64_t bestIndex = 0;
+                int best = 256;
+                for (int p = 0; p < 8; p++)
+                {
+                    int distance = std::abs(int(block[i][3]) - palette[p]);
+                    if (distance < best)
+                    {
+                        best = distance;
+                        bestIndex = static_cast<uint64_t>(p);
+                    }
+                }
+                bits |= bestIndex << (3 * i);
+            }
+        }
+
+        out[0] = a0;
+        out[1] = a1;
+        for (int i = 0; i < 6; i++)
+            out[2 + i] = static_cast<unsigned char>(bits >> (8 * i));
+    }
+
+    void encodeLevel(const std::vector<unsigned char> &rgba, int width, int height, GLenum format, unsigned char *out)
+    {
+        unsigned char block[16][4];
+        for (int by = 0; by < height; by += 4)
+        {
+            for (int bx = 0; bx < width; bx += 4)
+            {
+                // Blocs incomplets en bordure : répétition du dernier pixel
+                for (int y = 0; y < 4; y++)
+                {
+                    for (int x = 0; x < 4; x++)
+                    {
+                        size_t px = static_cast<size_t>(std::min(bx + x, width - 1));
+                        size_t py = static_cast<size_t>(std::min(by + y, height - 1));
+                        std::memcpy(block[y * 4 + x], &rgba[(py * width + px) * 4], 4);
+                    }
+                }
+
+                if (format == GL_COMPRESSED_RGBA_S3TC_DXT5_EXT)
+                {
+                    encodeAlphaBlock(block, out);
+                    out += 8;
+                }
+                encodeColorBlock(block, out);
+                out += 8;
+            }
+        }
+    }
+
+    // Réduction 2x2 par filtre boîte (bords répétés pour les dimensions impaires)
+    std::vector<unsigned char> downsample(const std::vector<unsigned char> &rgba, int width, int height, int &outWidth, int &outHeight)
+    {
+        outWidth = std::max(1, width / 2);
+        outHeight = std::max(1, height / 2);
+        std::vector<unsigned char> result(size_t(outWidth) * outHeight * 4);
+        for (int y = 0; y < outHeight; y++)
+        {
+            size_t y0 = static_cast<size_t>(std::min(2 * y, height - 1));
+            size_t y1 = static_cast<size_t>(std::min(2 * y + 1, height - 1));
+            for (int x = 0; x < outWidth; x++)
+            {
+                size_t x0 = static_cast<size_t>(std::min(2 * x, width - 1));
+                size_t x1 = static_cast<size_t>(std::min(2 * x + 1, width - 1));
+                for (size_t c = 0; c < 4; c++)
+                {
+                    unsigned int sum = rgba[(y0 * width + x0) * 4 + c] + rgba[(y0 * width + x1) * 4 + c] +
+                                       rgba[(y1 * width + x0) * 4 + c] + rgba[(y1 * width + x1) * 4 + c];
+                    result[(size_t(y) * outWidth + x) * 4 + c] = static_cast<unsigned char>((sum + 2) / 4);
+                }
+            }
+        }
+        return result;
+    }
+}
+
+size_t CompressedImage::Size() const
+{
+    size_t total = 0;
+    for (const CompressedLevel &level : levels)
+        total += level.size;
+    return total;
+}
+
+bool TextureCompressor::IsSupported()
+{
+    return GLEW_EXT_texture_compression_s3tc != 0;
+}
+
+std::string TextureCompressor::GetCachePath(const std::string &sourcePath)
+{
+    return sourcePath + ".ktx";
+}
+
+bool TextureCompressor::Load(const std::string &sourcePath, bool mipmaps, CompressedImage &compressed, DecodedImage &decoded)
+{
+    if (ReadCache(sourcePath, mipmaps, compressed))
+        return true;
+
+    decoded = decodeImage(sourcePath.c_str());
+    if (!decoded.IsValid())
+        return false;
+
+    auto start = std::chrono::steady_clock::now();
+    compressed = Compress(decoded, mipmaps);
+    if (!compressed.IsValid())
+        return false;
+    double elapsedMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    std::cout << "Texture transcodée en " << (compressed.internalFormat == GL_COMPRESSED_RGBA_S3TC_DXT5_EXT ? "BC3" : "BC1")
+              << " (" << compressed.levels.size() << " niveau(x), " << decoded.Size() / 1024 << " Ko -> "
+              << compressed.Size() / 1024 << " Ko, " << elapsedMs << " ms): " << sourcePath << std::endl;
+    if (!WriteCache(sourcePath, compressed))
+        std::cerr << "Avertissement : impossible d'écrire le cache " << GetCachePath(sourcePath) << std::endl;
+
+    decoded = DecodedImage();
+    return true;
+}
+
+CompressedImage TextureCompressor::Compress(const DecodedImage &image, bool mipmaps)
+{
+    CompressedImage result;
+    if (!image.IsValid() || (image.components != 3 && image.components != 4))
+        return result;
+
+    // Conversion en RGBA ; les images RGBA entièrement opaques sont encodées en BC1
+    size_t pixelCount = size_t(image.width) * image.height;
+    std::vector<unsigned char> rgba(pixelCount * 4);
+    bool opaque = true;
+    const unsigned char *pixels = image.pixels.get();
+    for (size_t i = 0; i < pixelCount; i++)
+    {
+        const unsigned char *source = pixels + i * image.components;
+        rgba[i * 4 + 0] = source[0];
+        rgba[i * 4 + 1] = source[1];
+        rgba[i * 4 + 2] = source[2];
+        rgba[i * 4 + 3] = image.components == 4 ? source[3] : 255;
+        opaque = opaque && rgba[i * 4 + 3] == 255;
+    }
+
+    result.internalFormat = opaque ? GL_COMPRESSED_RGB_S3TC_DXT1_EXT : GL_COMPRESSED_RGBA_S3TC_DXT5_EXT;
+    result.width = image.width;
+    result.height = image.height;
+
+    size_t levelCount = mipmaps ? mipCount(image.width, image.height) : 1;
+    size_t totalSize = 0;
+    int width = image.width;
+    int height = image.height;
+    for (size_t i = 0; i < levelCount; i++)
+    {
+        CompressedLevel level;
+        level.width = width;
+        level.height = height;
+        level.size = levelSize(result.internalFormat, width, height);
+        result.levels.push_back(level);
+        totalSize += level.size;
+        width = std::max(1, width / 2);
+        height = std::max(1, height / 2);
+    }
+
+    auto blocks = std::make_shared<std::vector<unsigned char>>(totalSize);
+    unsigned char *out = blocks->data();
+    for (size_t i = 0; i < levelCount; i++)
+    {
+        CompressedLevel &level = result.levels[i];
+        if (i > 0)
+        {
+            int mipWidth = 0;
+            int mipHeight = 0;
+            rgba = downsample(rgba, result.levels[i - 1].width, result.levels[i - 1].height, mipWidth, mipHeight);
+        }
+        encodeLevel(rgba, level.width, level.height, result.internalFormat, out);
+        level.data = out;
+        out += level.size;
+    }
+    result.storage = blocks;
+    return result;
+}
+
+bool TextureCompressor::ReadCache(const std::string &sourcePath, bool mipmaps, CompressedImage &image)
+{
+    auto file = std::make_shared<MappedFile>();
+    if (!file->Open(GetCachePath(sourcePath)) || file->Size() < sizeof(KtxHeader))
+        return false;
+
+    KtxHeader header;
+    std::memcpy(&header, file->Data(), sizeof(header));
+    if (std::memcmp(header.identifier, KTX_IDENTIFIER, sizeof(KTX_IDENTIFIER)) != 0 ||
+        header.endianness != KTX_ENDIANNESS ||
+        (header.glInternalFormat != GL_COMPRESSED_RGB_S3TC_DXT1_EXT && header.glInternalFormat != GL_COMPRESSED_RGBA_S3TC_DXT5_EXT) ||
+        header.pixelWidth == 0 || header.pixelHeight == 0 || header.pixelDepth != 0 ||
+        header.numberOfArrayElements != 0 || header.numberOfFaces != 1 || header.numberOfMipmapLevels == 0)
+        return false;
+
+    // Un cache sans mipmaps ne convient pas à une texture qui en demande
+    int width = static_cast<int>(header.pixelWidth);
+    int height = static_cast<int>(header.pixelHeight);
+    size_t fullChain = mipCount(width, height);
+    if (header.numberOfMipmapLevels > fullChain || (mipmaps && header.numberOfMipmapLevels != fullChain))
+        return false;
+
+    // Métadonnées : empreinte de la source
+    size_t offset = sizeof(KtxHeader);
+    size_t keyValueEnd = offset + header.bytesOfKeyValueData;
+    if (keyValueEnd > file->Size())
+        return false;
+    bool stampValid = false;
+    while (offset + sizeof(uint32_t) <= keyValueEnd)
+    {
+        uint32_t pairSize;
+        std::memcpy(&pairSize, file->Data() + offset, sizeof(pairSize));
+        offset += sizeof(uint32_t);
+        if (offset + pairSize > keyValueEnd)
+            return false;
+
+        const unsigned char *pair = file->Data() + offset;
+        if (pairSize == sizeof(STAMP_KEY) + sizeof(StampValue) && std::memcmp(pair, STAMP_KEY, sizeof(STAMP_KEY)) == 0)
+        {
+            StampValue value;
+            std::memcpy(&value, pair + sizeof(STAMP_KEY), sizeof(value));
+            stampValid = value.version == VERSION && value.source.Matches(sourcePath);
+        }
+        offset += alignUp(pairSize, 4);
+    }
+    if (!stampValid)
+        return false;
+
+    offset = keyValueEnd;
+    size_t levelCount = mipmaps ? header.numberOfMipmapLevels : 1;
+    std::vector<CompressedLevel> levels;
+    for (size_t i = 0; i < levelCount; i++)
+    {
+        uint32_t imageSize;
+        if (offset + sizeof(imageSize) > file->Size())
+            return false;
+        std::memcpy(&imageSize, file->Data() + offset, sizeof(imageSize));
+        offset += sizeof(imageSize);
+
+        CompressedLevel level;
+        level.width = width;
+        level.height = height;
+        level.size = levelSize(header.glInternalFormat, width, height);
+        if (imageSize != level.size || offset + level.size > file->Size())
+        {
+            std::cerr << "TextureCompressor: cache corrompu pour " << sourcePath << std::endl;
+            return false;
+        }
+        level.data = file->Data() + offset;
+        levels.push_back(level);
+
+        offset += alignUp(level.size, 4);
+        width = std::max(1, width / 2);
+        height = std::max(1, height / 2);
+    }
+
+    image.internalFormat = header.glInternalFormat;
+    image.width = static_cast<int>(header.pixelWidth);
+    image.height = static_cast<int>(header.pixelHeight);
+    image.levels = std::move(levels);
+    image.storage = file;
+    return true;
+}
+
+bool TextureCompressor::WriteCache(const std::string &sourcePath, const CompressedImage &image)
+{
+    if (!image.IsValid())
+        return false;
+
+    StampValue value = {};
+    value.version = VERSION;
+    if (!SourceStamp::Read(sourcePath, value.source))
+        return false;
+
+    uint32_t pairSize = static_cast<uint32_t>(sizeof(STAMP_KEY) + sizeof(StampValue));
+
+    KtxHeader header;
+    std::memcpy(header.identifier, KTX_IDENTIFIER, sizeof(KTX_IDENTIFIER));
+    header.endianness = KTX_ENDIANNESS;
+    header.glType = 0;
+    header.glTypeSize = 1;
+    header.glFormat = 0;
+    header.glInternalFormat = image.internalFormat;
+    header.glBaseInternalFormat = image.internalFormat == GL_COMPRESSED_RGBA_S3TC_DXT5_EXT ? GL_RGBA : GL_RGB;
+    header.pixelWidth = static_cast<uint32_t>(image.width);
+    header.pixelHeight = static_cast<uint32_t>(image.height);
+    header.pixelDepth = 0;
+    header.numberOfArrayElements = 0;
+    header.numberOfFaces = 1;
+    header.numberOfMipmapLevels = static_cast<uint32_t>(image.levels.size());
+    header.bytesOfKeyValueData = static_cast<uint32_t>(sizeof(uint32_t) + alignUp(pairSize, 4));
+
+    // Fichier temporaire propre au thread (deux scènes peuvent transcoder la même image), puis renommage
+    std::string cachePath = GetCachePath(sourcePath);
+    std::string tempPath = cachePath + ".tmp" + std::to_string(std::hash<std::thread::id>()(std::this_thread::get_id()));
+    {
+        std::ofstream out(tempPath, std::ios::binary | std::ios::trunc);
+        if (!out)
+            return false;
+
+        const char padding[4] = {};
+        out.write(reinterpret_cast<const char *>(&header), sizeof(header));
+        out.write(reinterpret_cast<const char *>(&pairSize), sizeof(pairSize));
+        out.write(STAMP_KEY, sizeof(STAMP_KEY));
+        out.write(reinterpret_cast<const char *>(&value), sizeof(value));
+        out.write(padding, static_cast<std::streamsize>(alignUp(pairSize, 4) - pairSize));
+        for (const CompressedLevel &level : image.levels)
+        {
+            uint32_t imageSize = static_cast<uint32_t>(level.size);
+            out.write(reinterpret_cast<const char *>(&imageSize), sizeof(imageSize));
+            out.write(reinterpret_cast<const char *>(level.data), static_cast<std::streamsize>(level.size));
+            out.write(padding, static_cast<std::streamsize>(alignUp(level.size, 4) - level.size));
+        }
+
+        if (!out)
+            return false;
+    }
+
+    std::error_code ec;
+    std::filesystem::remove(cachePath, ec);
+    std::filesystem::rename(tempPath, cachePath, ec);
+    if (ec)
+    {
+        std::filesystem::remove(tempPath, ec);
+        return false;
+    }
+    return true;
+}
+
+void TextureCompressor::Upload(GLenum target, const CompressedImage &image)
+{
+    for (size_t i = 0; i < image.levels.size(); i++)
+    {
+        const CompressedLevel &level = image.levels[i];
+        glCompressedTexImage2D(target, static_cast<GLint>(i), image.internalFormat, level.width, level.height, 0,
+                               static_cast<GLsizei>(level.size), level.data);
+    }
+}
@@ -2,44 +2,73 @@
 #define STB_IMAGE_IMPLEMENTATION
 #include "stb_image.h"
 
-unsigned int loadTexture(const char* path)
+DecodedImage decodeImage(const char* path)
 {
-    unsigned int textureID;
-    glGenTextures(1, &textureID);
-    
-    int width, height, nrComponents;
-    unsigned char *data = stbi_load(path, &width, &height, &nrComponents, 0);
+    DecodedImage image;
+    unsigned char *data = stbi_load(path, &image.width, &image.height, &image.components, 0);
     if (data)
+        image.pixels.reset(data, stbi_image_free);
+    return image;
+}
+
+unsigned int uploadTexture(const DecodedImage& image, const char* path, unsigned int textureID,
+                           const TextureParams& params)
+{
+    if (textureID == 0)
+        glGenTextures(1, &textureID);
+
+    if (image.IsValid())
     {
         GLenum format;
-        if (nrComponents == 1)
+        if (image.components == 1)
             format = GL_RED;
-        else if (nrComponents == 3)
+        else if (image.components == 3)
             format = GL_RGB;
-        else if (nrComponents == 4)
+        else if (image.components == 4)
             format = GL_RGBA;
         else
             format = GL_RGB; // Par défaut
         
         glBindTexture(GL_TEXTURE_2D, textureID);
-        glTexImage2D(GL_TEXTURE_2D, 0, format, width, height, 0, format, GL_UNSIGNED_BYTE, data);
-        glGenerateMipmap(GL_TEXTURE_2D);
+        glTexImage2D(GL_TEXTURE_2D, 0, format, image.width, image.height, 0, format, GL_UNSIGNED_BYTE, image.pixels.get());
+        if (params.mipmaps)
+            glGenerateMipmap(GL_TEXTURE_2D);
         
         // Paramètres de texture    
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, params.wrap);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, params.wrap);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, params.mipmaps ? GL_LINEAR_MIPMAP_LINEAR : GL_LINEAR);
         glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
         
-        stbi_image_free(data);
         std::cout << "Texture chargée avec succès: " << path << std::endl;
-        std::cout << "Nombre de composantes de l'image: " << nrComponents << std::endl;
+        std::cout << "Nombre de composantes de l'image: " << image.components << std::endl;
     }
     else
     {
         std::cout << "Erreur lors du chargement de la texture: " << path << std::endl;
-        stbi_image_free(data);
     }
     
     return textureID;
 }
+
+unsigned int loadTexture(const char* path)
+{
+    return uploadTexture(decodeImage(path), path);
+}
+
+unsigned int getPlaceholderTexture()
+{
+    static unsigned int placeholderID = 0;
+    if (placeholderID == 0)
+    {
+        const unsigned char grey[3] = {128, 128, 128};
+        glGenTextures(1, &placeholderID);
+        glBindTexture(GL_TEXTURE_2D, placeholderID);
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB, 1, 1, 0, GL_RGB, GL_UNSIGNED_BYTE, grey);
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    }
+    return placeholderID;
+}
@@ -0,0 +1,104 @@
+#include "TrailRenderer.h"
+
+#include <algorithm>
+#include <cstddef>
+
+TrailRenderer::~TrailRenderer() {
+    if (vao != 0) {
+        glDeleteVertexArrays(1, &vao);
+        glDeleteBuffers(1, &trailVBO);
+        glDeleteTextures(1, &sampleTexture);
+        glDeleteBuffers(1, &sampleBuffer);
+    }
+}
+
+void TrailRenderer::Resize(size_t trailCount, size_t trailCapacity) {
+    capacity = std::max<size_t>(trailCapacity, 1);
+    trails.assign(trailCount, Trail());
+    samples.assign(trailCount * capacity, glm::vec4(0.0f));
+    for (size_t i = 0; i < trailCount; ++i) {
+        trails[i].first = static_cast<GLint>(i * capacity);
+    }
+}
+
+void TrailRenderer::Reset(size_t trail, const glm::vec3& position, size_t length) {
+    Trail& ring = trails[trail];
+    ring.length = static_cast<GLint>(std::clamp<size_t>(length, 1, capacity));
+    ring.head = 0;
+    ring.count = 1;
+    samples[ring.first] = glm::vec4(position, 0.0f);
+}
+
+void TrailRenderer::Push(size_t trail, const glm::vec3& position) {
+    Trail& ring = trails[trail];
+    ring.head = (ring.head + 1) % ring.length;
+    ring.count = std::min(ring.count + 1, ring.length);
+    samples[ring.first + ring.head] = glm::vec4(position, 0.0f);
+}
+
+void TrailRenderer::SetHead(size_t trail, const glm::vec3& position) {
+    const Trail& ring = trails[trail];
+    samples[ring.first + ring.head] = glm::vec4(position, 0.0f);
+}
+
+glm::vec3 TrailRenderer::GetSample(size_t trail, size_t age) const {
+    const Trail& ring = trails[trail];
+    GLint slot = (ring.head - static_cast<GLint>(age) % ring.length + ring.length) % ring.length;
+    return glm::vec3(samples[ring.first + slot]);
+}
+
+void TrailRenderer::SetStyle(size_t trail, const glm::vec3& color, float halfWidth) {
+    trails[trail].style = glm::vec4(color, halfWidth);
+}
+
+void TrailRenderer::CreateBuffers() {
+    glGenVertexArrays(1, &vao);
+    glGenBuffers(1, &trailVBO);
+    glGenBuffers(1, &sampleBuffer);
+    glGenTextures(1, &sampleTexture);
+
+    glBindVertexArray(vao);
+
+    // Aucun attribut par sommet : trail.vert déduit l'échantillon de gl_VertexID
+    glBindBuffer(GL_ARRAY_BUFFER, trailVBO);
+    glEnableVertexAttribArray(0);
+    glVertexAttribPointer(0, 4, GL_FLOAT, GL_FALSE, sizeof(Trail), (void*)offsetof(Trail, style));
+    glVertexAttribDivisor(0, 1);
+    glEnableVertexAttribArray(1);
+    glVertexAttribIPointer(1, 4, GL_INT, sizeof(Trail), (void*)offsetof(Trail, first));
+    glVertexAttribDivisor(1, 1);
+
+    glBindVertexArray(0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+}
+
+void TrailRenderer::Draw() {
+    if (trails.empty()) {
+        return;
+    }
+    if (vao == 0) {
+        CreateBuffers();
+    }
+
+    // Même stratégie que ParticleRenderer : orphelinage puis écriture
+    glBindBuffer(GL_ARRAY_BUFFER, trailVBO);
+    glBufferData(GL_ARRAY_BUFFER, trails.size() * sizeof(Trail), trails.data(), GL_STREAM_DRAW);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+    glBindBuffer(GL_TEXTURE_BUFFER, sampleBuffer);
+    glBufferData(GL_TEXTURE_BUFFER, samples.size() * sizeof(glm::vec4), nullptr, GL_STREAM_DRAW);
+    glBufferSubData(GL_TEXTURE_BUFFER, 0, samples.size() * sizeof(glm::vec4), samples.data());
+    glBindBuffer(GL_TEXTURE_BUFFER, 0);
+
+    // Échantillons lus par texelFetch sur l'unité 0 (valeur par défaut du sampler)
+    glActiveTexture(GL_TEXTURE0);
+    glBindTexture(GL_TEXTURE_BUFFER, sampleTexture);
+    glTexBuffer(GL_TEXTURE_BUFFER, GL_RGBA32F, sampleBuffer);
+
+    // Deux sommets (un de chaque bord) par emplacement de l'anneau
+    glBindVertexArray(vao);
+    glDrawArraysInstanced(GL_TRIANGLE_STRIP, 0, static_cast<GLsizei>(2 * capacity), static_cast<GLsizei>(trails.size()));
+    glBindVertexArray(0);
+
+    glBindTexture(GL_TEXTURE_BUFFER, 0);
+}
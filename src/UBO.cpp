@@ -1,4 +1,5 @@
 #include "UBO.h"
+#include <cstring>
 #include <iostream>
 #include <glm/gtc/matrix_transform.hpp>
 
@@ -6,7 +7,12 @@
 UBOManager* g_uboManager = nullptr;
 
 UBOManager::UBOManager() 
-    : cameraUBO(0), transformUBO(0), lightingUBO(0), initialized(false) {
+    : cameraUBO(0), transformUBO(0), lightingUBO(0),
+      transformRing(0), transformRingData(nullptr), transformFences(),
+      transformSlotSize(0), transformSlot(0), transformFrame(0),
+      initialized(false) {
+    lastTransform.model = glm::mat4(1.0f);
+    lastTransform.normalMatrix = glm::mat4(1.0f);
 }
 
 UBOManager::~UBOManager() {
@@ -36,11 +42,19 @@ bool UBOManager::Initialize() {
         return false;
     }
     
+    if (!CreateTransformRing()) {
+        std::cerr << "Erreur: échec de création de l'anneau de transformations" << std::endl;
+        return false;
+    }
+    
     initialized = true;
     std::cout << "Système UBO initialisé avec succès" << std::endl;
     std::cout << "- Camera UBO: " << cameraUBO << " (binding " << CAMERA_UBO_BINDING << ")" << std::endl;
     std::cout << "- Transform UBO: " << transformUBO << " (binding " << TRANSFORM_UBO_BINDING << ")" << std::endl;
     std::cout << "- Lighting UBO: " << lightingUBO << " (binding " << LIGHTING_UBO_BINDING << ")" << std::endl;
+    std::cout << "- Anneau de transformations: " << TRANSFORM_SLOTS_PER_FRAME << " emplacements de "
+              << transformSlotSize << " octets par frame ("
+              << (transformRingData ? "projection persistante" : "orphelinage") << ")" << std::endl;
     
     return true;
 }
@@ -58,6 +72,22 @@ void UBOManager::Cleanup() {
         glDeleteBuffers(1, &lightingUBO);
         lightingUBO = 0;
     }
+    for (GLsync& fence : transformFences) {
+        if (fence) {
+            glDeleteSync(fence);
+            fence = nullptr;
+        }
+    }
+    if (transformRing != 0) {
+        if (transformRingData) {
+            glBindBuffer(GL_UNIFORM_BUFFER, transformRing);
+            glUnmapBuffer(GL_UNIFORM_BUFFER);
+            glBindBuffer(GL_UNIFORM_BUFFER, 0);
+            transformRingData = nullptr;
+        }
+        glDeleteBuffers(1, &transformRing);
+        transformRing = 0;
+    }
     initialized = false;
     std::cout << "UBOs nettoyés" << std::endl;
 }
@@ -83,6 +113,107 @@ bool UBOManager::CreateUBO(GLuint& ubo, size_t size, GLuint bindingPoint) {
     return true;
 }
 
+bool UBOManager::CreateTransformRing() {
+    // Chaque emplacement doit commencer sur l'alignement exigé par glBindBufferRange
+    GLint alignment = 256;
+    glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &alignment);
+    transformSlotSize = (sizeof(TransformUBO) + alignment - 1) / alignment * alignment;
+    size_t regionSize = transformSlotSize * TRANSFORM_SLOTS_PER_FRAME;
+    
+    glGenBuffers(1, &transformRing);
+    if (transformRing == 0) {
+        return false;
+    }
+    glBindBuffer(GL_UNIFORM_BUFFER, transformRing);
+    
+    if (GLEW_ARB_buffer_storage) {
+        // Projection permanente : écriture directe, synchronisation par fences
+        GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+        GLsizeiptr size = regionSize * TRANSFORM_FRAME_COUNT;
+        glBufferStorage(GL_UNIFORM_BUFFER, size, nullptr, flags);
+        transformRingData = static_cast<unsigned char*>(glMapBufferRange(GL_UNIFORM_BUFFER, 0, size, flags));
+        
+        if (!transformRingData) {
+            // Stockage immuable : il faut un nouveau buffer pour le mode orphelinage
+            std::cerr << "Avertissement: projection persistante impossible, repli sur l'orphelinage" << std::endl;
+            glBindBuffer(GL_UNIFORM_BUFFER, 0);
+            glDeleteBuffers(1, &transformRing);
+            glGenBuffers(1, &transformRing);
+            glBindBuffer(GL_UNIFORM_BUFFER, transformRing);
+        }
+    }
+    
+    if (!transformRingData) {
+        glBufferData(GL_UNIFORM_BUFFER, regionSize, nullptr, GL_STREAM_DRAW);
+    }
+    glBindBuffer(GL_UNIFORM_BUFFER, 0);
+    
+    GLenum error = glGetError();
+    if (error != GL_NO_ERROR) {
+        std::cerr << "Erreur OpenGL lors de la création de l'anneau de transformations: " << error << std::endl;
+        return false;
+    }
+    return true;
+}
+
+void UBOManager::BeginFrame() {
+    if (!initialized) return;
+    
+    transformSlot = 0;
+    if (transformRingData) {
+        transformFrame = (transformFrame + 1) % TRANSFORM_FRAME_COUNT;
+        
+        // Attendre que le GPU ait fini de lire cette région (frame N - TRANSFORM_FRAME_COUNT)
+        GLsync& fence = transformFences[transformFrame];
+        if (fence) {
+            GLenum result = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 0);
+            while (result == GL_TIMEOUT_EXPIRED) {
+                result = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000);
+            }
+            glDeleteSync(fence);
+            fence = nullptr;
+        }
+    } else {
+        // Nouveau stockage : le pilote garde l'ancien tant que le GPU le lit
+        glBindBuffer(GL_UNIFORM_BUFFER, transformRing);
+        glBufferData(GL_UNIFORM_BUFFER, transformSlotSize * TRANSFORM_SLOTS_PER_FRAME, nullptr, GL_STREAM_DRAW);
+        glBindBuffer(GL_UNIFORM_BUFFER, 0);
+    }
+    
+    // Comme avec un UBO unique, la dernière transformation reste liée d'une frame à l'autre
+    WriteTransform(lastTransform);
+}
+
+void UBOManager::EndFrame() {
+    if (!initialized || !transformRingData) return;
+    
+    transformFences[transformFrame] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+}
+
+void UBOManager::WriteTransform(const TransformUBO& data) {
+    lastTransform = data;
+    
+    if (transformSlot >= TRANSFORM_SLOTS_PER_FRAME) {
+        // Région pleine : repli sur l'UBO unique (synchronisation implicite)
+        UpdateUBO(transformUBO, &data, sizeof(TransformUBO));
+        glBindBufferBase(GL_UNIFORM_BUFFER, TRANSFORM_UBO_BINDING, transformUBO);
+        return;
+    }
+    
+    size_t regionBase = transformRingData ? transformFrame * transformSlotSize * TRANSFORM_SLOTS_PER_FRAME : 0;
+    GLintptr offset = regionBase + transformSlot * transformSlotSize;
+    transformSlot++;
+    
+    if (transformRingData) {
+        std::memcpy(transformRingData + offset, &data, sizeof(TransformUBO));
+    } else {
+        glBindBuffer(GL_UNIFORM_BUFFER, transformRing);
+        glBufferSubData(GL_UNIFORM_BUFFER, offset, sizeof(TransformUBO), &data);
+    }
+    glBindBufferRange(GL_UNIFORM_BUFFER, TRANSFORM_UBO_BINDING, transformRing, offset, sizeof(TransformUBO));
+    glBindBuffer(GL_UNIFORM_BUFFER, 0);
+}
+
 void UBOManager::UpdateUBO(GLuint ubo, const void* data, size_t size) {
     glBindBuffer(GL_UNIFORM_BUFFER, ubo);
     glBufferSubData(GL_UNIFORM_BUFFER, 0, size, data);
@@ -117,7 +248,7 @@ void UBOManager::UpdateTransformUBO(const glm::mat4& model) {
         glm::vec4(0.0f, 0.0f, 0.0f, 1.0f)
     );
     
-    UpdateUBO(transformUBO, &transformData, sizeof(TransformUBO));
+    WriteTransform(transformData);
 }
 
 void UBOManager::UpdateLightingUBO(const glm::vec3& lightPos, const glm::vec3& lightColor, 
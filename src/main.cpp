@@ -1,6 +1,11 @@
 #include <GL/glew.h>
 #include <GLFW/glfw3.h>
 #include <iostream>
+#include <cctype>
+#include <cerrno>
+#include <cmath>
+#include <cstdlib>
+#include <string>
 
 #include "Shader.h"
 #include "Camera.h"
@@ -15,6 +20,13 @@
 #include "LightScene.h"
 #include "UBO.h"
 #include "ShaderManager.h"
+#include "AssetLoader.h"
+#include "TextureCache.h"
+#include "RenderQueue.h"
+#include "GeometryBuffer.h"
+#include "JobSystem.h"
+#include "Random.h"
+#include "SimulationThread.h"
 #include <glm/gtc/matrix_transform.hpp>
 
 // === ImGui ===
@@ -35,6 +47,10 @@ ControlMode currentMode = CAMERA_MODE;
 const unsigned int SCR_WIDTH = 1280;
 const unsigned int SCR_HEIGHT = 720;
 
+// Budget d'envoi GPU par frame pour les ressources chargées en arrière-plan
+const size_t UPLOAD_BUDGET_BYTES = 8 * 1024 * 1024;
+const double UPLOAD_BUDGET_MS = 2.0;
+
 // Caméra globale
 Camera camera(glm::vec3(0.0f, 0.0f, 3.0f));
 
@@ -71,8 +87,55 @@ bool firstMouse = true;
 
 // Variables audio supprimées - gérées par les scènes individuellement
 
-int main()
+int main(int argc, char* argv[])
 {
+    // === Options de la ligne de commande ===
+    // --seed N : graine des flux Random, mêmes scènes d'une exécution à l'autre
+    // --sim-rate HZ : cadence de la simulation à pas fixe, 0 pour simuler sur le thread principal
+    double simulationRate = SimulationThread::DEFAULT_RATE;
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string option = argv[i];
+        if ((option == "--seed" || option == "--sim-rate") && i + 1 >= argc)
+        {
+            std::cerr << "Erreur : valeur manquante pour " << option << std::endl;
+            return -1;
+        }
+        if (option == "--seed")
+        {
+            // strtoull accepterait un signe ("-1" deviendrait 2^64 - 1) : chiffres seulement, sans dépassement
+            const char* value = argv[++i];
+            char* end = nullptr;
+            errno = 0;
+            unsigned long long seed = std::strtoull(value, &end, 10);
+            if (!std::isdigit(static_cast<unsigned char>(value[0])) || *end != '\0' || errno == ERANGE)
+            {
+                std::cerr << "Erreur : graine invalide pour --seed : " << value << std::endl;
+                return -1;
+            }
+            Random::SetGlobalSeed(seed);
+        }
+        else if (option == "--sim-rate")
+        {
+            const char* value = argv[++i];
+            char* end = nullptr;
+            simulationRate = std::strtod(value, &end);
+            if (end == value || *end != '\0' || !std::isfinite(simulationRate) || simulationRate < 0.0)
+            {
+                std::cerr << "Erreur : cadence invalide pour --sim-rate : " << value << std::endl;
+                return -1;
+            }
+        }
+        else
+        {
+            std::cerr << "Option inconnue ignorée : " << option << std::endl;
+        }
+    }
+    std::cout << "Graine aléatoire : " << Random::GetGlobalSeed() << std::endl;
+
+    // Le thread de simulation travaille aussi dans JobSystem::Wait : un cœur lui est laissé
+    JobSystem::ReserveExternalThreads(simulationRate > 0.0 ? 2 : 1);
+
     // Initialisation GLFW
     glfwInit();
     glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
@@ -128,6 +191,10 @@ int main()
         return -1;
     }
 
+    // === Initialisation du chargement asynchrone des ressources ===
+    AssetLoader::getInstance().Initialize();
+    AssetLoader::getInstance().SetUploadBudget(UPLOAD_BUDGET_BYTES, UPLOAD_BUDGET_MS);
+
     // === Initialisation du système audio ===
     if (!soundManager.Initialize()) {        std::cerr << "Erreur : échec de l'initialisation du système audio" << std::endl;
         // Continuer sans audio
@@ -152,6 +219,9 @@ int main()
     std::cout << "Système de scènes initialisé avec " << sceneManager.GetSceneCount() << " scène(s)" << std::endl;
     std::cout << "Scène active : " << sceneManager.GetCurrentSceneName() << std::endl;
 
+    // Simulation à pas fixe sur son propre thread : le rendu interpole ses instantanés
+    SimulationThread::getInstance().Start(sceneManager, simulationRate);
+
     // Configurer les callbacks de la souris
     glfwSetCursorPosCallback(window, [](GLFWwindow* w, double x, double y) {
         ImGui_ImplGlfw_CursorPosCallback(w, x, y); // transmet à ImGui
@@ -173,6 +243,7 @@ int main()
     std::cout << "=================" << std::endl;
 
     // Boucle de rendu
+    bool firstFrameShown = false;
     while (!glfwWindowShouldClose(window))
     {
         // Temps
@@ -186,11 +257,22 @@ int main()
         // Mettre à jour le système audio
         soundManager.Update();
 
+        // Envoyer au GPU les ressources décodées en arrière-plan
+        AssetLoader::getInstance().ProcessUploads();
+
+        // Sans thread de simulation, la simulation avance ici au pas de la frame
+        if (!SimulationThread::getInstance().IsRunning()) {
+            sceneManager.Simulate(deltaTime, SimulationThread::Now());
+        }
+
         // Mettre à jour le gestionnaire de scènes
         sceneManager.Update(deltaTime, window, camera, soundManager);
 
         // === Mise à jour des UBOs ===
         if (g_uboManager) {
+            // Nouvelle région de l'anneau de transformations
+            g_uboManager->BeginFrame();
+            
             // Matrices de projection et de vue
             glm::mat4 projection = glm::perspective(glm::radians(camera.Zoom), 
                                                    (float)SCR_WIDTH / (float)SCR_HEIGHT, 
@@ -236,6 +318,41 @@ int main()
         ImGui::Text("Direction caméra: (%.1f, %.1f, %.1f)", 
                    camera.Front.x, camera.Front.y, camera.Front.z);
           ImGui::Separator();
+
+        // Chargement des ressources en arrière-plan
+        AssetLoader& assetLoader = AssetLoader::getInstance();
+        ImGui::Text("Ressources en chargement: %zu", assetLoader.GetPendingCount());
+        ImGui::Text("Dernier envoi GPU: %.1f Ko en %.2f ms",
+                   assetLoader.GetLastFrameBytes() / 1024.0, assetLoader.GetLastFrameMs());
+        TextureCache& textureCache = TextureCache::getInstance();
+        ImGui::Text("Textures partagées: %zu (%.1f Mo)",
+                   textureCache.GetTextureCount(), textureCache.GetTotalBytes() / (1024.0 * 1024.0));
+        const RenderQueueStats& queueStats = RenderQueue::getInstance().GetStats();
+        ImGui::Text("File de rendu: %zu tirages en %zu appels, %zu changements d'état (%zu évités par le tri)",
+                   queueStats.draws, queueStats.drawCalls, queueStats.GetStateChanges(),
+                   queueStats.GetSavedStateChanges());
+        GeometryBuffer& geometryBuffer = GeometryBuffer::getInstance();
+        ImGui::Text("Géométrie partagée: %zu plages, %.1f / %.1f Mo (%s)",
+                   geometryBuffer.GetRangeCount(),
+                   (geometryBuffer.GetVertexBytes() + geometryBuffer.GetIndexBytes()) / (1024.0 * 1024.0),
+                   (geometryBuffer.GetVertexCapacity() + geometryBuffer.GetIndexCapacity()) / (1024.0 * 1024.0),
+                   geometryBuffer.IsIndirectSupported() ? "multi-draw indirect" : "multi-draw");
+        JobSystem& jobSystem = JobSystem::getInstance();
+        ImGui::Text("Tâches: %u threads, %zu exécutées, %zu volées",
+                   jobSystem.GetWorkerCount(), jobSystem.GetExecutedCount(), jobSystem.GetStolenCount());
+        SimulationThread& simulationThread = SimulationThread::getInstance();
+        if (simulationThread.IsRunning()) {
+            ImGui::Text("Simulation: %.0f Hz, dernier pas %.2f ms, %zu pas, %zu abandonnés",
+                       simulationThread.GetRate(), simulationThread.GetLastStepMs(),
+                       simulationThread.GetStepCount(), simulationThread.GetDroppedStepCount());
+            float rate = static_cast<float>(simulationThread.GetRate());
+            if (ImGui::SliderFloat("Cadence (Hz)", &rate, 10.0f, 240.0f, "%.0f")) {
+                simulationThread.SetRate(rate);
+            }
+        } else {
+            ImGui::Text("Simulation: thread principal, pas variable");
+        }
+        ImGui::Separator();
         
         // Instructions
         ImGui::Text("Contrôles:");
@@ -270,17 +387,32 @@ int main()
         ImGui::Render();
         ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
 
+        // Fence de fin de frame pour l'anneau de transformations
+        if (g_uboManager) {
+            g_uboManager->EndFrame();
+        }
+
         // Affichage
         glfwSwapBuffers(window);
         glfwPollEvents();
+
+        // Délai avant la première image (glfwGetTime part de glfwInit)
+        if (!firstFrameShown) {
+            firstFrameShown = true;
+            std::cout << "Première frame affichée après " << glfwGetTime() * 1000.0 << " ms" << std::endl;
+        }
     }
 
     // === Nettoyage ===
+    AssetLoader::getInstance().Shutdown();
+    SimulationThread::getInstance().Stop();
     sceneManager.Cleanup();
+    JobSystem::getInstance().Shutdown();
     soundManager.Shutdown();
     
     // Nettoyage du gestionnaire de shaders
     ShaderManager::getInstance().Cleanup();
+    GeometryBuffer::getInstance().Cleanup();
     
     // Nettoyage du système UBO
     if (g_uboManager) {